@@ -477,6 +477,7 @@ static lv_demo_benchmark_scene_dsc_t scenes[] = {
 static uint32_t scene_act;
 static uint32_t rnd_act;
 static lv_demo_benchmark_on_end_cb_t on_demo_end_cb;
+static lv_demo_benchmark_on_scene_cb_t on_scene_cb;
 
 /**********************
  *      MACROS
@@ -526,6 +527,11 @@ void lv_demo_benchmark_set_end_cb(lv_demo_benchmark_on_end_cb_t cb)
     on_demo_end_cb = cb;
 }
 
+void lv_demo_benchmark_set_scene_cb(lv_demo_benchmark_on_scene_cb_t cb)
+{
+    on_scene_cb = cb;
+}
+
 void lv_demo_benchmark_summary_display(const lv_demo_benchmark_summary_t * summary)
 {
     LV_ASSERT_NULL(summary)
@@ -642,7 +648,10 @@ static void load_scene(lv_obj_t * scr, uint32_t scene)
     lv_obj_set_style_bg_opa(lv_layer_top(), LV_OPA_TRANSP, 0);
 
     rnd_reset();
-    if(scenes[scene].create_cb) scenes[scene].create_cb(scr);
+    if(scenes[scene].create_cb) {
+        scenes[scene].create_cb(scr);
+        if(on_scene_cb) on_scene_cb(&scenes[scene]);
+    }
 }
 
 static void next_scene_timer_cb(lv_timer_t * timer)
@@ -78,6 +78,8 @@ typedef struct {
 
 typedef void (*lv_demo_benchmark_on_end_cb_t)(const lv_demo_benchmark_summary_t *);
 
+typedef void (*lv_demo_benchmark_on_scene_cb_t)(const lv_demo_benchmark_scene_dsc_t *);
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -109,6 +111,13 @@ void lv_demo_benchmark(void);
  */
 void lv_demo_benchmark_set_end_cb(lv_demo_benchmark_on_end_cb_t cb);
 
+/*
+ * Register a function to call when a scene is loaded,
+ * e.g. to attribute the measurements of a custom display driver to the scenes
+ * @param cb    function to call with the descriptor of the new scene
+ */
+void lv_demo_benchmark_set_scene_cb(lv_demo_benchmark_on_scene_cb_t cb);
+
 
 /*
  * Display and log the summary
@@ -417,6 +417,14 @@
     #endif
 #endif
 
+#ifndef LV_DRAW_LAYER_RETAINED_MAX_MEMORY
+    #ifdef CONFIG_LV_DRAW_LAYER_RETAINED_MAX_MEMORY
+        #define LV_DRAW_LAYER_RETAINED_MAX_MEMORY CONFIG_LV_DRAW_LAYER_RETAINED_MAX_MEMORY
+    #else
+        #define LV_DRAW_LAYER_RETAINED_MAX_MEMORY 262144
+    #endif
+#endif
+
 #ifndef LV_DRAW_THREAD_STACK_SIZE
     #ifdef CONFIG_LV_DRAW_THREAD_STACK_SIZE
         #define LV_DRAW_THREAD_STACK_SIZE CONFIG_LV_DRAW_THREAD_STACK_SIZE
@@ -673,6 +681,14 @@
     #endif
 #endif
 
+#ifndef LV_DRAW_SW_GRAD_CACHE_CNT
+    #ifdef CONFIG_LV_DRAW_SW_GRAD_CACHE_CNT
+        #define LV_DRAW_SW_GRAD_CACHE_CNT CONFIG_LV_DRAW_SW_GRAD_CACHE_CNT
+    #else
+        #define LV_DRAW_SW_GRAD_CACHE_CNT 8
+    #endif
+#endif
+
 #ifndef LV_DRAW_SW_SHADOW_CACHE_SIZE
     #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
         #define LV_DRAW_SW_SHADOW_CACHE_SIZE CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
@@ -681,6 +697,14 @@
     #endif
 #endif
 
+#ifndef LV_DRAW_SW_SHADOW_CACHE_CNT
+    #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_CNT
+        #define LV_DRAW_SW_SHADOW_CACHE_CNT CONFIG_LV_DRAW_SW_SHADOW_CACHE_CNT
+    #else
+        #define LV_DRAW_SW_SHADOW_CACHE_CNT 8
+    #endif
+#endif
+
 #ifndef LV_DRAW_SW_CIRCLE_CACHE_SIZE
     #ifdef CONFIG_LV_DRAW_SW_CIRCLE_CACHE_SIZE
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE CONFIG_LV_DRAW_SW_CIRCLE_CACHE_SIZE
@@ -1309,6 +1333,14 @@
     #endif
 #endif
 
+#ifndef LV_ASYNC_QUEUE_SIZE
+    #ifdef CONFIG_LV_ASYNC_QUEUE_SIZE
+        #define LV_ASYNC_QUEUE_SIZE CONFIG_LV_ASYNC_QUEUE_SIZE
+    #else
+        #define LV_ASYNC_QUEUE_SIZE 0
+    #endif
+#endif
+
 #ifndef LV_USE_TRANSLATION
     #ifdef CONFIG_LV_USE_TRANSLATION
         #define LV_USE_TRANSLATION CONFIG_LV_USE_TRANSLATION
@@ -1609,6 +1641,22 @@
     #endif
 #endif
 
+#ifndef LV_IMAGE_CACHE_USE_HASH_TABLE
+    #ifdef CONFIG_LV_IMAGE_CACHE_USE_HASH_TABLE
+        #define LV_IMAGE_CACHE_USE_HASH_TABLE CONFIG_LV_IMAGE_CACHE_USE_HASH_TABLE
+    #else
+        #define LV_IMAGE_CACHE_USE_HASH_TABLE 0
+    #endif
+#endif
+
+#ifndef LV_CACHE_SHARD_CNT
+    #ifdef CONFIG_LV_CACHE_SHARD_CNT
+        #define LV_CACHE_SHARD_CNT CONFIG_LV_CACHE_SHARD_CNT
+    #else
+        #define LV_CACHE_SHARD_CNT 4
+    #endif
+#endif
+
 #ifndef LV_USE_RLE
     #ifdef CONFIG_LV_USE_RLE
         #define LV_USE_RLE CONFIG_LV_USE_RLE
@@ -1717,6 +1765,14 @@
     #endif
 #endif
 
+#ifndef LV_SVG_RASTER_CACHE_CNT
+    #ifdef CONFIG_LV_SVG_RASTER_CACHE_CNT
+        #define LV_SVG_RASTER_CACHE_CNT CONFIG_LV_SVG_RASTER_CACHE_CNT
+    #else
+        #define LV_SVG_RASTER_CACHE_CNT 0
+    #endif
+#endif
+
 
 
 /*============================================================================
@@ -3003,6 +3059,14 @@
     #endif
 #endif
 
+#ifndef LV_LINUX_DRM_BUFFER_COUNT
+    #ifdef CONFIG_LV_LINUX_DRM_BUFFER_COUNT
+        #define LV_LINUX_DRM_BUFFER_COUNT CONFIG_LV_LINUX_DRM_BUFFER_COUNT
+    #else
+        #define LV_LINUX_DRM_BUFFER_COUNT 2
+    #endif
+#endif
+
 #ifndef LV_USE_LINUX_FBDEV
     #ifdef CONFIG_LV_USE_LINUX_FBDEV
         #define LV_USE_LINUX_FBDEV CONFIG_LV_USE_LINUX_FBDEV
@@ -3063,6 +3127,14 @@
     #endif
 #endif
 
+#ifndef LV_USE_HEADLESS_DISPLAY
+    #ifdef CONFIG_LV_USE_HEADLESS_DISPLAY
+        #define LV_USE_HEADLESS_DISPLAY CONFIG_LV_USE_HEADLESS_DISPLAY
+    #else
+        #define LV_USE_HEADLESS_DISPLAY 0
+    #endif
+#endif
+
 #ifndef LV_USE_LOVYAN_GFX
     #ifdef CONFIG_LV_USE_LOVYAN_GFX
         #define LV_USE_LOVYAN_GFX CONFIG_LV_USE_LOVYAN_GFX
@@ -3251,6 +3323,14 @@
     #endif
 #endif
 
+#ifndef LV_USE_LINUX_EVENT_LOOP
+    #ifdef CONFIG_LV_USE_LINUX_EVENT_LOOP
+        #define LV_USE_LINUX_EVENT_LOOP CONFIG_LV_USE_LINUX_EVENT_LOOP
+    #else
+        #define LV_USE_LINUX_EVENT_LOOP 0
+    #endif
+#endif
+
 #ifndef LV_USE_NUTTX
     #ifdef CONFIG_LV_USE_NUTTX
         #define LV_USE_NUTTX CONFIG_LV_USE_NUTTX
@@ -384,6 +384,15 @@ void lv_obj_set_send_draw_task_events(lv_obj_t * obj, bool en);
  */
 void lv_obj_set_overflow_visible(lv_obj_t * obj, bool en);
 
+/** Render the widget and its children once into a bitmap and draw the bitmap in the later refreshes.
+ * The bitmap is rendered again when the widget or any of its descendants is invalidated.
+ * @param obj     pointer to a widget
+ * @param en      enable or disable the retained layer
+ * @note If the bitmap doesn't fit into `LV_DRAW_LAYER_RETAINED_MAX_MEMORY`
+ *       or the widget is transformed, the widget is rendered normally.
+ */
+void lv_obj_set_retained_layer(lv_obj_t * obj, bool en);
+
 /** Propagate the events to the children too
  * @param obj     pointer to a widget
  * @param en      enable or disable event trickling
@@ -597,6 +606,12 @@ bool lv_obj_is_send_draw_task_events(const lv_obj_t * obj);
  */
 bool lv_obj_is_overflow_visible(const lv_obj_t * obj);
 
+/** Get whether the widget is rendered into a retained bitmap
+ * @param obj     pointer to a widget
+ * @return        true if the retained layer is enabled
+ */
+bool lv_obj_is_retained_layer(const lv_obj_t * obj);
+
 /** Get whether events trickle to the children
  * @param obj     pointer to a widget
  * @return        true if event trickling is enabled
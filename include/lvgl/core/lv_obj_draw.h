@@ -49,6 +49,12 @@ typedef enum {
      * In this case there is no limitation on the buffer size.
      * LVGL will allocate as large buffer as needed to render the transformed area.*/
     LV_LAYER_TYPE_TRANSFORM,
+
+    /**The widget and its children are rendered once into a bitmap which is kept
+     * and drawn in the later refreshes until the widget or a descendant is invalidated.
+     * Enabled by `lv_obj_set_retained_layer()`. The memory of all the retained bitmaps
+     * is limited by `LV_DRAW_LAYER_RETAINED_MAX_MEMORY` in lv_conf.h.*/
+    LV_LAYER_TYPE_RETAINED,
 } lv_layer_type_t;
 
 /**********************
@@ -1307,7 +1307,8 @@ static inline bool lv_obj_get_style_blur_backdrop(const lv_obj_t * obj, lv_part_
 /**
  * Setting to `LV_BLUR_QUALITY_SPEED` the blurring algorithm will prefer speed over
  * quality. `LV_BLUR_QUALITY_PRECISION` will force using higher quality but slower
- * blur. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically.
+ * blur. `LV_BLUR_QUALITY_PYRAMID` blurs a downscaled copy which is the fastest on
+ * large radii. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically.
  * Default: `LV_BLUR_QUALITY_AUTO`, inherited: No, layout: No, ext. draw: No.
  * @param  obj    Pointer to Widget
  * @param  part   One of the `LV_PART_...` enum values
@@ -1394,7 +1395,8 @@ static inline lv_opa_t lv_obj_get_style_drop_shadow_opa(const lv_obj_t * obj, lv
 /**
  * Setting to `LV_BLUR_QUALITY_SPEED` the blurring algorithm will prefer speed over
  * quality. `LV_BLUR_QUALITY_PRECISION` will force using higher quality but slower
- * blur. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically.
+ * blur. `LV_BLUR_QUALITY_PYRAMID` blurs a downscaled copy which is the fastest on
+ * large radii. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically.
  * Default: `LV_BLUR_QUALITY_PRECISION`, inherited: No, layout: No, ext. draw: No.
  * @param  obj    Pointer to Widget
  * @param  part   One of the `LV_PART_...` enum values
@@ -3059,7 +3061,8 @@ void lv_obj_set_style_blur_backdrop(lv_obj_t * obj, bool value, lv_style_selecto
 /**
  * Setting to `LV_BLUR_QUALITY_SPEED` the blurring algorithm will prefer speed over
  * quality. `LV_BLUR_QUALITY_PRECISION` will force using higher quality but slower
- * blur. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically.
+ * blur. `LV_BLUR_QUALITY_PYRAMID` blurs a downscaled copy which is the fastest on
+ * large radii. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically.
  * Default: `LV_BLUR_QUALITY_AUTO`, inherited: No, layout: No, ext. draw: No.
  * @param  obj        Pointer to Widget
  * @param  value      Value to submit
@@ -3140,7 +3143,8 @@ void lv_obj_set_style_drop_shadow_opa(lv_obj_t * obj, lv_opa_t value, lv_style_s
 /**
  * Setting to `LV_BLUR_QUALITY_SPEED` the blurring algorithm will prefer speed over
  * quality. `LV_BLUR_QUALITY_PRECISION` will force using higher quality but slower
- * blur. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically.
+ * blur. `LV_BLUR_QUALITY_PYRAMID` blurs a downscaled copy which is the fastest on
+ * large radii. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically.
  * Default: `LV_BLUR_QUALITY_PRECISION`, inherited: No, layout: No, ext. draw: No.
  * @param  obj        Pointer to Widget
  * @param  value      Value to submit
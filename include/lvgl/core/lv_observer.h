@@ -71,6 +71,10 @@ struct _lv_subject_t {
     uint32_t size                 : 24;  /**< String buffer size or group length */
     uint32_t notify_restart_query :  1;  /**< If an Observer was deleted during notification,
                                           * start notifying from the beginning. */
+#if LV_ASYNC_QUEUE_SIZE > 0
+    volatile int32_t async_value;        /**< Latest value passed to lv_async_subject_set_int() */
+    volatile uint32_t async_pending;     /**< 1: an lv_async_subject_set_int() update is queued */
+#endif
 };
 
 /**
@@ -122,6 +122,7 @@ typedef enum {
     LV_BLUR_QUALITY_AUTO = 0,   /**< Set the quality automatically */
     LV_BLUR_QUALITY_SPEED,      /**< Prefer speed over precision */
     LV_BLUR_QUALITY_PRECISION,  /**< Prefer precision over speed*/
+    LV_BLUR_QUALITY_PYRAMID,    /**< Blur a downsampled copy and scale it back. Fastest on large radii*/
 } lv_blur_quality_t;
 
 /** A image colorkey definition.
@@ -810,7 +810,8 @@ void lv_style_set_blur_backdrop(lv_style_t * style, bool value);
 /**
  * Setting to `LV_BLUR_QUALITY_SPEED` the blurring algorithm will prefer speed over
  * quality. `LV_BLUR_QUALITY_PRECISION` will force using higher quality but slower
- * blur. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically.
+ * blur. `LV_BLUR_QUALITY_PYRAMID` blurs a downscaled copy which is the fastest on
+ * large radii. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically.
  * Default: `LV_BLUR_QUALITY_AUTO`, inherited: No, layout: No, ext. draw: No.
  * @param  style   Pointer to style
  * @param  value   Value to submit
@@ -861,7 +862,8 @@ void lv_style_set_drop_shadow_opa(lv_style_t * style, lv_opa_t value);
 /**
  * Setting to `LV_BLUR_QUALITY_SPEED` the blurring algorithm will prefer speed over
  * quality. `LV_BLUR_QUALITY_PRECISION` will force using higher quality but slower
- * blur. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically.
+ * blur. `LV_BLUR_QUALITY_PYRAMID` blurs a downscaled copy which is the fastest on
+ * large radii. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically.
  * Default: `LV_BLUR_QUALITY_PRECISION`, inherited: No, layout: No, ext. draw: No.
  * @param  style   Pointer to style
  * @param  value   Value to submit
@@ -2124,7 +2126,8 @@ void lv_style_set_grid_cell_row_span(lv_style_t * style, int32_t value);
 /**
  * Setting to `LV_BLUR_QUALITY_SPEED` the blurring algorithm will prefer speed over
  * quality. `LV_BLUR_QUALITY_PRECISION` will force using higher quality but slower
- * blur. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically.
+ * blur. `LV_BLUR_QUALITY_PYRAMID` blurs a downscaled copy which is the fastest on
+ * large radii. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically.
  * Default: `LV_BLUR_QUALITY_AUTO`, inherited: No, layout: No, ext. draw: No.
  * @param  val   Value to submit
  */
@@ -2187,7 +2190,8 @@ void lv_style_set_grid_cell_row_span(lv_style_t * style, int32_t value);
 /**
  * Setting to `LV_BLUR_QUALITY_SPEED` the blurring algorithm will prefer speed over
  * quality. `LV_BLUR_QUALITY_PRECISION` will force using higher quality but slower
- * blur. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically.
+ * blur. `LV_BLUR_QUALITY_PYRAMID` blurs a downscaled copy which is the fastest on
+ * large radii. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically.
  * Default: `LV_BLUR_QUALITY_PRECISION`, inherited: No, layout: No, ext. draw: No.
  * @param  val   Value to submit
  */
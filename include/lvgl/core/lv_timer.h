@@ -141,6 +141,14 @@ void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count);
  */
 void lv_timer_set_auto_delete(lv_timer_t * timer, bool auto_delete);
 
+/**
+ * Mark a timer as low priority. While a display misses its frame budget
+ * low priority timers are postponed by up to one more period to leave time for rendering.
+ * @param timer pointer to a lv_timer.
+ * @param low_priority true: the timer can be postponed; false: always run it on time (default)
+ */
+void lv_timer_set_low_priority(lv_timer_t * timer, bool low_priority);
+
 /**
  * Set custom parameter to the lv_timer.
  * @param timer pointer to a lv_timer.
@@ -398,6 +398,23 @@ void lv_display_set_antialiasing(lv_display_t * disp, bool en);
  */
 bool lv_display_get_antialiasing(lv_display_t * disp);
 
+/**
+ * Move the already rendered pixels when a widget is scrolled and redraw only the newly exposed parts.
+ * It works only in LV_DISPLAY_RENDER_MODE_DIRECT with one or two draw buffers and requires
+ * that the flush callback doesn't modify the draw buffer. Widgets which are transparent,
+ * transformed, covered by other widgets or have a non-solid background are still fully redrawn.
+ * @param disp      pointer to a display
+ * @param en        true: enable scroll blitting
+ */
+void lv_display_set_scroll_blit(lv_display_t * disp, bool en);
+
+/**
+ * Get if scroll blitting is enabled on a display
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          true/false
+ */
+bool lv_display_get_scroll_blit(lv_display_t * disp);
+
 /**
  * Call from the display driver when the flushing is finished
  * @param disp      pointer to display whose `flush_cb` was called
@@ -691,6 +708,64 @@ bool lv_display_unregister_vsync_event(lv_display_t * disp, lv_event_cb_t event_
  */
 lv_result_t lv_display_send_vsync_event(lv_display_t * disp, void * param);
 
+/**
+ * Report a vsync with the time when it happened. Use it instead of `lv_display_send_vsync_event`
+ * if the driver knows the time of the vsync (e.g. from an interrupt or a page flip event).
+ * It sends `LV_EVENT_VSYNC` too.
+ * @param disp          pointer to a display
+ * @param timestamp     time of the vsync in `lv_tick_get()` units
+ * @return              LV_RESULT_OK: disp wasn't deleted in the event.
+ */
+lv_result_t lv_display_report_vsync(lv_display_t * disp, uint32_t timestamp);
+
+/**
+ * Start refreshing only when a vsync arrives instead of on the refresh timer.
+ * This way rendering starts at the beginning of the frame and has the whole frame time.
+ * The driver needs to report the vsyncs with `lv_display_report_vsync` or `lv_display_send_vsync_event`
+ * while the `LV_EVENT_VSYNC_REQUEST` event's parameter is not `NULL`.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param en        true: enable vsync pacing; false: refresh on the refresh timer
+ */
+void lv_display_set_vsync_pacing(lv_display_t * disp, bool en);
+
+/**
+ * Get whether vsync pacing is enabled
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          true: vsync pacing is enabled
+ */
+bool lv_display_get_vsync_pacing(lv_display_t * disp);
+
+/**
+ * Set the time a frame can take from its start (the vsync if paced) until it's flushed.
+ * If a frame takes longer, animations are stepped less often and low priority timers
+ * are postponed until the frames fit in the budget again.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param budget    max. time of a frame in milliseconds, 0: use the measured vsync period
+ *                  (no budget if there are no vsyncs)
+ */
+void lv_display_set_frame_budget(lv_display_t * disp, uint32_t budget);
+
+/**
+ * Get the frame budget in effect
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          the frame budget in milliseconds, 0: no budget
+ */
+uint32_t lv_display_get_frame_budget(lv_display_t * disp);
+
+/**
+ * Get how many frames have missed the frame budget since the display was created
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          number of frames over the budget
+ */
+uint32_t lv_display_get_frame_budget_miss_count(lv_display_t * disp);
+
+/**
+ * Check whether the last rendered frame has missed the frame budget
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          true: the last frame was over the budget
+ */
+bool lv_display_is_over_budget(lv_display_t * disp);
+
 void lv_display_set_user_data(lv_display_t * disp, void * user_data);
 void lv_display_set_driver_data(lv_display_t * disp, void * driver_data);
 void * lv_display_get_user_data(lv_display_t * disp);
@@ -266,6 +266,13 @@ void lv_draw_dispatch_request(void);
   */
 uint32_t lv_draw_get_unit_count(void);
 
+/**
+ * Get the number of draw tasks added since LVGL was initialized.
+ * The difference of two calls tells how many draw tasks were created in between, e.g. in a frame.
+ * @return      the number of added draw tasks (wraps around on overflow)
+ */
+uint32_t lv_draw_get_task_count(void);
+
 /**
  * If there is only one draw unit check the first draw task if it's available.
  * If there are multiple draw units call `lv_draw_get_next_available_task` to find a task.
@@ -0,0 +1,114 @@
+/**
+ * @file lv_headless_display.h
+ *
+ */
+
+#ifndef LV_HEADLESS_DISPLAY_H
+#define LV_HEADLESS_DISPLAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../display/lv_display.h"
+
+#if LV_USE_HEADLESS_DISPLAY
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Measurements of a refreshed frame
+ */
+typedef struct {
+    uint32_t render_time_us;    /**< Time of the refresh without the time spent waiting for the transfer */
+    uint32_t flush_time_us;     /**< Time spent in the flush callback and waiting for the transfer */
+    uint32_t draw_task_cnt;     /**< Number of draw tasks created for the frame */
+    uint32_t flush_cnt;         /**< Number of flushed areas */
+    uint32_t flushed_px_cnt;    /**< Number of flushed pixels */
+} lv_headless_display_frame_info_t;
+
+/**
+ * Called after each frame which flushed something
+ * @param disp          the headless display
+ * @param info          measurements of the frame
+ * @param user_data     the parameter passed to lv_headless_display_set_frame_cb()
+ */
+typedef void (*lv_headless_display_frame_cb_t)(lv_display_t * disp, const lv_headless_display_frame_info_t * info,
+                                               void * user_data);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a display which doesn't show anything but measures the rendering.
+ * It's meant for benchmarks in CI or on hosts without a screen.
+ * Two draw buffers are allocated, in partial mode with 1/10 of the screen size.
+ * @param hor_res       horizontal resolution
+ * @param ver_res       vertical resolution
+ * @param render_mode   the render mode to measure
+ * @return              the new display or NULL on error
+ */
+lv_display_t * lv_headless_display_create(int32_t hor_res, int32_t ver_res, lv_display_render_mode_t render_mode);
+
+/**
+ * Simulate the transfer to a real display. The transfer of each flushed area takes
+ * `latency_us` plus the time needed to send its pixels with `kbyte_per_sec`. Like a DMA
+ * transfer it runs in parallel with the rendering of the next area.
+ * @param disp          a headless display
+ * @param latency_us    fixed time of a transfer in microseconds
+ * @param kbyte_per_sec bandwidth of the simulated bus in kilobytes per second, 0 for unlimited
+ */
+void lv_headless_display_set_transfer_time(lv_display_t * disp, uint32_t latency_us, uint32_t kbyte_per_sec);
+
+/**
+ * Copy the flushed areas into a screen sized frame buffer, like a driver copying to video memory.
+ * By default the flushed pixels are discarded.
+ * @param disp          a headless display
+ * @param en            true: copy the flushed areas
+ * @return              LV_RESULT_OK: the frame buffer could be allocated (or was freed)
+ */
+lv_result_t lv_headless_display_set_memory_sink(lv_display_t * disp, bool en);
+
+/**
+ * Get the frame buffer of the memory sink to check the rendered image.
+ * @param disp          a headless display
+ * @return              the frame buffer or NULL if the memory sink is disabled
+ */
+lv_draw_buf_t * lv_headless_display_get_memory_sink(lv_display_t * disp);
+
+/**
+ * Set a callback to get the measurements of each frame.
+ * @param disp          a headless display
+ * @param cb            the callback or NULL to remove it
+ * @param user_data     parameter to pass to the callback
+ */
+void lv_headless_display_set_frame_cb(lv_display_t * disp, lv_headless_display_frame_cb_t cb, void * user_data);
+
+/**
+ * Get a monotonic time stamp with microsecond resolution, the time base of the measurements.
+ * @return              the current time in microseconds
+ */
+uint64_t lv_headless_display_get_time_us(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_HEADLESS_DISPLAY */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LV_HEADLESS_DISPLAY_H */
@@ -43,6 +43,20 @@ typedef size_t (*lv_linux_drm_select_mode_cb_t)(lv_display_t * disp,
                                                 const lv_linux_drm_mode_t * modes,
                                                 size_t mode_count);
 
+#if !LV_LINUX_DRM_USE_EGL
+/**
+ * Page flip statistics of a DRM display
+ */
+typedef struct {
+    uint32_t flip_cnt;              /**< Number of completed page flips */
+    uint32_t queued_cnt;            /**< Number of frames rendered while the previous flip was pending */
+    uint32_t missed_vblank_cnt;     /**< Number of vblanks the commits waited in addition to the next one */
+    uint32_t last_latency_us;       /**< Time from the end of rendering until the last frame was flipped */
+    uint32_t avg_latency_us;        /**< Average of the rendering to flip latencies */
+    uint32_t max_latency_us;        /**< Maximum of the rendering to flip latencies */
+} lv_linux_drm_flip_stats_t;
+#endif /*!LV_LINUX_DRM_USE_EGL*/
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -129,6 +143,36 @@ bool lv_linux_drm_mode_is_preferred(const lv_linux_drm_mode_t * mode);
  */
 void * lv_linux_drm_mode_get_raw(const lv_linux_drm_mode_t * mode);
 
+#if !LV_LINUX_DRM_USE_EGL
+/**
+ * Get the file descriptor of the DRM device. It becomes readable when a page flip completes.
+ * @param disp pointer to the display object created with lv_linux_drm_create()
+ * @return the file descriptor, or -1 if no device is opened
+ */
+int lv_linux_drm_get_fd(lv_display_t * disp);
+
+/**
+ * Process the pending events of the DRM device without blocking, e.g. a completed page flip.
+ * Call it when the file descriptor returned by lv_linux_drm_get_fd() is readable.
+ * @param disp pointer to the display object created with lv_linux_drm_create()
+ */
+void lv_linux_drm_handle_events(lv_display_t * disp);
+
+/**
+ * Get the page flip statistics of a display. Only the frames flipped since the
+ * last lv_linux_drm_reset_flip_stats() are considered.
+ * @param disp  pointer to the display object created with lv_linux_drm_create()
+ * @param stats store the statistics here
+ */
+void lv_linux_drm_get_flip_stats(lv_display_t * disp, lv_linux_drm_flip_stats_t * stats);
+
+/**
+ * Clear the page flip statistics of a display.
+ * @param disp pointer to the display object created with lv_linux_drm_create()
+ */
+void lv_linux_drm_reset_flip_stats(lv_display_t * disp);
+#endif /*!LV_LINUX_DRM_USE_EGL*/
+
 /**********************
  *      MACROS
  **********************/
@@ -91,6 +91,14 @@ void lv_evdev_set_swap_axes(lv_indev_t * indev, bool swap_axes);
  */
 void lv_evdev_set_calibration(lv_indev_t * indev, int min_x, int min_y, int max_x, int max_y);
 
+/**
+ * Get the file descriptor of the evdev device. It becomes readable when new input arrives.
+ * Use it to read the device in `LV_INDEV_MODE_EVENT` from an event loop.
+ * @param indev evdev input device
+ * @return the file descriptor
+ */
+int lv_evdev_get_fd(lv_indev_t * indev);
+
 /**
  * Returns the status indicating whether an LV_KEY could not be processed.
  * @param e         pointer to an event
@@ -82,6 +82,14 @@ size_t lv_libinput_find_devs(lv_libinput_capability capabilities, char ** found,
  */
 lv_indev_t * lv_libinput_create(lv_indev_type_t indev_type, const char * dev_path);
 
+/**
+ * Get a file descriptor which becomes readable when the input device has new events.
+ * Use it to read the device in `LV_INDEV_MODE_EVENT` from an event loop.
+ * @param indev pointer to input device
+ * @return the file descriptor (an eventfd)
+ */
+int lv_libinput_get_fd(lv_indev_t * indev);
+
 /**
  * Delete a libinput input device
  * @param indev pointer to input device
@@ -0,0 +1,135 @@
+/**
+ * @file lv_linux_event_loop.h
+ *
+ */
+
+#ifndef LV_LINUX_EVENT_LOOP_H
+#define LV_LINUX_EVENT_LOOP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../display/lv_display.h"
+#include "../../indev/lv_indev.h"
+
+#if LV_USE_LINUX_EVENT_LOOP
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct _lv_linux_event_loop_t lv_linux_event_loop_t;
+
+/**
+ * @param fd         the file descriptor which became ready
+ * @param events     the ready `EPOLL*` events, e.g. `EPOLLIN`
+ * @param user_data  the parameter passed to lv_linux_event_loop_add_fd()
+ */
+typedef void (*lv_linux_event_loop_cb_t)(int fd, uint32_t events, void * user_data);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create an epoll based event loop which drives LVGL. The process sleeps in `epoll_wait`
+ * and wakes up only when an input device or display has an event, or when the next LVGL timer is due.
+ * Only one event loop should exist at a time as it owns the timer handler's resume callback.
+ * @return pointer to the event loop or NULL on failure
+ */
+lv_linux_event_loop_t * lv_linux_event_loop_create(void);
+
+/**
+ * Delete an event loop. The registered file descriptors are not closed.
+ * @param loop pointer to an event loop
+ */
+void lv_linux_event_loop_delete(lv_linux_event_loop_t * loop);
+
+/**
+ * Call a callback whenever a file descriptor becomes ready.
+ * @param loop       pointer to an event loop
+ * @param fd         the file descriptor to watch
+ * @param events     `EPOLL*` events to wait for, e.g. `EPOLLIN`
+ * @param cb         function to call with the ready events
+ * @param user_data  parameter to pass to the callback
+ * @return           LV_RESULT_OK: the file descriptor is watched
+ */
+lv_result_t lv_linux_event_loop_add_fd(lv_linux_event_loop_t * loop, int fd, uint32_t events,
+                                       lv_linux_event_loop_cb_t cb, void * user_data);
+
+/**
+ * Stop watching a file descriptor. Safe to call from any callback of the loop.
+ * @param loop  pointer to an event loop
+ * @param fd    the file descriptor added with lv_linux_event_loop_add_fd()
+ */
+void lv_linux_event_loop_remove_fd(lv_linux_event_loop_t * loop, int fd);
+
+/**
+ * Switch an input device to `LV_INDEV_MODE_EVENT` and read it only when its file descriptor is readable.
+ * The input device is removed from the loop automatically when it's deleted.
+ * @param loop   pointer to an event loop
+ * @param indev  the input device, e.g. created by lv_evdev_create() or lv_libinput_create()
+ * @param fd     the file descriptor signaling new input, e.g. lv_evdev_get_fd() or lv_libinput_get_fd()
+ * @return       LV_RESULT_OK: the input device is driven by the loop
+ */
+lv_result_t lv_linux_event_loop_add_indev(lv_linux_event_loop_t * loop, lv_indev_t * indev, int fd);
+
+#if LV_USE_LINUX_DRM && !LV_LINUX_DRM_USE_EGL
+/**
+ * Handle the page flip events of a DRM display in the loop, so waiting for a flip
+ * doesn't block the process while input or timers are pending.
+ * @param loop  pointer to an event loop
+ * @param disp  a display created by lv_linux_drm_create()
+ * @return      LV_RESULT_OK: the display's events are handled by the loop
+ */
+lv_result_t lv_linux_event_loop_add_drm(lv_linux_event_loop_t * loop, lv_display_t * disp);
+#endif /*LV_USE_LINUX_DRM && !LV_LINUX_DRM_USE_EGL*/
+
+/**
+ * Wait for events up to `timeout_ms`, process them and run the due LVGL timers.
+ * @param loop        pointer to an event loop
+ * @param timeout_ms  the longest time to wait in milliseconds, -1 to wait until an event or timer is due
+ * @return            LV_RESULT_OK: the events were processed; LV_RESULT_INVALID: `epoll_wait` failed
+ */
+lv_result_t lv_linux_event_loop_run_once(lv_linux_event_loop_t * loop, int32_t timeout_ms);
+
+/**
+ * Process events until lv_linux_event_loop_stop() is called.
+ * @param loop  pointer to an event loop
+ */
+void lv_linux_event_loop_run(lv_linux_event_loop_t * loop);
+
+/**
+ * Make lv_linux_event_loop_run() return after processing the current events.
+ * @param loop  pointer to an event loop
+ */
+void lv_linux_event_loop_stop(lv_linux_event_loop_t * loop);
+
+/**
+ * Get the epoll file descriptor of the loop to nest it into another event loop.
+ * It becomes readable when lv_linux_event_loop_run_once() has work to do.
+ * @param loop  pointer to an event loop
+ * @return      the epoll file descriptor
+ */
+int lv_linux_event_loop_get_fd(lv_linux_event_loop_t * loop);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_LINUX_EVENT_LOOP*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_LINUX_EVENT_LOOP_H*/
@@ -29,6 +29,7 @@ typedef struct {
     const char * path; /**< Path to font file*/
     const void * buffer; /**< Address of the font file in the memory*/
     uint32_t buffer_size; /**< Size of the font file buffer*/
+    uint32_t glyph_cache_cnt; /**< If not 0 load `path` with `lv_binfont_create_streaming` and cache this many glyphs*/
 } lv_binfont_font_src_t;
 
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_font_class_t lv_binfont_font_class;
@@ -44,6 +45,18 @@ LV_ATTRIBUTE_EXTERN_DATA extern const lv_font_class_t lv_binfont_font_class;
  */
 lv_font_t * lv_binfont_create(const char * path);
 
+/**
+ * Loads a `lv_font_t` object from a binary font file but doesn't load the glyph bitmaps.
+ * The file is kept open and the bitmaps are read on demand when a glyph is drawn.
+ * If the file system driver can map the file into the memory the bitmaps are read from there,
+ * else the last used bitmaps are cached.
+ * It makes loading large fonts faster and requires much less memory if only a few glyphs are used.
+ * @param path          path to font file
+ * @param cache_cnt     number of glyph bitmaps to keep in the cache (> 0)
+ * @return              pointer to the new font or NULL on error
+ */
+lv_font_t * lv_binfont_create_streaming(const char * path, uint32_t cache_cnt);
+
 #if LV_USE_FS_MEMFS
 /**
  * Loads a `lv_font_t` object from a memory buffer containing the binary font file.
@@ -137,6 +137,27 @@ uint32_t lv_freetype_outline_get_scale(const lv_font_t * font);
  */
 bool lv_freetype_is_outline_font(const lv_font_t * font);
 
+/**
+ * Save the cached glyphs and bitmaps of a font to a glyph atlas file.
+ * Load it with `lv_freetype_font_load_atlas()` after restart to skip rasterizing the glyphs.
+ * Only bitmap fonts are supported.
+ * @note the glyph caches are read without locking, so nothing should be rendered meanwhile
+ * @param font      the FreeType font
+ * @param path      path of the atlas file to write
+ * @return          LV_RESULT_OK: success; LV_RESULT_INVALID: not a bitmap font or write error
+ */
+lv_result_t lv_freetype_font_save_atlas(const lv_font_t * font, const char * path);
+
+/**
+ * Load the glyphs and bitmaps from a glyph atlas file into the caches of a font.
+ * The atlas is used only if it was saved from the same font file with the same size, style and weight.
+ * @param font      the FreeType font
+ * @param path      path of the atlas file
+ * @return          LV_RESULT_OK: success; LV_RESULT_INVALID: the atlas is missing, invalid
+ *                  or belongs to a different font
+ */
+lv_result_t lv_freetype_font_load_atlas(lv_font_t * font, const char * path);
+
 /**********************
  *      MACROS
  **********************/
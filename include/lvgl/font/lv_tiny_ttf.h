@@ -91,6 +91,26 @@ lv_font_t * lv_tiny_ttf_create_data_ex(const void * data, size_t data_size, int3
  */
 void lv_tiny_ttf_set_size(lv_font_t * font, int32_t font_size);
 
+/**
+ * Save the cached glyphs and their bitmaps to a glyph atlas file.
+ * Load it with `lv_tiny_ttf_load_atlas()` after restart to skip rasterizing the glyphs.
+ * @note the glyph caches are read without locking, so nothing should be rendered meanwhile
+ * @param font        the font object
+ * @param path        path of the atlas file to write
+ * @return            LV_RESULT_OK: success; LV_RESULT_INVALID: the font has no cache or a write error
+ */
+lv_result_t lv_tiny_ttf_save_atlas(const lv_font_t * font, const char * path);
+
+/**
+ * Load the glyphs and their bitmaps from a glyph atlas file into the font's caches.
+ * The atlas is used only if it was saved from the same font file with the same size.
+ * @param font        the font object
+ * @param path        path of the atlas file
+ * @return            LV_RESULT_OK: success; LV_RESULT_INVALID: the atlas is missing, invalid
+ *                    or belongs to a different font
+ */
+lv_result_t lv_tiny_ttf_load_atlas(lv_font_t * font, const char * path);
+
 /**
  * Destroy a font previously created with lv_tiny_ttf_create_xxxx()
  * @param font        the font object
@@ -81,6 +81,10 @@ struct _lv_fs_drv_t {
     lv_fs_res_t (*seek_cb)(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
     lv_fs_res_t (*tell_cb)(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
 
+    /*Optional. Map `len` bytes from `offset` into the memory for reading. Return NULL on error.*/
+    const void * (*mmap_cb)(lv_fs_drv_t * drv, void * file_p, uint32_t offset, uint32_t len);
+    lv_fs_res_t (*munmap_cb)(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t len);
+
     void * (*dir_open_cb)(lv_fs_drv_t * drv, const char * path);
     lv_fs_res_t (*dir_read_cb)(lv_fs_drv_t * drv, void * rddir_p, char * fn, uint32_t fn_len);
     lv_fs_res_t (*dir_close_cb)(lv_fs_drv_t * drv, void * rddir_p);
@@ -231,6 +235,27 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
  */
 lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos);
 
+/**
+ * Map a part of a file into the memory so that it can be read without copying.
+ * The read/write position of the file is not affected.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param offset    offset of the first byte to map from the start of the file
+ * @param len       number of bytes to map
+ * @param buf       pointer to store the address of the mapped data. The data must not be written.
+ * @return          LV_FS_RES_OK, LV_FS_RES_NOT_IMP if the driver can't map files,
+ *                  or any error from `lv_fs_res_t`
+ */
+lv_fs_res_t lv_fs_mmap(lv_fs_file_t * file_p, uint32_t offset, uint32_t len, const void ** buf);
+
+/**
+ * Unmap the data mapped by `lv_fs_mmap`. It needs to be called before closing the file.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param buf       the address returned by `lv_fs_mmap`
+ * @param len       the same length which was passed to `lv_fs_mmap`
+ * @return          LV_FS_RES_OK or any error from `lv_fs_res_t`
+ */
+lv_fs_res_t lv_fs_munmap(lv_fs_file_t * file_p, const void * buf, uint32_t len);
+
 /**
  * Get the size in bytes of an open file.
  * The file read/write position will not be affected.
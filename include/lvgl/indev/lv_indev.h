@@ -144,6 +144,29 @@ void lv_indev_set_type(lv_indev_t * indev, lv_indev_type_t indev_type);
  */
 void lv_indev_set_read_cb(lv_indev_t * indev,  lv_indev_read_cb_t read_cb);
 
+/**
+ * Buffer the samples pushed with `lv_indev_push_sample()`.
+ * The samples collected until the next read are coalesced: consecutive samples
+ * with the same state are processed once with the last position, while all of them
+ * are used to estimate the velocity. This way a 120 Hz touch controller causes
+ * only one scroll step and invalidation per read but no samples are lost.
+ * @param indev     pointer to an input device
+ * @param cnt       number of samples to buffer, 0 to disable buffering
+ * @return          LV_RESULT_OK: the buffer could be allocated (or was freed)
+ */
+lv_result_t lv_indev_set_sample_buffer_size(lv_indev_t * indev, uint32_t cnt);
+
+/**
+ * Push a timestamped sample of the input device. It should be called from the read callback
+ * for each report of the hardware, e.g. on every `SYN_REPORT` of evdev.
+ * If samples were pushed, the data set in the read callback is ignored in that read.
+ * If the buffer is full the oldest sample is dropped.
+ * @param indev     pointer to an input device
+ * @param data      the sample. If `timestamp` is 0 the current tick is used.
+ * @return          LV_RESULT_INVALID: buffering is not enabled
+ */
+lv_result_t lv_indev_push_sample(lv_indev_t * indev, const lv_indev_data_t * data);
+
 /**
  * Set user data to the indev
  * @param indev pointer to an input device
@@ -374,6 +397,14 @@ lv_obj_t * lv_indev_get_scroll_obj(const lv_indev_t * indev);
  */
 void lv_indev_get_vect(const lv_indev_t * indev, lv_point_t * point);
 
+/**
+ * Get the velocity of an input device (for LV_INDEV_TYPE_POINTER and
+ * LV_INDEV_TYPE_BUTTON) estimated from the timestamps of the recent samples
+ * @param indev     pointer to an input device
+ * @param velocity  store the velocity here in pixels per second
+ */
+void lv_indev_get_velocity(const lv_indev_t * indev, lv_point_t * velocity);
+
 /**
  * Get the cursor object of an input device (for LV_INDEV_TYPE_POINTER only)
  * @param indev pointer to an input device
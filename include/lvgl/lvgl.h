@@ -76,6 +76,7 @@
 #include "drivers/display/lv_draw_eve_target.h"
 #include "drivers/display/lv_linux_fbdev.h"
 #include "drivers/display/lv_ft81x.h"
+#include "drivers/display/lv_headless_display.h"
 #include "drivers/display/lv_ili9341.h"
 #include "drivers/display/lv_lcd_generic_mipi.h"
 #include "drivers/display/lv_lovyan_gfx.h"
@@ -90,6 +91,7 @@
 #include "drivers/indev/lv_evdev.h"
 #include "drivers/indev/lv_libinput.h"
 #include "drivers/indev/lv_xkb.h"
+#include "drivers/linux/lv_linux_event_loop.h"
 #include "drivers/nuttx/lv_nuttx_entry.h"
 #include "drivers/nuttx/lv_nuttx_fbdev.h"
 #include "drivers/nuttx/lv_nuttx_lcd.h"
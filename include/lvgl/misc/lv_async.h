@@ -50,6 +50,36 @@ lv_result_t lv_async_call(lv_async_cb_t async_xcb, void * user_data);
  */
 lv_result_t lv_async_call_cancel(lv_async_cb_t async_xcb, void * user_data);
 
+#if LV_ASYNC_QUEUE_SIZE > 0
+
+/**
+ * Queue a function to be called at the beginning of the next lv_timer_handler().
+ * Unlike lv_async_call() it doesn't allocate memory and doesn't need lv_lock(),
+ * so it can be called from any thread or interrupt.
+ * The functions are called in the order they were posted.
+ * Cancel it with lv_async_call_cancel().
+ * @param async_xcb     the function to call
+ * @param user_data     custom parameter
+ * @return              LV_RESULT_OK: queued; LV_RESULT_INVALID: the queue is full (see `LV_ASYNC_QUEUE_SIZE`)
+ */
+lv_result_t lv_async_post(lv_async_cb_t async_xcb, void * user_data);
+
+#if LV_USE_OBSERVER
+/**
+ * Set the value of an integer Subject from any thread or interrupt.
+ * The Subject is set with lv_subject_set_int() in the next lv_timer_handler().
+ * If the Subject is set again before that, only the latest value is used
+ * and the Observers are notified only once.
+ * @param subject   pointer to an integer Subject
+ * @param value     new value
+ * @return          LV_RESULT_OK: queued or merged into a queued update;
+ *                  LV_RESULT_INVALID: the queue is full
+ */
+lv_result_t lv_async_subject_set_int(lv_subject_t * subject, int32_t value);
+#endif
+
+#endif /*LV_ASYNC_QUEUE_SIZE > 0*/
+
 /**********************
  *      MACROS
  **********************/
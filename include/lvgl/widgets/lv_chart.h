@@ -131,6 +131,18 @@ void lv_chart_set_axis_max_value(lv_obj_t * obj, lv_chart_axis_t axis, int32_t m
  */
 void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode);
 
+/**
+ * Keep the rendered line series in a bitmap in `LV_CHART_UPDATE_MODE_SHIFT`.
+ * When new values are added, the bitmap is shifted and only the new points are rendered.
+ * The bitmap takes the size of the chart (with the extra draw size) x 4 bytes.
+ * @param obj       pointer to a chart object
+ * @param en        true: enable shift blitting
+ * @note            It's used only for `LV_CHART_TYPE_LINE` and if all the visible
+ *                  series are shifted by the same whole number of pixels.
+ *                  Otherwise the whole bitmap is rendered again.
+ */
+void lv_chart_set_shift_blit(lv_obj_t * obj, bool en);
+
 /**
  * Set the number of horizontal and vertical division lines
  * @param obj       pointer to a chart object
@@ -174,6 +186,13 @@ uint32_t lv_chart_get_point_count(const lv_obj_t * obj);
  */
 lv_chart_update_mode_t lv_chart_get_update_mode(const lv_obj_t * obj);
 
+/**
+ * Get whether shift blitting is enabled
+ * @param obj       pointer to a chart object
+ * @return          true: shift blitting is enabled
+ */
+bool lv_chart_get_shift_blit(const lv_obj_t * obj);
+
 /**
  * Get the number of horizontal division lines
  * @param obj       pointer to a chart object
@@ -175,6 +175,12 @@
  */
 #define LV_DRAW_LAYER_MAX_MEMORY 0
 
+/** Limit for the bitmaps of the widgets rendered with `lv_obj_set_retained_layer()`; 0 disables them.
+ *  Each bitmap takes width x height x 4 bytes (with the extra draw size).
+ *  If a bitmap doesn't fit, the widget is rendered normally.
+ */
+#define LV_DRAW_LAYER_RETAINED_MAX_MEMORY 262144
+
 #if LV_USE_OS != LV_OS_NONE
 /** If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more. */
 #define LV_DRAW_THREAD_STACK_SIZE 8192
@@ -279,12 +285,29 @@
 /** Adds linear gradients at an angle, plus radial and conical gradients. */
 #define LV_USE_DRAW_SW_COMPLEX_GRADIENTS 0
 
+/** The color maps of the gradients are kept in an LRU cache shared by all SW
+ *  draw units, so widgets with the same gradient don't calculate it again.
+ *  Set to 0 to disable caching.
+ */
+#define LV_DRAW_SW_GRAD_CACHE_CNT 8
+
 #if LV_DRAW_SW_COMPLEX
 /** Maximum shadow size to buffer, where shadow size is `shadow_width + radius`.
- *  Costs this value squared in RAM; 0 disables caching.
+ *  Each cached shadow costs at most this value squared in RAM; 0 disables caching.
  */
 #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
 
+#endif /*LV_DRAW_SW_COMPLEX*/
+
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
+/** Blurred shadow corners of different shapes (size, radius, spread and width)
+ *  are kept in an LRU cache shared by all SW draw units.
+ */
+#define LV_DRAW_SW_SHADOW_CACHE_CNT 8
+
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE > 0*/
+
+#if LV_DRAW_SW_COMPLEX
 /** The circumference of a 1/4 circle is cached for anti-aliasing, costing
  *  radius * 4 bytes per circle. Set to 0 to disable caching.
  */
@@ -681,6 +704,12 @@
 /** Bind widgets to subject variables so they update automatically when the value changes. */
 #define LV_USE_OBSERVER 1
 
+/** Number of calls and subject updates which can wait in the queue of lv_async_post()
+ *  and lv_async_subject_set_int(). These can be called from any thread or interrupt
+ *  without lv_lock(). Must be a power of 2. 0: disable the queue.
+ */
+#define LV_ASYNC_QUEUE_SIZE 0
+
 /** Look up strings by ID for the selected language with lv_translation_get(). */
 #define LV_USE_TRANSLATION 0
 
@@ -800,6 +829,18 @@
  */
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/** The image and image header caches find their entries in a hash table
+ *  instead of a red-black tree. Lookups are O(1) and file paths are only
+ *  compared on hash match, which pays off with many cached images.
+ */
+#define LV_IMAGE_CACHE_USE_HASH_TABLE 0
+
+/** The sharded cache classes split their entries into this many
+ *  independently locked partitions, so that threads looking up
+ *  different keys don't wait for each other.
+ */
+#define LV_CACHE_SHARD_CNT 4
+
 /** Decoder for LVGL's run-length encoded binary image format. */
 #define LV_USE_RLE 0
 
@@ -846,6 +887,12 @@
 /** SVG debug logs */
 #define LV_USE_SVG_DEBUG 0
 
+/** SVG images are kept rendered as ARGB8888 bitmaps at the size and
+ *  transformation they were drawn, so static icons are drawn from the
+ *  bitmap after the first rendering. Set to 0 to always draw the vectors.
+ */
+#define LV_SVG_RASTER_CACHE_CNT 0
+
 #endif /*LV_USE_SVG*/
 
 
@@ -1465,6 +1512,13 @@
  */
 #define LV_LINUX_DRM_BACKEND LV_LINUX_DRM_BACKEND_FBDEV
 
+#if !LV_LINUX_DRM_USE_EGL
+/** Number of scanout buffers used without EGL. With 3 buffers the next frame
+ *  can be rendered while the previous one is waiting for the vblank.
+ */
+#define LV_LINUX_DRM_BUFFER_COUNT 2
+
+#endif /*!LV_LINUX_DRM_USE_EGL*/
 #endif /*LV_USE_LINUX_DRM*/
 
 /** Driver for /dev/fb */
@@ -1498,6 +1552,9 @@
 /** Driver for FT81X EVE graphics controllers connected over SPI. */
 #define LV_USE_FT81X 0
 
+/** Display without a screen measuring the rendering time, e.g. for benchmarks on POSIX hosts. */
+#define LV_USE_HEADLESS_DISPLAY 0
+
 /** Display and touch driver built on the LovyanGFX C++ library, which must be available in the build. */
 #define LV_USE_LOVYAN_GFX 0
 
@@ -1605,6 +1662,9 @@
 #endif /*LV_LIBINPUT_XKB*/
 #endif /*LV_USE_LIBINPUT*/
 
+/** Drive LVGL from an epoll event loop which sleeps until input, a DRM page flip or the next timer is due. */
+#define LV_USE_LINUX_EVENT_LOOP 0
+
 /** Display and input drivers for NuttX, including the /dev/fb framebuffer device. */
 #define LV_USE_NUTTX 0
 
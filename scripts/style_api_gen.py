@@ -404,7 +404,7 @@ props = [
 
 {'name': 'BLUR_QUALITY',
  'style_type': 'num',   'var_type': 'lv_blur_quality_t',  'default':'`LV_BLUR_QUALITY_AUTO`', 'inherited': 0, 'layout': 0, 'ext_draw': 0,
- 'dsc': "Setting to `LV_BLUR_QUALITY_SPEED` the blurring algorithm will prefer speed over quality. `LV_BLUR_QUALITY_PRECISION` will force using higher quality but slower blur. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically."},
+ 'dsc': "Setting to `LV_BLUR_QUALITY_SPEED` the blurring algorithm will prefer speed over quality. `LV_BLUR_QUALITY_PRECISION` will force using higher quality but slower blur. `LV_BLUR_QUALITY_PYRAMID` blurs a downscaled copy which is the fastest on large radii. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically."},
 
 {'section': 'Drop Shadow', 'dsc':'Take an A8 snapshot of the given part and blur it.',
  'example': 'lv_example_style_drop_shadow', 'example_path': 'styles/lv_example_style_drop_shadow', 'example_kind': 'c' },
@@ -431,7 +431,7 @@ props = [
 
 {'name': 'DROP_SHADOW_QUALITY',
  'style_type': 'num',   'var_type': 'lv_blur_quality_t',  'default':'`LV_BLUR_QUALITY_PRECISION`', 'inherited': 0, 'layout': 0, 'ext_draw': 0,
- 'dsc': "Setting to `LV_BLUR_QUALITY_SPEED` the blurring algorithm will prefer speed over quality. `LV_BLUR_QUALITY_PRECISION` will force using higher quality but slower blur. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically."},
+ 'dsc': "Setting to `LV_BLUR_QUALITY_SPEED` the blurring algorithm will prefer speed over quality. `LV_BLUR_QUALITY_PRECISION` will force using higher quality but slower blur. `LV_BLUR_QUALITY_PYRAMID` blurs a downscaled copy which is the fastest on large radii. With `LV_BLUR_QUALITY_AUTO` the quality will be selected automatically."},
 
 {'section': 'Miscellaneous', 'dsc':'Mixed properties for various purposes.',
  'example': 'lv_example_style_opacity_transform', 'example_path': 'styles/style_opacity_transform/lv_example_style_opacity_transform', 'example_kind': 'xml' },
@@ -27,6 +27,7 @@ extern "C" {
 
 #include "../misc/lv_timer_private.h"
 #include "../misc/lv_anim_private.h"
+#include "../misc/lv_async_private.h"
 #include "../tick/lv_tick_private.h"
 #include "../draw/lv_draw_buf_private.h"
 #include "../draw/lv_draw_private.h"
@@ -77,6 +78,7 @@ typedef struct _lv_global_t {
     lv_ll_t disp_ll;
     lv_display_t * disp_refresh;
     lv_display_t * disp_default;
+    uint32_t retained_layer_memory;     /**< Bytes used by the retained layers of the widgets */
 
     lv_ll_t style_trans_ll;
     bool style_refresh;
@@ -103,6 +105,9 @@ typedef struct _lv_global_t {
 
     lv_timer_state_t timer_state;
     lv_anim_state_t anim_state;
+#if LV_ASYNC_QUEUE_SIZE > 0
+    lv_async_state_t async_state;
+#endif
     lv_tick_state_t tick_state;
 
     lv_draw_buf_handlers_t draw_buf_handlers;
@@ -122,7 +127,10 @@ typedef struct _lv_global_t {
     lv_draw_global_info_t draw_info;
     lv_ll_t draw_sw_blend_handler_ll;
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    lv_draw_sw_shadow_cache_t sw_shadow_cache;
+    lv_cache_t * sw_shadow_cache;
+#endif
+#if LV_USE_DRAW_SW && defined(LV_DRAW_SW_GRAD_CACHE_CNT) && LV_DRAW_SW_GRAD_CACHE_CNT > 0
+    lv_cache_t * sw_grad_cache;
 #endif
 #if LV_DRAW_SW_COMPLEX
     lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
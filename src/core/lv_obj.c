@@ -16,6 +16,7 @@
 #include "../indev/lv_indev_private.h"
 #include "../display/lv_display_private.h"
 #include "lv_obj_draw_private.h"
+#include "lv_refr_private.h"
 
 /*********************
  *      DEFINES
@@ -689,6 +690,19 @@ void lv_obj_set_overflow_visible(lv_obj_t * obj, bool en)
     obj->overflow_visible = en;
 }
 
+void lv_obj_set_retained_layer(lv_obj_t * obj, bool en)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return);
+
+    if(lv_obj_is_retained_layer(obj) == en) return;
+    if(obj->spec_attr == NULL && !lv_obj_allocate_spec_attr(obj)) return;
+
+    if(!en) lv_refr_free_retained_layer(obj);
+    obj->spec_attr->layer_retained = en;
+    lv_obj_update_layer_type(obj);
+    lv_obj_invalidate(obj);
+}
+
 void lv_obj_set_event_trickle(lv_obj_t * obj, bool en)
 {
     LV_CHECK_OBJ(obj, MY_CLASS, return);
@@ -979,6 +993,12 @@ bool lv_obj_is_overflow_visible(const lv_obj_t * obj)
     return obj->overflow_visible;
 }
 
+bool lv_obj_is_retained_layer(const lv_obj_t * obj)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return false);
+    return obj->spec_attr ? obj->spec_attr->layer_retained : false;
+}
+
 bool lv_obj_is_event_trickle(const lv_obj_t * obj)
 {
     LV_CHECK_OBJ(obj, MY_CLASS, return false);
@@ -1368,6 +1388,7 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
         }
 
         lv_event_remove_all(&obj->spec_attr->event_list);
+        lv_refr_free_retained_layer(obj);
 #if LV_USE_OBJ_NAME
         if(obj->spec_attr->name && !obj->spec_attr->name_static) {
             lv_free((void *)obj->spec_attr->name);
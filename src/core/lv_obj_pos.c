@@ -1069,6 +1069,9 @@ lv_result_t lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
     LV_CHECK_ARG(area != NULL, return LV_RESULT_INVALID);
     LV_CHECK_OBJ(obj, MY_CLASS, return LV_RESULT_INVALID);
 
+    /*Outdate the retained layers even if the invalidation is disabled as the content has changed*/
+    lv_refr_invalidate_retained_layers(obj);
+
     lv_display_t * disp   = lv_obj_get_display(obj);
     if(!lv_display_is_invalidation_enabled(disp)) return LV_RESULT_INVALID;
 
@@ -1083,6 +1086,8 @@ lv_result_t lv_obj_invalidate(const lv_obj_t * obj)
 {
     LV_CHECK_OBJ(obj, MY_CLASS, return LV_RESULT_INVALID);
 
+    lv_refr_invalidate_retained_layers(obj);
+
     lv_display_t * disp = lv_obj_get_display(obj);
     if(!lv_display_is_invalidation_enabled(disp)) return LV_RESULT_INVALID;
 
@@ -39,6 +39,7 @@ typedef struct _lv_obj_spec_attr_t {
     const char * name;              /**< Pointer to the name */
 #endif
     lv_point_t scroll;              /**< The current X/Y scroll offset*/
+    lv_draw_buf_t * layer_cache;    /**< The retained bitmap of the widget if `layer_retained` is set*/
 
     int32_t ext_click_pad;          /**< Extra click padding in all direction*/
     int32_t ext_draw_size;          /**< EXTend the size in every direction for drawing.*/
@@ -50,6 +51,8 @@ typedef struct _lv_obj_spec_attr_t {
     uint16_t scroll_dir : 4;        /**< The allowed scroll direction(s), see `lv_dir_t`*/
     uint16_t layer_type : 2;        /**< Cache the layer type here. Element of lv_intermediate_layer_type_t */
     uint16_t name_static : 1;       /**< 1: `name` was not dynamically allocated */
+    uint16_t layer_retained : 1;    /**< 1: keep the rendered widget in `layer_cache`*/
+    uint16_t layer_cache_outdated : 1; /**< 1: `layer_cache` needs to be rendered again*/
     uint16_t user_flags : 8;         /**< Store custom flags */
 } lv_obj_spec_attr_t;
 
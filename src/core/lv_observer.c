@@ -13,6 +13,7 @@
 #include "../lvgl_public.h"
 #include "../core/lv_obj_private.h"
 #include "../misc/lv_event_private.h"
+#include "../misc/lv_async_private.h"
 /*********************
  *      DEFINES
  *********************/
@@ -403,6 +404,10 @@ void lv_subject_deinit(lv_subject_t * subject)
 {
     LV_CHECK_ARG(subject != NULL, return);
 
+#if LV_ASYNC_QUEUE_SIZE > 0
+    lv_async_core_cancel_subject(subject);
+#endif
+
     lv_observer_t * observer = lv_ll_get_head(&subject->subs_ll);
     while(observer) {
         lv_observer_t * observer_next = lv_ll_get_next(&subject->subs_ll, observer);
@@ -12,8 +12,11 @@
 #include "../draw/sw/lv_draw_sw_mask_private.h"
 #include "lv_obj_private.h"
 #include "lv_obj_event_private.h"
+#include "lv_obj_class_private.h"
+#include "../misc/lv_event_private.h"
 #include "../display/lv_display_private.h"
 #include "../misc/lv_timer_private.h"
+#include "../misc/lv_anim_private.h"
 #include "../draw/lv_draw_private.h"
 #include "../draw/opengles/lv_draw_opengles.h"
 #include "lv_global.h"
@@ -35,7 +38,12 @@
  **********************/
 static void lv_refr_join_area(void);
 static void refr_invalid_areas(void);
+static void refr_check_frame_budget(bool rendered);
 static void refr_sync_areas(void);
+static void refr_scroll_blit(void);
+static bool scroll_blit_is_safe(lv_display_t * disp, lv_obj_t * obj);
+static bool scroll_blit_is_covered(lv_obj_t * obj, const lv_area_t * area);
+static bool scroll_blit_get_area(lv_obj_t * obj, lv_area_t * area);
 static void refr_area(const lv_area_t * area_p, int32_t y_offset);
 static void refr_configured_layer(lv_layer_t * layer);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
@@ -48,6 +56,10 @@ static void wait_for_syncing(lv_display_t * disp);
 static lv_result_t layer_get_area(lv_layer_t * layer, lv_obj_t * obj, lv_layer_type_t layer_type,
                                   lv_area_t * layer_area_out, lv_area_t * obj_draw_size_out);
 static bool alpha_test_area_on_obj(lv_obj_t * obj, const lv_area_t * area);
+static bool refr_obj_retained(lv_layer_t * layer, lv_obj_t * obj, lv_opa_t opa_layered, lv_opa_t opa_parent,
+                              lv_color32_t recolor_parent);
+static lv_draw_buf_t * retained_layer_create(lv_obj_t * obj, const lv_area_t * area);
+static lv_layer_type_t retained_get_fallback_layer_type(lv_obj_t * obj);
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     static bool refr_check_obj_clip_overflow(lv_layer_t * layer, lv_obj_t * obj);
     static void refr_obj_matrix(lv_layer_t * layer, lv_obj_t * obj);
@@ -288,6 +300,7 @@ lv_result_t lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
         disp->inv_p = 0;
+        disp->scroll_blit_pending = 0;
         return LV_RESULT_OK;
     }
 
@@ -341,6 +354,57 @@ lv_result_t lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     return LV_RESULT_OK;
 }
 
+lv_result_t lv_refr_scroll_blit(lv_obj_t * obj, int32_t dx, int32_t dy)
+{
+    lv_display_t * disp = lv_obj_get_display(obj);
+    if(disp == NULL || !scroll_blit_is_safe(disp, obj)) return LV_RESULT_INVALID;
+
+    lv_area_t area;
+    if(!scroll_blit_get_area(obj, &area)) return LV_RESULT_INVALID;
+    if(LV_ABS(dx) >= lv_area_get_width(&area) || LV_ABS(dy) >= lv_area_get_height(&area)) return LV_RESULT_INVALID;
+
+    /*Only one area can be moved in a refresh*/
+    if(disp->scroll_blit_pending && !lv_area_is_equal(&area, &disp->scroll_blit_area)) return LV_RESULT_INVALID;
+
+    /*The areas invalidated earlier are moved with the pixels, so invalidate their new position too.
+     *Nothing to gain if the whole area is redrawn anyway.*/
+    uint32_t inv_p = disp->inv_p;
+    uint32_t i;
+    for(i = 0; i < inv_p; i++) {
+        if(lv_area_is_in(&area, &disp->inv_areas[i], 0)) return LV_RESULT_INVALID;
+    }
+
+    for(i = 0; i < inv_p; i++) {
+        lv_area_t moved = disp->inv_areas[i];
+        lv_area_move(&moved, dx, dy);
+        if(lv_area_intersect(&moved, &moved, &area)) lv_inv_area(disp, &moved);
+    }
+
+    disp->scroll_blit_area = area;
+    disp->scroll_blit_ofs.x = (disp->scroll_blit_pending ? disp->scroll_blit_ofs.x : 0) + dx;
+    disp->scroll_blit_ofs.y = (disp->scroll_blit_pending ? disp->scroll_blit_ofs.y : 0) + dy;
+    disp->scroll_blit_pending = 1;
+
+    /*Redraw the parts of the widget which don't move (border, scrollbars, rounded corners)*/
+    lv_area_t fixed[4];
+    int32_t fixed_cnt = lv_area_diff(fixed, &obj->coords, &area);
+    int32_t j;
+    for(j = 0; j < fixed_cnt; j++) lv_obj_invalidate_area(obj, &fixed[j]);
+
+    /*Redraw the newly exposed strips*/
+    lv_area_t strip = area;
+    if(dx > 0) strip.x2 = area.x1 + dx - 1;
+    else if(dx < 0) strip.x1 = area.x2 + dx + 1;
+    if(dx) lv_inv_area(disp, &strip);
+
+    strip = area;
+    if(dy > 0) strip.y2 = area.y1 + dy - 1;
+    else if(dy < 0) strip.y1 = area.y2 + dy + 1;
+    if(dy) lv_inv_area(disp, &strip);
+
+    return LV_RESULT_OK;
+}
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -368,8 +432,11 @@ void lv_display_refr_timer(lv_timer_t * tmr)
         disp_refr = tmr->user_data;
         /* Ensure the timer does not run again automatically.
          * This is done before refreshing in case refreshing invalidates something else.
-         * However if the performance monitor is enabled keep the timer running to count the FPS.*/
-#if !LV_USE_PERF_MONITOR
+         * However if the performance monitor is enabled keep the timer running to count the FPS,
+         * unless the vsyncs start the refreshing.*/
+#if LV_USE_PERF_MONITOR
+        if(disp_refr && disp_refr->vsync_paced) lv_timer_pause(tmr);
+#else
         lv_timer_pause(tmr);
 #endif
     }
@@ -390,6 +457,11 @@ void lv_display_refr_timer(lv_timer_t * tmr)
         return;
     }
 
+    /*A paced frame starts at the vsync which has triggered it*/
+    if(!disp_refr->frame_start_at_vsync) disp_refr->frame_start = lv_tick_get();
+    disp_refr->frame_start_at_vsync = 0;
+    bool rendered = false;
+
     lv_result_t res = lv_display_send_event(disp_refr, LV_EVENT_REFR_START, NULL);
     if(res == LV_RESULT_INVALID) {
         LV_TRACE_REFR("deleted");
@@ -416,9 +488,12 @@ void lv_display_refr_timer(lv_timer_t * tmr)
 
     lv_refr_join_area();
     refr_sync_areas();
+    refr_scroll_blit();
     refr_invalid_areas();
 
     if(disp_refr->inv_p == 0) goto refr_finish;
+    rendered = true;
+
     /*In double buffered direct mode or if sync callback is set, save the updated areas.
      *They will be used on the next call to synchronize the buffers.*/
     if((lv_display_is_double_buffered(disp_refr) && disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) ||
@@ -438,11 +513,14 @@ void lv_display_refr_timer(lv_timer_t * tmr)
     disp_refr->inv_p = 0;
 
 refr_finish:
+    disp_refr->scroll_blit_pending = 0;
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_cleanup();
 #endif
 
+    refr_check_frame_budget(rendered);
+
     lv_display_send_event(disp_refr, LV_EVENT_REFR_READY, NULL);
 
     LV_TRACE_REFR("finished");
@@ -518,7 +596,15 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
     layer->recolor = lv_obj_style_apply_recolor(obj, LV_PART_MAIN, layer->recolor);
 
     lv_layer_type_t layer_type = lv_obj_get_layer_type(obj);
-    if(layer_type == LV_LAYER_TYPE_NONE) {
+    /*If the retained bitmap can't be used render the widget as if it weren't retained*/
+    if(layer_type == LV_LAYER_TYPE_RETAINED && !refr_obj_retained(layer, obj, opa_layered, layer_opa_ori, layer_recolor)) {
+        layer_type = retained_get_fallback_layer_type(obj);
+    }
+
+    if(layer_type == LV_LAYER_TYPE_RETAINED) {
+        /*Already drawn from the retained bitmap*/
+    }
+    else if(layer_type == LV_LAYER_TYPE_NONE) {
         lv_obj_redraw(layer, obj);
     }
 #if LV_DRAW_TRANSFORM_USE_MATRIX
@@ -613,6 +699,38 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
     layer->recolor = layer_recolor;
 }
 
+void lv_refr_invalidate_retained_layers(const lv_obj_t * obj)
+{
+    /*Nothing to do if no widget has a retained bitmap*/
+    if(LV_GLOBAL_DEFAULT()->retained_layer_memory == 0) return;
+
+    while(obj) {
+        if(obj->spec_attr && obj->spec_attr->layer_cache) {
+            /*During rendering the draw tasks might still use the bitmap so free it only
+             *when the widget is drawn again*/
+            if(disp_refr && disp_refr->rendering_in_progress) obj->spec_attr->layer_cache_outdated = 1;
+            else lv_refr_free_retained_layer((lv_obj_t *)obj);
+        }
+        obj = obj->parent;
+    }
+}
+
+void lv_refr_free_retained_layer(lv_obj_t * obj)
+{
+    LV_CHECK_ARG(obj != NULL, return);
+
+    if(obj->spec_attr == NULL || obj->spec_attr->layer_cache == NULL) return;
+
+    lv_draw_buf_t * draw_buf = obj->spec_attr->layer_cache;
+    uint32_t * used = &LV_GLOBAL_DEFAULT()->retained_layer_memory;
+    *used = *used >= draw_buf->data_size ? *used - draw_buf->data_size : 0;
+
+    lv_image_cache_drop(draw_buf);
+    lv_draw_buf_destroy(draw_buf);
+    obj->spec_attr->layer_cache = NULL;
+    obj->spec_attr->layer_cache_outdated = 0;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -775,6 +893,207 @@ static void refr_sync_areas(void)
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Move the pixels of the scrolled area before rendering the invalidated areas
+ */
+static void refr_scroll_blit(void)
+{
+    if(!disp_refr->scroll_blit_pending) return;
+    disp_refr->scroll_blit_pending = 0;
+
+    /*Skip it if the area is redrawn anyway*/
+    uint32_t i;
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(disp_refr->inv_area_joined[i]) continue;
+        if(lv_area_is_in(&disp_refr->scroll_blit_area, &disp_refr->inv_areas[i], 0)) return;
+    }
+
+    int32_t dx = disp_refr->scroll_blit_ofs.x;
+    int32_t dy = disp_refr->scroll_blit_ofs.y;
+
+    /*The pixels which stay in the area*/
+    lv_area_t src_area = disp_refr->scroll_blit_area;
+    lv_area_move(&src_area, -dx, -dy);
+    if(!lv_area_intersect(&src_area, &src_area, &disp_refr->scroll_blit_area)) return;
+    lv_area_t dest_area = src_area;
+    lv_area_move(&dest_area, dx, dy);
+
+    LV_PROFILER_REFR_BEGIN;
+    wait_for_flushing(disp_refr);
+
+    /*In double buffered mode the other buffer has the last frame*/
+    lv_draw_buf_t * dest_buf = disp_refr->buf_act;
+    lv_draw_buf_t * src_buf = dest_buf;
+    if(lv_display_is_double_buffered(disp_refr)) {
+        src_buf = dest_buf == disp_refr->buf_1 ? disp_refr->buf_2 : disp_refr->buf_1;
+    }
+
+    uint32_t line_size = lv_area_get_width(&dest_area) * lv_color_format_get_size(disp_refr->color_format);
+    int32_t h = lv_area_get_height(&dest_area);
+
+    /*Start from the end which is overwritten first to handle the overlap*/
+    int32_t y;
+    for(i = 0; i < (uint32_t)h; i++) {
+        y = dy > 0 ? h - 1 - (int32_t)i : (int32_t)i;
+        uint8_t * dest = lv_draw_buf_goto_xy(dest_buf, dest_area.x1, dest_area.y1 + y);
+        const uint8_t * src = lv_draw_buf_goto_xy(src_buf, src_area.x1, src_area.y1 + y);
+        lv_memmove(dest, src, line_size);
+    }
+
+    /*Flush the moved pixels and synchronize them to the other buffer in the next refresh*/
+    disp_refr->refreshed_area = dest_area;
+    disp_refr->last_area = 0;
+    disp_refr->last_part = 0;
+    draw_buf_flush(disp_refr);
+
+    if(lv_display_is_double_buffered(disp_refr)) {
+        lv_area_t * sync_area = lv_ll_ins_tail(&disp_refr->sync_areas);
+        if(sync_area) *sync_area = dest_area;
+    }
+
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Check if the rendered pixels of a scrolled widget can be moved
+ * @param disp  the display of the widget
+ * @param obj   the scrolled widget
+ * @return      true: the pixels will look the same after moving them
+ */
+static bool scroll_blit_is_safe(lv_display_t * disp, lv_obj_t * obj)
+{
+#if defined(LV_COLOR_16_SWAP) && LV_COLOR_16_SWAP
+    /*The pixels are swapped in the draw buffer on flush*/
+    LV_UNUSED(disp);
+    LV_UNUSED(obj);
+    return false;
+#else
+    if(!disp->scroll_blit_en) return false;
+
+    /*The draw buffer needs to keep the last frame at the same place*/
+    if(disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT) return false;
+    if(disp->buf_3 || disp->sync_cb) return false;
+    if(lv_display_get_rotation(disp) != LV_DISPLAY_ROTATION_0) return false;
+    if(lv_color_format_get_bpp(disp->color_format) < 8) return false;
+    if(disp->prev_scr || lv_obj_get_screen(obj) != disp->act_scr) return false;
+    if(!lv_display_is_invalidation_enabled(disp)) return false;
+
+    /*The background needs to cover the moved pixels but not move with them*/
+    if(lv_obj_is_overflow_visible(obj)) return false;
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) < LV_OPA_MAX) return false;
+    if(lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE) return false;
+    if(lv_obj_get_style_bg_image_src(obj, LV_PART_MAIN) != NULL) return false;
+
+    /*Only the drawing of the base widget is known to not depend on the scroll position*/
+    const lv_obj_class_t * class_p;
+    for(class_p = obj->class_p; class_p && class_p != &lv_obj_class; class_p = class_p->base_class) {
+        if(class_p->event_cb) return false;
+    }
+
+    uint32_t event_cnt = lv_obj_get_event_count(obj);
+    uint32_t i;
+    for(i = 0; i < event_cnt; i++) {
+        uint32_t code = lv_obj_get_event_dsc(obj, i)->filter & ~LV_EVENT_PREPROCESS;
+        if(code == LV_EVENT_ALL || (code >= LV_EVENT_COVER_CHECK && code <= LV_EVENT_DRAW_TASK_ADDED)) return false;
+    }
+
+    /*Floating children don't scroll*/
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        if(lv_obj_is_floating(obj->spec_attr->children[i])) return false;
+    }
+
+    /*Transparent or transformed widgets are rendered in layers*/
+    if(lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN) < LV_OPA_MAX) return false;
+    lv_obj_t * parent;
+    for(parent = obj; parent; parent = lv_obj_get_parent(parent)) {
+        if(parent->spec_attr && parent->spec_attr->layer_type != LV_LAYER_TYPE_NONE) return false;
+    }
+
+    return true;
+#endif
+}
+
+/**
+ * Check if a widget drawn above the scrolled widget overlaps an area
+ * @param obj   the scrolled widget
+ * @param area  the area to move
+ * @return      true: the area is (partially) covered by an other widget
+ */
+static bool scroll_blit_is_covered(lv_obj_t * obj, const lv_area_t * area)
+{
+    lv_display_t * disp = lv_obj_get_display(obj);
+    lv_obj_t * layers[2] = {disp->top_layer, disp->sys_layer};
+    uint32_t l;
+    for(l = 0; l < 2; l++) {
+        if(layers[l] == NULL) continue;
+        uint32_t cnt = lv_obj_get_child_count(layers[l]);
+        uint32_t i;
+        for(i = 0; i < cnt; i++) {
+            lv_obj_t * child = layers[l]->spec_attr->children[i];
+            if(lv_obj_is_hidden(child)) continue;
+            lv_area_t child_area = child->coords;
+            lv_area_increase(&child_area, lv_obj_get_ext_draw_size(child), lv_obj_get_ext_draw_size(child));
+            if(lv_area_is_on(&child_area, area)) return true;
+        }
+    }
+
+    /*The siblings after the widget and its parents are drawn above it*/
+    lv_obj_t * parent;
+    for(parent = lv_obj_get_parent(obj); parent; obj = parent, parent = lv_obj_get_parent(parent)) {
+        uint32_t cnt = lv_obj_get_child_count(parent);
+        uint32_t i;
+        for(i = lv_obj_get_index(obj) + 1; i < cnt; i++) {
+            lv_obj_t * sibling = parent->spec_attr->children[i];
+            if(lv_obj_is_hidden(sibling)) continue;
+            lv_area_t sibling_area = sibling->coords;
+            lv_area_increase(&sibling_area, lv_obj_get_ext_draw_size(sibling), lv_obj_get_ext_draw_size(sibling));
+            if(lv_area_is_on(&sibling_area, area)) return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Get the area of a scrolled widget whose pixels can be moved
+ * @param obj   the scrolled widget
+ * @param area  store the area here in screen coordinates
+ * @return      true: the area is visible and not covered by other widgets
+ */
+static bool scroll_blit_get_area(lv_obj_t * obj, lv_area_t * area)
+{
+    int32_t w = lv_area_get_width(&obj->coords);
+    int32_t h = lv_area_get_height(&obj->coords);
+    int32_t border = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    int32_t radius = LV_MIN(lv_obj_get_style_radius(obj, LV_PART_MAIN), LV_MIN(w, h) / 2);
+
+    /*Exclude the border and the rows with rounded corners*/
+    *area = obj->coords;
+    area->x1 += border;
+    area->x2 -= border;
+    area->y1 += LV_MAX(border, radius);
+    area->y2 -= LV_MAX(border, radius);
+
+    /*Exclude the scrollbars as they stay in place*/
+    lv_area_t hor_area;
+    lv_area_t ver_area;
+    lv_obj_get_scrollbar_area(obj, &hor_area, &ver_area);
+    if(lv_area_get_size(&ver_area) > 0) {
+        if(ver_area.x1 > obj->coords.x1 + w / 2) area->x2 = LV_MIN(area->x2, ver_area.x1 - 1);
+        else area->x1 = LV_MAX(area->x1, ver_area.x2 + 1);
+    }
+    if(lv_area_get_size(&hor_area) > 0) {
+        if(hor_area.y1 > obj->coords.y1 + h / 2) area->y2 = LV_MIN(area->y2, hor_area.y1 - 1);
+        else area->y1 = LV_MAX(area->y1, hor_area.y2 + 1);
+    }
+
+    if(area->x1 > area->x2 || area->y1 > area->y2) return false;
+    if(!lv_obj_area_is_visible(obj, area)) return false;
+
+    return !scroll_blit_is_covered(obj, area);
+}
+
 /**
  * Refresh the joined areas
  */
@@ -857,6 +1176,40 @@ static void refr_invalid_areas(void)
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Check whether the frame fit in the display's frame budget. While any display misses
+ * its budget, step the animations less often and postpone the low priority timers
+ * so that rendering catches up instead of stuttering.
+ * @param rendered  true: the frame was rendered; false: there was nothing to redraw
+ */
+static void refr_check_frame_budget(bool rendered)
+{
+    uint32_t budget = lv_display_get_frame_budget(disp_refr);
+    bool over;
+    if(budget == 0) {
+        if(!disp_refr->frame_over_budget) return;
+        over = false;
+    }
+    else {
+        /*Only the rendered frames tell whether rendering fits in the budget*/
+        if(!rendered) return;
+        over = lv_tick_elaps(disp_refr->frame_start) > budget;
+        if(over) disp_refr->frame_budget_miss_cnt++;
+    }
+
+    disp_refr->frame_over_budget = over;
+
+    bool any_over = false;
+    lv_display_t * d = lv_display_get_next(NULL);
+    while(d && !any_over) {
+        any_over = d->frame_over_budget;
+        d = lv_display_get_next(d);
+    }
+
+    lv_anim_core_skip_frames(any_over);
+    lv_timer_core_defer_low_priority(any_over);
+}
+
 /**
  * Reshape the draw buffer if required
  * @param layer  pointer to a layer which will be drawn
@@ -1229,6 +1582,152 @@ static lv_result_t layer_get_area(lv_layer_t * layer, lv_obj_t * obj, lv_layer_t
     return LV_RESULT_OK;
 }
 
+/**
+ * Draw the retained bitmap of a widget and render it first if needed.
+ * @param layer         the layer to draw to
+ * @param obj           the retained widget
+ * @param opa_layered   `opa_layered` of the widget
+ * @param opa_parent    the opacity inherited from the parents
+ * @param recolor_parent the recolor inherited from the parents
+ * @return              false if the bitmap couldn't be created
+ */
+static bool refr_obj_retained(lv_layer_t * layer, lv_obj_t * obj, lv_opa_t opa_layered, lv_opa_t opa_parent,
+                              lv_color32_t recolor_parent)
+{
+    lv_area_t obj_draw_area;
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+    lv_obj_get_coords(obj, &obj_draw_area);
+    lv_area_increase(&obj_draw_area, ext_draw_size, ext_draw_size);
+
+    lv_area_t clip_coords_for_obj;
+    if(!lv_area_intersect(&clip_coords_for_obj, &layer->_clip_area, &obj_draw_area)) return true;
+
+    /*Render the bitmap again if it's outdated or the size of the widget has changed.
+     *Moving the widget with its parent (e.g. on scroll) doesn't need re-rendering.*/
+    lv_draw_buf_t * draw_buf = obj->spec_attr->layer_cache;
+    if(draw_buf && (obj->spec_attr->layer_cache_outdated ||
+                    draw_buf->header.w != lv_area_get_width(&obj_draw_area) ||
+                    draw_buf->header.h != lv_area_get_height(&obj_draw_area))) {
+        lv_refr_free_retained_layer(obj);
+        draw_buf = NULL;
+    }
+
+    if(draw_buf == NULL) {
+        draw_buf = retained_layer_create(obj, &obj_draw_area);
+        if(draw_buf == NULL) return false;
+    }
+
+    lv_draw_image_dsc_t draw_dsc;
+    lv_draw_image_dsc_init(&draw_dsc);
+    draw_dsc.src = draw_buf;
+    draw_dsc.opa = opa_layered;
+    draw_dsc.blend_mode = lv_obj_get_style_blend_mode(obj, LV_PART_MAIN);
+    draw_dsc.bitmap_mask_src = lv_obj_get_style_bitmap_mask_src(obj, LV_PART_MAIN);
+    draw_dsc.recolor = lv_color_make(recolor_parent.red, recolor_parent.green, recolor_parent.blue);
+    draw_dsc.recolor_opa = recolor_parent.alpha;
+    draw_dsc.base.obj = obj;
+
+    /*The draw task takes the opacity from the layer but the widget's own opacity is already in the bitmap*/
+    lv_opa_t layer_opa = layer->opa;
+    layer->opa = opa_parent;
+    lv_draw_image(layer, &draw_dsc, &obj_draw_area);
+    layer->opa = layer_opa;
+
+    return true;
+}
+
+/**
+ * Render a widget and its children into a new bitmap
+ * @param obj       the widget to render
+ * @param area      the area to render (the coordinates of the widget with the extra draw size)
+ * @return          the rendered bitmap or NULL if it doesn't fit into `LV_DRAW_LAYER_RETAINED_MAX_MEMORY`
+ *                  or there is no display being refreshed
+ */
+static lv_draw_buf_t * retained_layer_create(lv_obj_t * obj, const lv_area_t * area)
+{
+    /*The bitmap is rendered with the draw units of the refreshed display*/
+    if(disp_refr == NULL) return NULL;
+
+    /*Use the display's color format if the widget fully covers the bitmap.
+     *It's smaller and it's blended exactly like the normal rendering.*/
+    lv_color_format_t cf = LV_COLOR_FORMAT_ARGB8888;
+    lv_color_format_t disp_cf = disp_refr->color_format;
+    bool disp_cf_is_image = disp_cf == LV_COLOR_FORMAT_RGB565 || disp_cf == LV_COLOR_FORMAT_RGB888 ||
+                            disp_cf == LV_COLOR_FORMAT_XRGB8888;
+    if(disp_cf_is_image && lv_obj_get_style_bitmap_mask_src(obj, LV_PART_MAIN) == NULL &&
+       !alpha_test_area_on_obj(obj, area)) {
+        cf = disp_cf;
+    }
+
+    uint32_t w = lv_area_get_width(area);
+    uint32_t h = lv_area_get_height(area);
+    uint32_t * used = &LV_GLOBAL_DEFAULT()->retained_layer_memory;
+    uint32_t size = lv_draw_buf_width_to_stride(w, cf) * h;
+    if(*used + size > LV_DRAW_LAYER_RETAINED_MAX_MEMORY) {
+        LV_LOG_INFO("LV_DRAW_LAYER_RETAINED_MAX_MEMORY was reached, render the widget normally");
+        return NULL;
+    }
+
+    LV_PROFILER_REFR_BEGIN;
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(w, h, cf, LV_STRIDE_AUTO);
+    if(draw_buf == NULL) {
+        LV_PROFILER_REFR_END;
+        return NULL;
+    }
+    lv_draw_buf_clear(draw_buf, NULL);
+
+    lv_layer_t layer;
+    lv_layer_init(&layer);
+    layer.draw_buf = draw_buf;
+    layer.color_format = cf;
+    layer.buf_area = *area;
+    layer._clip_area = *area;
+    layer.phy_clip_area = *area;
+
+    /*Only the widget's own opacity and recolor is retained. The parents' are applied
+     *when the bitmap is drawn.*/
+    layer.opa = lv_obj_get_style_opa(obj, LV_PART_MAIN);
+    layer.recolor = lv_obj_style_apply_recolor(obj, LV_PART_MAIN, layer.recolor);
+
+    lv_draw_unit_send_event(NULL, LV_EVENT_CHILD_CREATED, &layer);
+
+    lv_obj_redraw(&layer, obj);
+
+    /*Render it now as the display's layer is still being created*/
+    layer.all_tasks_added = true;
+    lv_draw_dispatch_request();
+    while(layer.draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        if(!lv_draw_dispatch_layer(disp_refr, &layer)) {
+            lv_draw_wait_for_finish();
+            lv_draw_dispatch_request();
+        }
+    }
+
+    lv_draw_unit_send_event(NULL, LV_EVENT_SCREEN_LOAD_START, &layer);
+    lv_draw_unit_send_event(NULL, LV_EVENT_CHILD_DELETED, &layer);
+
+    obj->spec_attr->layer_cache = draw_buf;
+    obj->spec_attr->layer_cache_outdated = 0;
+    *used += draw_buf->data_size;
+
+    LV_PROFILER_REFR_END;
+    return draw_buf;
+}
+
+/**
+ * Get the layer type to use if the retained bitmap can't be used
+ * @param obj       the retained widget
+ * @return          the layer type the widget would have without retaining
+ */
+static lv_layer_type_t retained_get_fallback_layer_type(lv_obj_t * obj)
+{
+    if(lv_obj_get_style_opa_layered(obj, LV_PART_MAIN) != LV_OPA_COVER) return LV_LAYER_TYPE_SIMPLE;
+    if(lv_obj_get_style_bitmap_mask_src(obj, LV_PART_MAIN) != NULL) return LV_LAYER_TYPE_SIMPLE;
+    if(lv_obj_get_style_blend_mode(obj, LV_PART_MAIN) != LV_BLEND_MODE_NORMAL) return LV_LAYER_TYPE_SIMPLE;
+    return LV_LAYER_TYPE_NONE;
+}
+
 static bool alpha_test_area_on_obj(lv_obj_t * obj, const lv_area_t * area)
 {
     /*Test for alpha by assuming there is no alpha. If it fails, fall back to rendering with alpha*/
@@ -59,6 +59,17 @@ lv_display_t * lv_refr_get_disp_refreshing(void);
  */
 void lv_refr_set_disp_refreshing(lv_display_t * disp);
 
+/**
+ * Invalidate a widget which was scrolled by `dx` and `dy`. If the display enables scroll blit
+ * and the widget can be safely moved, only the newly exposed parts are invalidated and
+ * the rendered pixels are moved before the next refresh.
+ * @param obj   pointer to the scrolled widget (its children are already moved)
+ * @param dx    horizontal scroll distance
+ * @param dy    vertical scroll distance
+ * @return      LV_RESULT_OK: the scroll will be blitted; LV_RESULT_INVALID: the widget needs to be invalidated
+ */
+lv_result_t lv_refr_scroll_blit(lv_obj_t * obj, int32_t dx, int32_t dy);
+
 /**
  * Search the most top object which fully covers an area
  * @param area_p pointer to an area
@@ -74,6 +85,19 @@ lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
  */
 void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj);
 
+/**
+ * Outdate the retained layers of a widget and its parents as their content changes.
+ * Called when a widget is invalidated.
+ * @param obj   pointer to the invalidated widget
+ */
+void lv_refr_invalidate_retained_layers(const lv_obj_t * obj);
+
+/**
+ * Free the retained layer of a widget (if any)
+ * @param obj   pointer to a widget
+ */
+void lv_refr_free_retained_layer(lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
@@ -224,6 +224,7 @@ static void perf_monitor_disp_event_cb(lv_event_t * e)
         case LV_EVENT_REFR_READY:
             info->measured.refr_elaps_sum += lv_tick_elaps(info->measured.refr_start);
             info->measured.refr_cnt++;
+            if(lv_display_is_over_budget(disp)) info->measured.budget_miss_cnt++;
             break;
         case LV_EVENT_RENDER_START:
             info->measured.render_in_progress = 1;
@@ -272,8 +273,10 @@ static void perf_dump_info(lv_display_t * disp)
     uint32_t disp_refr_period = disp_refr_timer ? disp_refr_timer->period : LV_DEF_REFR_PERIOD;
 
     info->calculated.fps = time_since_last_report ? (1000 * info->measured.refr_cnt / time_since_last_report) : 0;
-    info->calculated.fps = LV_MIN(info->calculated.fps,
-                                  1000 / disp_refr_period);   /*Limit due to possible off-by-one error*/
+    if(disp_refr_period) {
+        info->calculated.fps = LV_MIN(info->calculated.fps,
+                                      1000 / disp_refr_period);   /*Limit due to possible off-by-one error*/
+    }
 
     info->calculated.cpu = 100 - LV_SYSMON_GET_IDLE();
 #if LV_SYSMON_PROC_IDLE_AVAILABLE
@@ -289,6 +292,7 @@ static void perf_dump_info(lv_display_t * disp)
     info->calculated.render_avg_time = info->measured.render_cnt ? ((info->measured.render_elaps_sum -
                                                                      info->measured.flush_in_render_elaps_sum) /
                                                                     info->measured.render_cnt) : 0;
+    info->calculated.frame_budget = lv_display_get_frame_budget(disp);
 
     info->calculated.cpu_avg_total = ((info->calculated.cpu_avg_total * (info->calculated.run_cnt - 1)) +
                                       info->calculated.cpu) / info->calculated.run_cnt;
@@ -340,6 +344,10 @@ static void perf_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
            perf->calculated.refr_avg_time, perf->calculated.render_avg_time, perf->calculated.flush_avg_time,
            perf->calculated.cpu);
 #endif
+    if(perf->calculated.frame_budget) {
+        LV_LOG("sysmon: %" LV_PRIu32 " of %" LV_PRIu32 " frames over the %" LV_PRIu32 "ms budget\n",
+               perf->measured.budget_miss_cnt, perf->measured.render_cnt, perf->calculated.frame_budget);
+    }
 #else
     lv_obj_t * label = lv_observer_get_target(observer);
 #if LV_SYSMON_PROC_IDLE_AVAILABLE
@@ -361,6 +369,12 @@ static void perf_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
         perf->calculated.render_avg_time, perf->calculated.flush_avg_time
     );
 #endif /*LV_SYSMON_PROC_IDLE_AVAILABLE*/
+    if(perf->calculated.frame_budget) {
+        char buf[48];
+        lv_snprintf(buf, sizeof(buf), "\n%" LV_PRIu32 " over %" LV_PRIu32 " ms budget",
+                    perf->measured.budget_miss_cnt, perf->calculated.frame_budget);
+        lv_label_ins_text(label, LV_LABEL_POS_LAST, buf);
+    }
 #endif /*LV_USE_PERF_MONITOR_LOG_MODE*/
 }
 
@@ -47,6 +47,7 @@ struct _lv_sysmon_perf_info_t {
         uint32_t flush_not_in_render_start;
         uint32_t flush_not_in_render_elaps_sum;
         uint32_t last_report_timestamp;
+        uint32_t budget_miss_cnt;       /**< Frames which were over the display's frame budget*/
         uint32_t render_in_progress : 1;
     } measured;
 
@@ -59,6 +60,7 @@ struct _lv_sysmon_perf_info_t {
         uint32_t refr_avg_time;
         uint32_t render_avg_time;       /**< Pure rendering time without flush time*/
         uint32_t flush_avg_time;        /**< Pure flushing time without rendering time*/
+        uint32_t frame_budget;          /**< The display's frame budget, 0: no budget*/
         uint32_t cpu_avg_total;
         uint32_t fps_avg_total;
         uint32_t run_cnt;
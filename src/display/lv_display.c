@@ -50,6 +50,7 @@ static void set_y_anim(void * obj, int32_t v);
 static void scr_anim_completed(lv_anim_t * a);
 static bool is_out_anim(lv_screen_load_anim_t a);
 static void disp_event_cb(lv_event_t * e);
+static lv_result_t display_vsync(lv_display_t * disp, uint32_t timestamp, void * param);
 
 /**********************
  *  STATIC VARIABLES
@@ -661,6 +662,23 @@ bool lv_display_get_antialiasing(lv_display_t * disp)
     return disp->antialiasing;
 }
 
+void lv_display_set_scroll_blit(lv_display_t * disp, bool en)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->scroll_blit_en = en;
+    if(!en) disp->scroll_blit_pending = 0;
+}
+
+bool lv_display_get_scroll_blit(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return false;
+
+    return disp->scroll_blit_en;
+}
+
 lv_display_render_mode_t lv_display_get_render_mode(lv_display_t * disp)
 {
     if(disp == NULL) disp = lv_display_get_default();
@@ -1164,10 +1182,84 @@ lv_result_t lv_display_send_vsync_event(lv_display_t * disp, void * param)
     if(!disp) disp = lv_display_get_default();
     if(!disp) return LV_RESULT_INVALID;
 
-    if(disp->vsync_count > 0)
-        return lv_display_send_event(disp, LV_EVENT_VSYNC, param);
+    return display_vsync(disp, lv_tick_get(), param);
+}
+
+lv_result_t lv_display_report_vsync(lv_display_t * disp, uint32_t timestamp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return LV_RESULT_INVALID;
+
+    return display_vsync(disp, timestamp, NULL);
+}
 
-    return LV_RESULT_INVALID;
+void lv_display_set_vsync_pacing(lv_display_t * disp, bool en)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+    if(disp->vsync_paced == en) return;
+
+    disp->vsync_paced = en;
+
+    /*Pacing needs the vsyncs just like the LV_EVENT_VSYNC listeners*/
+    if(en) {
+        if(disp->vsync_count == 0)
+            lv_display_send_event(disp, LV_EVENT_VSYNC_REQUEST, disp);
+        disp->vsync_count++;
+
+        /*From now on the vsyncs start the refresh*/
+        if(disp->refr_timer) lv_timer_pause(disp->refr_timer);
+        disp->vsync_refr_pending = disp->inv_p > 0;
+    }
+    else {
+        disp->vsync_count--;
+        if(disp->vsync_count == 0)
+            lv_display_send_event(disp, LV_EVENT_VSYNC_REQUEST, NULL);
+
+        /*Don't wait for the next vsync anymore*/
+        if(disp->vsync_refr_pending && disp->refr_timer) lv_timer_resume(disp->refr_timer);
+        disp->vsync_refr_pending = 0;
+    }
+}
+
+bool lv_display_get_vsync_pacing(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return false;
+
+    return disp->vsync_paced;
+}
+
+void lv_display_set_frame_budget(lv_display_t * disp, uint32_t budget)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->frame_budget = budget;
+}
+
+uint32_t lv_display_get_frame_budget(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return 0;
+
+    return disp->frame_budget ? disp->frame_budget : disp->vsync_period;
+}
+
+uint32_t lv_display_get_frame_budget_miss_count(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return 0;
+
+    return disp->frame_budget_miss_cnt;
+}
+
+bool lv_display_is_over_budget(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return false;
+
+    return disp->frame_over_budget;
 }
 
 bool lv_display_register_vsync_event(lv_display_t * disp, lv_event_cb_t event_cb, void * user_data)
@@ -1416,6 +1508,7 @@ static void update_resolution(lv_display_t * disp)
     lv_memzero(disp->inv_areas, sizeof(disp->inv_areas));
     lv_memzero(disp->inv_area_joined, sizeof(disp->inv_area_joined));
     disp->inv_p = 0;
+    disp->scroll_blit_pending = 0;
     lv_obj_invalidate(disp->sys_layer);
 
     lv_obj_tree_walk(NULL, invalidate_layout_cb, NULL);
@@ -1580,10 +1673,36 @@ static void disp_event_cb(lv_event_t * e)
     lv_display_t * disp = lv_event_get_target(e);
     switch(code) {
         case LV_EVENT_REFR_REQUEST:
-            if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
+            /*If paced, the next vsync will start the refresh*/
+            if(disp->vsync_paced) disp->vsync_refr_pending = 1;
+            else if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
             break;
 
         default:
             break;
     }
 }
+
+static lv_result_t display_vsync(lv_display_t * disp, uint32_t timestamp, void * param)
+{
+    if(disp->vsync_received) disp->vsync_period = timestamp - disp->last_vsync;
+    disp->last_vsync = timestamp;
+    disp->vsync_received = 1;
+
+    if(disp->vsync_count == 0) return LV_RESULT_INVALID;
+
+    lv_result_t res = lv_display_send_event(disp, LV_EVENT_VSYNC, param);
+    if(res != LV_RESULT_OK) return res;
+
+    /*Start the refresh at the beginning of the frame.
+     *The listeners above (e.g. the animations) could have invalidated too.*/
+    if(disp->vsync_paced && disp->vsync_refr_pending && disp->refr_timer) {
+        disp->vsync_refr_pending = 0;
+        disp->frame_start = timestamp;
+        disp->frame_start_at_vsync = 1;
+        lv_timer_resume(disp->refr_timer);
+        lv_timer_ready(disp->refr_timer);
+    }
+
+    return LV_RESULT_OK;
+}
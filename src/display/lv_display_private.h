@@ -115,6 +115,8 @@ struct _lv_display_t {
     uint32_t antialiasing : 1;       /**< 1: anti-aliasing is enabled on this display.*/
     uint32_t tile_cnt     : 8;       /**< Divide the display buffer into these number of tiles */
     uint32_t stride_is_auto : 1;     /**< 1: The stride of the buffers was not set explicitly. */
+    uint32_t scroll_blit_en : 1;     /**< 1: Move the rendered pixels of scrolled widgets instead of redrawing them */
+    uint32_t scroll_blit_pending : 1; /**< 1: `scroll_blit_area` needs to be moved before the next refresh */
 
 
     /** 1: The current screen rendering is in progress*/
@@ -128,6 +130,10 @@ struct _lv_display_t {
     uint32_t inv_p;
     int32_t inv_en_cnt;
 
+    /** The area of a scrolled widget and the distance to move its pixels by*/
+    lv_area_t scroll_blit_area;
+    lv_point_t scroll_blit_ofs;
+
     lv_draw_buf_t _static_buf1; /**< Used when user pass in a raw buffer as display draw buffer */
     lv_draw_buf_t _static_buf2;
     /*---------------------
@@ -179,6 +185,18 @@ struct _lv_display_t {
     lv_area_t refreshed_area;
     uint32_t vsync_count;
 
+    /*Frame scheduling*/
+    uint32_t last_vsync;                /**< Timestamp of the last vsync*/
+    uint32_t vsync_period;              /**< Time between the last two vsyncs*/
+    uint32_t frame_start;               /**< Start of the current frame, the vsync time if paced*/
+    uint32_t frame_budget;              /**< Max. time of a frame, 0: use `vsync_period`*/
+    uint32_t frame_budget_miss_cnt;     /**< Number of frames which took longer than the budget*/
+    uint32_t vsync_received : 1;        /**< 1: `last_vsync` is valid*/
+    uint32_t vsync_paced : 1;           /**< 1: refresh only when a vsync arrives*/
+    uint32_t vsync_refr_pending : 1;    /**< 1: a refresh is waiting for the next vsync*/
+    uint32_t frame_start_at_vsync : 1;  /**< 1: `frame_start` was set by the vsync*/
+    uint32_t frame_over_budget : 1;     /**< 1: the last rendered frame missed the budget*/
+
 #if LV_USE_PERF_MONITOR
     lv_obj_t * perf_label;
     lv_sysmon_backend_data_t perf_sysmon_backend;
@@ -111,6 +111,7 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     new_task->type = type;
     new_task->draw_dsc = (uint8_t *)new_task + LV_ALIGN_UP(sizeof(lv_draw_task_t), 8);
     new_task->state = LV_DRAW_TASK_STATE_WAITING;
+    _draw_info.task_cnt++;
 
     /*Find the tail*/
     if(layer->draw_task_head == NULL) {
@@ -321,6 +322,11 @@ uint32_t lv_draw_get_unit_count(void)
     return _draw_info.unit_cnt;
 }
 
+uint32_t lv_draw_get_task_count(void)
+{
+    return _draw_info.task_cnt;
+}
+
 lv_draw_task_t * lv_draw_get_available_task(lv_layer_t * layer, lv_draw_task_t * t_prev, uint8_t draw_unit_id)
 {
     if(_draw_info.unit_cnt == 1) {
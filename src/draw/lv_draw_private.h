@@ -187,6 +187,7 @@ typedef struct {
     lv_draw_unit_t * unit_head;
     uint32_t unit_cnt;
     uint32_t used_memory_for_layers; /* measured as bytes */
+    uint32_t task_cnt; /* number of draw tasks added so far */
 #if LV_USE_OS
     lv_thread_sync_t sync;
 #else
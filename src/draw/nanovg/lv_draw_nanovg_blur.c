@@ -119,7 +119,7 @@ void lv_draw_nanovg_blur(lv_draw_task_t * t, const lv_draw_blur_dsc_t * dsc, con
     /* Build blur params */
     NVGLUblurParams params;
     params.radius  = dsc->blur_radius;
-    params.quality = (dsc->quality == LV_BLUR_QUALITY_SPEED)
+    params.quality = (dsc->quality == LV_BLUR_QUALITY_SPEED || dsc->quality == LV_BLUR_QUALITY_PYRAMID)
                      ? NVGLU_BLUR_QUALITY_SPEED : NVGLU_BLUR_QUALITY_NORMAL;
 
     /* Recolor for drop shadows */
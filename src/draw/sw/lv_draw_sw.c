@@ -40,12 +40,24 @@
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_USE_OS
+typedef struct _lv_draw_sw_job_batch_t {
+    lv_draw_sw_job_cb_t job_cb;
+    void * user_data;
+    uint32_t job_cnt;
+    uint32_t job_next;              /**< Index of the next job to take*/
+    uint32_t helper_cnt;            /**< Number of other threads working on the batch*/
+    lv_thread_sync_t helpers_done;  /**< Signaled when the last helper left a closed batch*/
+} lv_draw_sw_job_batch_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 #if LV_USE_OS
     static void render_thread_cb(void * ptr);
+    static void run_batch_jobs(lv_draw_sw_unit_t * u, lv_draw_sw_job_batch_t * batch);
+    static void help_with_jobs(lv_draw_sw_unit_t * u);
 #endif
 
 static void execute_drawing(lv_draw_task_t * t);
@@ -75,12 +87,19 @@ void lv_draw_sw_init(void)
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_init();
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    lv_draw_sw_shadow_cache_init();
+#endif
+#endif
+
+#if LV_DRAW_SW_GRAD_CACHE_CNT
+    lv_draw_sw_grad_cache_init();
 #endif
 
     lv_draw_sw_unit_t * draw_sw_unit = lv_draw_create_unit(sizeof(lv_draw_sw_unit_t));
     draw_sw_unit->base_unit.dispatch_cb = dispatch;
     draw_sw_unit->base_unit.evaluate_cb = evaluate;
-    draw_sw_unit->base_unit.delete_cb = LV_USE_OS ? lv_draw_sw_delete : NULL;
+    draw_sw_unit->base_unit.delete_cb = lv_draw_sw_delete;
 #if LV_USE_DRAW_ARM2D_SYNC
     draw_sw_unit->base_unit.name = "SW_ARM2D";
 #else
@@ -88,6 +107,8 @@ void lv_draw_sw_init(void)
 #endif
 
 #if LV_USE_OS
+    lv_mutex_init(&draw_sw_unit->job_lock);
+
     uint32_t i;
     for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
         lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
@@ -99,12 +120,9 @@ void lv_draw_sw_init(void)
 #endif
 
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
-    if(LV_DRAW_SW_DRAW_UNIT_CNT > 1) {
-        tvg_engine_init(TVG_ENGINE_SW, LV_DRAW_SW_DRAW_UNIT_CNT);
-    }
-    else {
-        tvg_engine_init(TVG_ENGINE_SW, 0);
-    }
+    /*Each SW render thread has its own canvas and renders its vector tasks itself,
+     *so ThorVG doesn't need worker threads of its own*/
+    tvg_engine_init(TVG_ENGINE_SW, 0);
 #endif
 
     lv_ll_init(&LV_GLOBAL_DEFAULT()->draw_sw_blend_handler_ll, sizeof(lv_draw_sw_custom_blend_handler_t));
@@ -118,6 +136,13 @@ void lv_draw_sw_deinit(void)
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_deinit();
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    lv_draw_sw_shadow_cache_deinit();
+#endif
+#endif
+
+#if LV_DRAW_SW_GRAD_CACHE_CNT
+    lv_draw_sw_grad_cache_deinit();
 #endif
 }
 
@@ -139,6 +164,12 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
         lv_thread_delete(&thread_dsc->thread);
     }
 
+    lv_mutex_delete(&draw_sw_unit->job_lock);
+
+    return 0;
+#elif LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+    lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *) draw_unit;
+    lv_draw_sw_vector_ctx_deinit(&draw_sw_unit->vector_ctx);
     return 0;
 #else
     LV_UNUSED(draw_unit);
@@ -199,6 +230,72 @@ lv_draw_sw_blend_handler_t lv_draw_sw_get_blend_handler(lv_color_format_t dest_c
     return NULL;
 }
 
+void lv_draw_sw_run_jobs(lv_draw_task_t * t, lv_draw_sw_job_cb_t job_cb, void * user_data, uint32_t job_cnt)
+{
+    LV_ASSERT_NULL(job_cb);
+    if(job_cnt == 0) return;
+
+    LV_PROFILER_DRAW_BEGIN;
+
+#if LV_USE_OS
+    /*Only the tasks dispatched by the SW draw unit can use the other SW render threads*/
+    lv_draw_sw_unit_t * u = NULL;
+    if(LV_DRAW_SW_DRAW_UNIT_CNT > 1 && job_cnt > 1 && t && t->draw_unit && t->draw_unit->dispatch_cb == dispatch) {
+        u = (lv_draw_sw_unit_t *)t->draw_unit;
+    }
+
+    if(u) {
+        lv_draw_sw_job_batch_t batch;
+        lv_memzero(&batch, sizeof(batch));
+        batch.job_cb = job_cb;
+        batch.user_data = user_data;
+        batch.job_cnt = job_cnt;
+
+        bool published = false;
+        lv_mutex_lock(&u->job_lock);
+        if(u->job_batch_act == NULL) {
+            lv_thread_sync_init(&batch.helpers_done);
+            u->job_batch_act = &batch;
+            published = true;
+        }
+        lv_mutex_unlock(&u->job_lock);
+
+        if(published) {
+            /*Wake up the idle threads. The busy ones will check the batch only when they
+             *finish their task and nothing else is dispatched to them.*/
+            uint32_t i;
+            for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+                lv_draw_sw_thread_dsc_t * thread_dsc = &u->thread_dscs[i];
+                if(thread_dsc->task_act == NULL && thread_dsc->inited) lv_thread_sync_signal(&thread_dsc->sync);
+            }
+
+            run_batch_jobs(u, &batch);
+
+            /*Close the batch so that no new helpers join and wait for the ones still working on it*/
+            lv_mutex_lock(&u->job_lock);
+            u->job_batch_act = NULL;
+            bool wait = batch.helper_cnt > 0;
+            lv_mutex_unlock(&u->job_lock);
+
+            if(wait) lv_thread_sync_wait(&batch.helpers_done);
+            lv_thread_sync_delete(&batch.helpers_done);
+
+            LV_PROFILER_DRAW_END;
+            return;
+        }
+    }
+#else
+    LV_UNUSED(t);
+#endif
+
+    uint32_t i;
+    for(i = 0; i < job_cnt; i++) {
+        job_cb(user_data, i);
+    }
+
+    LV_PROFILER_DRAW_END;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -297,6 +394,7 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
         all_idle = false;
         taken_cnt++;
         t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+        t->draw_unit = draw_unit;
         thread_dsc->task_act = t;
 
         /*Let the render thread work*/
@@ -329,6 +427,7 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
     }
 
     t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+    t->draw_unit = draw_unit;
     draw_sw_unit->task_act = t;
 
     execute_drawing(t);
@@ -358,6 +457,11 @@ static void render_thread_cb(void * ptr)
                 break;
             }
             lv_thread_sync_wait(&thread_dsc->sync);
+
+            /*Woken up without a task: another thread might have jobs to share*/
+            if(thread_dsc->task_act == NULL && !thread_dsc->exit_status) {
+                help_with_jobs((lv_draw_sw_unit_t *)thread_dsc->draw_unit);
+            }
         }
 
         if(thread_dsc->exit_status) {
@@ -377,10 +481,50 @@ static void render_thread_cb(void * ptr)
 
     }
 
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+    lv_draw_sw_vector_ctx_deinit(&thread_dsc->vector_ctx);
+#endif
+
     thread_dsc->inited = false;
     lv_thread_sync_delete(&thread_dsc->sync);
     LV_LOG_INFO("exit software rendering thread");
 }
+
+static void run_batch_jobs(lv_draw_sw_unit_t * u, lv_draw_sw_job_batch_t * batch)
+{
+    while(1) {
+        lv_mutex_lock(&u->job_lock);
+        uint32_t job_idx = batch->job_next;
+        if(job_idx < batch->job_cnt) batch->job_next++;
+        lv_mutex_unlock(&u->job_lock);
+
+        if(job_idx >= batch->job_cnt) break;
+
+        batch->job_cb(batch->user_data, job_idx);
+    }
+}
+
+static void help_with_jobs(lv_draw_sw_unit_t * u)
+{
+    lv_mutex_lock(&u->job_lock);
+    lv_draw_sw_job_batch_t * batch = u->job_batch_act;
+    if(batch) batch->helper_cnt++;
+    lv_mutex_unlock(&u->job_lock);
+
+    if(batch == NULL) return;
+
+    LV_PROFILER_DRAW_BEGIN;
+    run_batch_jobs(u, batch);
+
+    lv_mutex_lock(&u->job_lock);
+    batch->helper_cnt--;
+    /*If the batch is closed already its owner is waiting for the last helper*/
+    bool last = batch->helper_cnt == 0 && u->job_batch_act != batch;
+    lv_mutex_unlock(&u->job_lock);
+
+    if(last) lv_thread_sync_signal(&batch->helpers_done);
+    LV_PROFILER_DRAW_END;
+}
 #endif
 
 static void execute_drawing(lv_draw_task_t * t)
@@ -410,7 +554,7 @@ static void execute_drawing(lv_draw_task_t * t)
             lv_draw_sw_arc(t, t->draw_dsc, &t->area);
             break;
         case LV_DRAW_TASK_TYPE_LINE:
-            lv_draw_line_iterate(t, t->draw_dsc, lv_draw_sw_line);
+            lv_draw_sw_polyline(t, t->draw_dsc);
             break;
         case LV_DRAW_TASK_TYPE_BLUR:
             lv_draw_sw_blur(t, t->draw_dsc, &t->area);
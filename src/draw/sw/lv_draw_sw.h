@@ -96,6 +96,14 @@ void lv_draw_sw_arc(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_
  */
 void lv_draw_sw_line(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
 
+/**
+ * Draw a line with SW render. If the descriptor has a point array, all the segments
+ * are rendered into a common coverage buffer with round joins and blended at once.
+ * @param t             pointer to a draw task
+ * @param dsc           the draw descriptor
+ */
+void lv_draw_sw_polyline(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
+
 /**
  * Blend a layer with SW render
  * @param t             pointer to a draw task
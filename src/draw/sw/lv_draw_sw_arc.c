@@ -15,13 +15,9 @@
 #include "lv_draw_sw_mask_private.h"
 #include "blend/lv_draw_sw_blend_private.h"
 #include "../../image/lv_image_decoder_private.h"
+#include "lv_draw_sw_raster_private.h"
 #include "lv_draw_sw.h"
 
-
-static void add_circle(const lv_opa_t * circle_mask, const lv_area_t * blend_area, const lv_area_t * circle_area,
-                       lv_opa_t * mask_buf,  int32_t width);
-static void get_rounded_area(int16_t angle, int32_t radius, uint8_t thickness, lv_area_t * res_area);
-
 /*********************
  *      DEFINES
  *********************/
@@ -74,42 +70,52 @@ void lv_draw_sw_arc(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_
         return;
     }
 
-    lv_area_t area_in;
-    lv_area_copy(&area_in, &area_out);
-    area_in.x1 += dsc->width;
-    area_in.y1 += dsc->width;
-    area_in.x2 -= dsc->width;
-    area_in.y2 -= dsc->width;
-
     /*Optimization: Minimize clipped area*/
     lv_area_t arc_area;
     lv_draw_arc_get_area(dsc->center.x, dsc->center.y, dsc->radius, dsc->start_angle, dsc->end_angle,
                          width, dsc->rounded, &arc_area);
     if(!lv_area_intersect(&clipped_area, &clipped_area, &arc_area)) return;
 
-    int32_t start_angle = (int32_t)dsc->start_angle;
-    int32_t end_angle = (int32_t)dsc->end_angle;
-    while(start_angle >= 360) start_angle -= 360;
-    while(end_angle >= 360) end_angle -= 360;
-
-    void * mask_list[4] = {0};
-    /*Create an angle mask*/
-    lv_draw_sw_mask_angle_param_t mask_angle_param;
-    lv_draw_sw_mask_angle_init(&mask_angle_param, dsc->center.x, dsc->center.y, start_angle, end_angle);
-    mask_list[0] = &mask_angle_param;
-
-    /*Create an outer mask*/
-    lv_draw_sw_mask_radius_param_t mask_out_param;
-    lv_draw_sw_mask_radius_init(&mask_out_param, &area_out, LV_RADIUS_CIRCLE, false);
-    mask_list[1] = &mask_out_param;
-
-    /*Create inner the mask*/
-    lv_draw_sw_mask_radius_param_t mask_in_param;
-    bool mask_in_param_valid = false;
-    if(lv_area_get_width(&area_in) > 0 && lv_area_get_height(&area_in) > 0) {
-        lv_draw_sw_mask_radius_init(&mask_in_param, &area_in, LV_RADIUS_CIRCLE, true);
-        mask_list[2] = &mask_in_param;
-        mask_in_param_valid = true;
+    /*Angles in the units of the rasterizer, the arc goes clockwise from the start angle*/
+    int32_t start_angle = (int32_t)(dsc->start_angle * LV_DRAW_SW_RASTER_ONE);
+    int32_t end_angle = (int32_t)(dsc->end_angle * LV_DRAW_SW_RASTER_ONE);
+    bool full = dsc->start_angle + 360 == dsc->end_angle || dsc->start_angle == dsc->end_angle + 360;
+    const int32_t angle_360 = 360 * LV_DRAW_SW_RASTER_ONE;
+    while(start_angle >= angle_360) start_angle -= angle_360;
+    while(start_angle < 0) start_angle += angle_360;
+    while(end_angle >= angle_360) end_angle -= angle_360;
+    while(end_angle < 0) end_angle += angle_360;
+    if(full) end_angle = start_angle + angle_360;
+    else if(end_angle <= start_angle) end_angle += angle_360;
+
+    lv_draw_sw_raster_t raster;
+    if(lv_draw_sw_raster_init(&raster, &clipped_area) != LV_RESULT_OK) return;
+
+    /*The center is on the top left corner of the center pixel. Add the outer edge clockwise and
+     *the inner edge counterclockwise*/
+    int32_t cx = dsc->center.x * LV_DRAW_SW_RASTER_ONE;
+    int32_t cy = dsc->center.y * LV_DRAW_SW_RASTER_ONE;
+    int32_t r_out = dsc->radius * LV_DRAW_SW_RASTER_ONE;
+    int32_t r_in = (dsc->radius - width) * LV_DRAW_SW_RASTER_ONE;
+    lv_draw_sw_raster_arc_to(&raster, cx, cy, r_out, start_angle, end_angle);
+    if(full) lv_draw_sw_raster_close(&raster);
+    lv_draw_sw_raster_arc_to(&raster, cx, cy, r_in, end_angle, start_angle);
+    lv_draw_sw_raster_close(&raster);
+
+    /*Add the round endings as circles with the same direction as the outer edge*/
+    if(dsc->rounded) {
+        int32_t r_mid = r_out - width * LV_DRAW_SW_RASTER_ONE / 2;
+        int32_t r_end = width * LV_DRAW_SW_RASTER_ONE / 2;
+        int32_t angles[2] = {start_angle, end_angle};
+        uint32_t i;
+        for(i = 0; i < 2; i++) {
+            int32_t cos_a = lv_draw_sw_raster_sin(angles[i] + 90 * LV_DRAW_SW_RASTER_ONE);
+            int32_t sin_a = lv_draw_sw_raster_sin(angles[i]);
+            int32_t x = cx + (int32_t)(((int64_t)r_mid * cos_a) >> LV_TRIGO_SHIFT);
+            int32_t y = cy + (int32_t)(((int64_t)r_mid * sin_a) >> LV_TRIGO_SHIFT);
+            lv_draw_sw_raster_arc_to(&raster, x, y, r_end, 0, angle_360);
+            lv_draw_sw_raster_close(&raster);
+        }
     }
 
     int32_t blend_h = lv_area_get_height(&clipped_area);
@@ -154,88 +160,40 @@ void lv_draw_sw_arc(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_
         }
     }
 
-    lv_opa_t * circle_mask = NULL;
-    lv_area_t round_area_1;
-    lv_area_t round_area_2;
-    if(dsc->rounded) {
-        circle_mask = lv_malloc(width * width);
-        LV_ASSERT_MALLOC(circle_mask);
-        lv_memset(circle_mask, 0xff, width * width);
-        lv_area_t circle_area = {0, 0, width - 1, width - 1};
-        lv_draw_sw_mask_radius_param_t circle_mask_param;
-        lv_draw_sw_mask_radius_init(&circle_mask_param, &circle_area, width / 2, false);
-        void * circle_mask_list[2] = {&circle_mask_param, NULL};
-
-        lv_opa_t * circle_mask_tmp = circle_mask;
-        for(h = 0; h < width; h++) {
-            lv_draw_sw_mask_res_t res = lv_draw_sw_mask_apply(circle_mask_list, circle_mask_tmp, 0, h, width);
-            if(res == LV_DRAW_SW_MASK_RES_TRANSP) {
-                lv_memzero(circle_mask_tmp, width);
-            }
-
-            circle_mask_tmp += width;
-        }
-        lv_draw_sw_mask_free_param(&circle_mask_param);
-
-        get_rounded_area(start_angle, dsc->radius, width, &round_area_1);
-        lv_area_move(&round_area_1, dsc->center.x, dsc->center.y);
-        get_rounded_area(end_angle, dsc->radius, width, &round_area_2);
-        lv_area_move(&round_area_2, dsc->center.x, dsc->center.y);
-
-    }
-
-    blend_area.y2 = blend_area.y1;
     for(h = 0; h < blend_h; h++) {
-        lv_memset(mask_buf, 0xff, blend_w);
-        blend_dsc.mask_res = lv_draw_sw_mask_apply(mask_list, mask_buf, blend_area.x1, blend_area.y1, blend_w);
-
-        if(dsc->rounded) {
-            if(blend_area.y1 >= round_area_1.y1 && blend_area.y1 <= round_area_1.y2) {
-                if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_TRANSP) {
-                    lv_memzero(mask_buf, blend_w);
-                    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
-                }
-                add_circle(circle_mask, &blend_area, &round_area_1, mask_buf, width);
-            }
-            if(blend_area.y1 >= round_area_2.y1 && blend_area.y1 <= round_area_2.y2) {
-                if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_TRANSP) {
-                    lv_memzero(mask_buf, blend_w);
-                    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+        /*Blend only the runs of the row covered by the arc*/
+        int32_t y = clipped_area.y1 + h;
+        int32_t x1;
+        int32_t x2;
+        while(lv_draw_sw_raster_get_row(&raster, y, mask_buf, &x1, &x2) == LV_DRAW_SW_MASK_RES_CHANGED) {
+            blend_area.x1 = x1;
+            blend_area.x2 = x2;
+            blend_area.y1 = y;
+            blend_area.y2 = y;
+            blend_dsc.mask_buf = mask_buf + x1 - clipped_area.x1;
+            blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+
+            /*If it was an RGB565A8 image use consider its A8 part on the mask*/
+            if(img_mask) {
+                const uint8_t * img_mask_tmp = img_mask;
+                img_mask_tmp += blend_dsc.src_stride / 2 * (blend_area.y1 - blend_dsc.src_area->y1);
+                img_mask_tmp += blend_area.x1 - blend_dsc.src_area->x1;
+
+                lv_opa_t * mask_tmp = mask_buf + x1 - clipped_area.x1;
+                int32_t w = x2 - x1 + 1;
+                int32_t i;
+                for(i = 0; i < w; i++) {
+                    mask_tmp[i] = LV_OPA_MIX2(mask_tmp[i], img_mask_tmp[i]);
                 }
-                add_circle(circle_mask, &blend_area, &round_area_2, mask_buf, width);
             }
-        }
-
-        /*If it was an RGB565A8 image use consider its A8 part on the mask*/
-        if(img_mask && blend_dsc.mask_res != LV_DRAW_SW_MASK_RES_TRANSP) {
-            const uint8_t * img_mask_tmp = img_mask;
-            img_mask_tmp += blend_dsc.src_stride / 2 * (blend_area.y1 - blend_dsc.src_area->y1);
-            img_mask_tmp += blend_area.x1 - blend_dsc.src_area->x1;
 
-            int32_t i;
-            for(i = 0; i < blend_w; i++) {
-                mask_buf[i] = LV_OPA_MIX2(mask_buf[i], img_mask_tmp[i]);
-            }
-            if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) {
-                blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
-            }
+            lv_draw_sw_blend(t, &blend_dsc);
         }
-
-        lv_draw_sw_blend(t, &blend_dsc);
-
-        blend_area.y1 ++;
-        blend_area.y2 ++;
-    }
-
-    lv_draw_sw_mask_free_param(&mask_angle_param);
-    lv_draw_sw_mask_free_param(&mask_out_param);
-    if(mask_in_param_valid) {
-        lv_draw_sw_mask_free_param(&mask_in_param);
     }
 
+    lv_draw_sw_raster_deinit(&raster);
     lv_free(mask_buf);
     if(dsc->img_src) lv_image_decoder_close(&decoder_dsc);
-    if(circle_mask) lv_free(circle_mask);
 #else
     LV_LOG_WARN("Can't draw arc with LV_DRAW_SW_COMPLEX == 0");
     LV_UNUSED(center);
@@ -251,61 +209,6 @@ void lv_draw_sw_arc(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_
  *   STATIC FUNCTIONS
  **********************/
 
-static void add_circle(const lv_opa_t * circle_mask, const lv_area_t * blend_area, const lv_area_t * circle_area,
-                       lv_opa_t * mask_buf,  int32_t width)
-{
-    lv_area_t circle_common_area;
-    if(lv_area_intersect(&circle_common_area, circle_area, blend_area)) {
-        const lv_opa_t * circle_mask_tmp = circle_mask + width * (circle_common_area.y1 - circle_area->y1);
-        circle_mask_tmp += circle_common_area.x1 - circle_area->x1;
-
-        lv_opa_t * mask_buf_tmp = mask_buf + circle_common_area.x1 - blend_area->x1;
-
-        uint32_t x;
-        uint32_t w = lv_area_get_width(&circle_common_area);
-        for(x = 0; x < w; x++) {
-            uint32_t res = mask_buf_tmp[x] + circle_mask_tmp[x];
-            mask_buf_tmp[x] = res > 255 ? 255 : res;
-        }
-    }
-
-}
-
-static void get_rounded_area(int16_t angle, int32_t radius, uint8_t thickness, lv_area_t * res_area)
-{
-    int32_t thick_half = thickness / 2;
-    uint8_t thick_corr = (thickness & 0x01) ? 0 : 1;
-
-    int32_t cir_x;
-    int32_t cir_y;
-
-    cir_x = ((radius - thick_half) * lv_trigo_cos(angle)) >> (LV_TRIGO_SHIFT - 8);
-    cir_y = ((radius - thick_half) * lv_trigo_sin(angle)) >> (LV_TRIGO_SHIFT - 8);
-
-    /*The center of the pixel need to be calculated so apply 1/2 px offset*/
-    if(cir_x > 0) {
-        cir_x = (cir_x - 128) >> 8;
-        res_area->x1 = cir_x - thick_half + thick_corr;
-        res_area->x2 = cir_x + thick_half;
-    }
-    else {
-        cir_x = (cir_x + 128) >> 8;
-        res_area->x1 = cir_x - thick_half;
-        res_area->x2 = cir_x + thick_half - thick_corr;
-    }
-
-    if(cir_y > 0) {
-        cir_y = (cir_y - 128) >> 8;
-        res_area->y1 = cir_y - thick_half + thick_corr;
-        res_area->y2 = cir_y + thick_half;
-    }
-    else {
-        cir_y = (cir_y + 128) >> 8;
-        res_area->y1 = cir_y - thick_half;
-        res_area->y2 = cir_y + thick_half - thick_corr;
-    }
-}
-
 #else /*LV_DRAW_SW_COMPLEX*/
 
 void lv_draw_sw_arc(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_area_t * coords)
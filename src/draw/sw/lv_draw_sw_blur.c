@@ -22,6 +22,12 @@
 #define BLUR_INTENSITY_MAX (1 << 12)
 #define BLUR_INTENSITY_HALF ((1 << 12) / 2)
 
+/*Number of halving steps in the pyramid mode at most. On the lowest level 1 px covers 16x16 px.*/
+#define BLUR_PYRAMID_LEVEL_MAX 4
+
+/*Go one level lower only if the radius is still at least this large on that level*/
+#define BLUR_PYRAMID_RADIUS_MIN 4
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -41,6 +47,18 @@ static inline void blur_3_bytes(uint32_t * sum, volatile uint8_t * buf, uint32_t
 
 static int32_t get_rounded_edge_point(int32_t p_start, int32_t p_end, int32_t p, int32_t r);
 
+static bool blur_pyramid(lv_draw_task_t * t, const lv_area_t * coords, const lv_area_t * clipped_coords,
+                         int32_t blur_radius, int32_t corner_radius);
+static void pyramid_row_unpack(const uint8_t * src, uint8_t * dst, int32_t len, uint32_t px_size, bool swapped);
+static void pyramid_row_pack(const uint8_t * src, uint8_t * dst, int32_t len, uint32_t px_size, bool swapped);
+static void pyramid_downsample_rows(const uint8_t * row0, const uint8_t * row1, uint8_t * dst, int32_t src_w,
+                                    uint32_t ch);
+static inline void pyramid_upsample_px(const uint16_t * cur, const uint16_t * near, uint8_t * dst, uint32_t ch);
+static void pyramid_upsample_row(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t y, uint8_t * dst,
+                                 int32_t dst_w, uint32_t ch, uint16_t * tmp);
+static void pyramid_box_blur(uint8_t * buf, uint8_t * tmp, int32_t w, int32_t h, uint32_t ch, int32_t kr,
+                             int32_t * col_sum, uint8_t * pad_row);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -66,6 +84,20 @@ void lv_draw_sw_blur(lv_draw_task_t * t, const lv_draw_blur_dsc_t * dsc, const l
 
     uint32_t blur_radius = dsc->blur_radius;
 
+    int32_t radius = dsc->corner_radius;
+    int32_t w = lv_area_get_width(coords);
+    int32_t h = lv_area_get_height(coords);
+    int32_t short_side = LV_MIN(w, h);
+    if(radius > short_side >> 1) radius = short_side >> 1;
+
+    if(dsc->quality == LV_BLUR_QUALITY_PYRAMID) {
+        /*Falls back to the normal blur if the radius or the area is too small or out of memory*/
+        if(blur_pyramid(t, coords, &clipped_coords, blur_radius, radius)) {
+            LV_PROFILER_DRAW_END;
+            return;
+        }
+    }
+
     /*On larger radius skip some pixels as the result is a blob anyways, so not all pixels matter
      *This only every 2nd or 3rd px will be blurred, the result will be stored in the layers buffers,
      *and finally the missing pixels are set to nearest blurred pixel. We loose precision but it looks ok
@@ -100,11 +132,6 @@ void lv_draw_sw_blur(lv_draw_task_t * t, const lv_draw_blur_dsc_t * dsc, const l
     uint32_t intensity = (BLUR_INTENSITY_MAX * blur_radius) / (blur_radius + 4);
 
     int32_t sample_len = LV_MAX(blur_radius / 2, 1);
-    int32_t radius = dsc->corner_radius;
-    int32_t w = lv_area_get_width(coords);
-    int32_t h = lv_area_get_height(coords);
-    int32_t short_side = LV_MIN(w, h);
-    if(radius > short_side >> 1) radius = short_side >> 1;
 
     uint32_t px_size = lv_color_format_get_size(t->target_layer->draw_buf->header.cf);
     int32_t stride_byte = t->target_layer->draw_buf->header.stride;
@@ -498,5 +525,380 @@ static int32_t get_rounded_edge_point(int32_t p_start, int32_t p_end, int32_t p,
     return r - res;
 }
 
+/**
+ * Blur by halving the area a few times, blurring the smallest level with a separable box blur
+ * and scaling it back level by level with bilinear interpolation (dual filter).
+ * This way the cost of the blur hardly depends on the radius.
+ * The inner loops work on contiguous arrays with a fixed channel count and without clamping
+ * so that the compiler can vectorize them.
+ * @param t                 the draw task
+ * @param coords            the area to blur in absolute coordinates
+ * @param clipped_coords    the clipped area relative to the layer's buffer
+ * @param blur_radius       the blur radius
+ * @param corner_radius     the corner radius, already limited to the half of the shorter side
+ * @return                  true: the area is blurred; false: the area or radius is too small or out of memory
+ */
+static bool blur_pyramid(lv_draw_task_t * t, const lv_area_t * coords, const lv_area_t * clipped_coords,
+                         int32_t blur_radius, int32_t corner_radius)
+{
+    lv_draw_buf_t * draw_buf = t->target_layer->draw_buf;
+    int32_t level_w[BLUR_PYRAMID_LEVEL_MAX + 1];
+    int32_t level_h[BLUR_PYRAMID_LEVEL_MAX + 1];
+    level_w[0] = lv_area_get_width(clipped_coords);
+    level_h[0] = lv_area_get_height(clipped_coords);
+
+    int32_t level_cnt = 0;
+    while(level_cnt < BLUR_PYRAMID_LEVEL_MAX &&
+          (blur_radius >> (level_cnt + 1)) >= BLUR_PYRAMID_RADIUS_MIN &&
+          level_w[level_cnt] >= 2 * BLUR_PYRAMID_RADIUS_MIN &&
+          level_h[level_cnt] >= 2 * BLUR_PYRAMID_RADIUS_MIN) {
+        level_w[level_cnt + 1] = (level_w[level_cnt] + 1) >> 1;
+        level_h[level_cnt + 1] = (level_h[level_cnt] + 1) >> 1;
+        level_cnt++;
+    }
+    if(level_cnt == 0) return false;
+
+    uint32_t px_size = lv_color_format_get_size(draw_buf->header.cf);
+    bool swapped = draw_buf->header.cf == LV_COLOR_FORMAT_RGB565_SWAPPED;
+
+    /*Work with 8 bit channels. Colors are handled as 4 channels to have the same layout as 32 bit pixels.
+     *RGB565 is unpacked to 5, 6, 5 bits, the alpha channel is not written back.*/
+    uint32_t ch = px_size == 1 ? 1 : 4;
+    int32_t kr = LV_MAX((blur_radius >> level_cnt) >> 1, 1);
+    int32_t line_len = level_w[0] * ch;
+    int32_t low_len = level_w[level_cnt] * ch;
+    int32_t low_size = low_len * level_h[level_cnt];
+    int32_t pad_len = (level_w[level_cnt] + 2 * kr + 1) * ch;
+
+    /*Allocate everything at once. The 32 and 16 bit arrays come first to keep them aligned*/
+    size_t alloc_size = low_len * sizeof(int32_t) + line_len * sizeof(uint16_t) + line_len * 3 + pad_len + low_size;
+    int32_t l;
+    for(l = 1; l <= level_cnt; l++) alloc_size += level_w[l] * level_h[l] * ch;
+
+    uint8_t * mem = lv_malloc(alloc_size);
+    if(mem == NULL) {
+        LV_LOG_WARN("Couldn't allocate %d bytes, using the normal blur", (int)alloc_size);
+        return false;
+    }
+
+    int32_t * col_sum = (int32_t *)mem;
+    uint16_t * tmp16 = (uint16_t *)(mem + low_len * sizeof(int32_t));
+    uint8_t * row0 = (uint8_t *)(tmp16 + line_len);
+    uint8_t * row1 = row0 + line_len;
+    uint8_t * out_row = row1 + line_len;
+    uint8_t * pad_row = out_row + line_len;
+    uint8_t * blur_tmp = pad_row + pad_len;
+    uint8_t * level_buf[BLUR_PYRAMID_LEVEL_MAX + 1];
+    level_buf[0] = NULL; /*Level 0 is the layer itself*/
+    level_buf[1] = blur_tmp + low_size;
+    for(l = 2; l <= level_cnt; l++) level_buf[l] = level_buf[l - 1] + level_w[l - 1] * level_h[l - 1] * ch;
+
+    int32_t y;
+
+    /*Downsample the layer to level 1. 8 and 32 bit pixels can be used directly*/
+    for(y = 0; y < level_h[1]; y++) {
+        int32_t y0 = clipped_coords->y1 + y * 2;
+        int32_t y1 = LV_MIN(y0 + 1, clipped_coords->y2);
+        const uint8_t * src0 = lv_draw_buf_goto_xy(draw_buf, clipped_coords->x1, y0);
+        const uint8_t * src1 = lv_draw_buf_goto_xy(draw_buf, clipped_coords->x1, y1);
+        if(px_size != 1 && px_size != 4) {
+            pyramid_row_unpack(src0, row0, level_w[0], px_size, swapped);
+            pyramid_row_unpack(src1, row1, level_w[0], px_size, swapped);
+            src0 = row0;
+            src1 = row1;
+        }
+        pyramid_downsample_rows(src0, src1, &level_buf[1][y * level_w[1] * ch], level_w[0], ch);
+    }
+
+    /*Downsample further*/
+    for(l = 2; l <= level_cnt; l++) {
+        int32_t src_len = level_w[l - 1] * ch;
+        for(y = 0; y < level_h[l]; y++) {
+            int32_t y0 = y * 2;
+            int32_t y1 = LV_MIN(y0 + 1, level_h[l - 1] - 1);
+            pyramid_downsample_rows(&level_buf[l - 1][y0 * src_len], &level_buf[l - 1][y1 * src_len],
+                                    &level_buf[l][y * level_w[l] * ch], level_w[l - 1], ch);
+        }
+    }
+
+    /*Blur the lowest level. Two box blurs are already close to a gaussian blur*/
+    pyramid_box_blur(level_buf[level_cnt], blur_tmp, level_w[level_cnt], level_h[level_cnt], ch, kr, col_sum, pad_row);
+    pyramid_box_blur(level_buf[level_cnt], blur_tmp, level_w[level_cnt], level_h[level_cnt], ch, kr, col_sum, pad_row);
+
+    /*Upsample to level 1*/
+    for(l = level_cnt - 1; l >= 1; l--) {
+        for(y = 0; y < level_h[l]; y++) {
+            pyramid_upsample_row(level_buf[l + 1], level_w[l + 1], level_h[l + 1], y,
+                                 &level_buf[l][y * level_w[l] * ch], level_w[l], ch, tmp16);
+        }
+    }
+
+    /*Upsample to the layer. Leave the pixels outside of the rounded corners untouched*/
+    int32_t layer_x_ofs = t->target_layer->buf_area.x1;
+    int32_t layer_y_ofs = t->target_layer->buf_area.y1;
+    for(y = 0; y < level_h[0]; y++) {
+        int32_t layer_y = clipped_coords->y1 + y;
+        int32_t cir_x = get_rounded_edge_point(coords->y1, coords->y2, layer_y_ofs + layer_y, corner_radius);
+        int32_t x_start = LV_CLAMP(clipped_coords->x1, coords->x1 - layer_x_ofs + cir_x, clipped_coords->x2);
+        int32_t x_end = LV_CLAMP(clipped_coords->x1, coords->x2 - layer_x_ofs - cir_x, clipped_coords->x2);
+        if(x_start > x_end) continue;
+
+        pyramid_upsample_row(level_buf[1], level_w[1], level_h[1], y, out_row, level_w[0], ch, tmp16);
+        pyramid_row_pack(&out_row[(x_start - clipped_coords->x1) * ch], lv_draw_buf_goto_xy(draw_buf, x_start, layer_y),
+                         x_end - x_start + 1, px_size, swapped);
+    }
+
+    lv_free(mem);
+
+    return true;
+}
+
+/**
+ * Convert 16 or 24 bit pixels of the layer to 4 channels
+ * @param src       pointer to the first pixel in the layer
+ * @param dst       store the channels here
+ * @param len       number of pixels
+ * @param px_size   size of a pixel in the layer in bytes (2 or 3)
+ * @param swapped   true: the layer is RGB565_SWAPPED
+ */
+static void pyramid_row_unpack(const uint8_t * src, uint8_t * dst, int32_t len, uint32_t px_size, bool swapped)
+{
+    int32_t x;
+    if(px_size == 2) {
+        const uint16_t * src16 = (const uint16_t *)src;
+        for(x = 0; x < len; x++) {
+            uint16_t px = src16[x];
+            if(swapped) px = (px >> 8) | (px << 8);
+            dst[x * 4 + 0] = px & 0x1F;
+            dst[x * 4 + 1] = (px >> 5) & 0x3F;
+            dst[x * 4 + 2] = px >> 11;
+            dst[x * 4 + 3] = 0;
+        }
+    }
+    else {
+        for(x = 0; x < len; x++) {
+            dst[x * 4 + 0] = src[x * 3 + 0];
+            dst[x * 4 + 1] = src[x * 3 + 1];
+            dst[x * 4 + 2] = src[x * 3 + 2];
+            dst[x * 4 + 3] = 0;
+        }
+    }
+}
+
+/**
+ * Write the channels back to the layer. The alpha channel of the layer is kept.
+ * @param src       pointer to the channels
+ * @param dst       pointer to the first pixel in the layer
+ * @param len       number of pixels
+ * @param px_size   size of a pixel in the layer in bytes
+ * @param swapped   true: the layer is RGB565_SWAPPED
+ */
+static void pyramid_row_pack(const uint8_t * src, uint8_t * dst, int32_t len, uint32_t px_size, bool swapped)
+{
+    int32_t x;
+    if(px_size == 1) {
+        lv_memcpy(dst, src, len);
+    }
+    else if(px_size == 2) {
+        uint16_t * dst16 = (uint16_t *)dst;
+        for(x = 0; x < len; x++) {
+            uint16_t px = (uint16_t)((src[x * 4 + 2] << 11) | (src[x * 4 + 1] << 5) | src[x * 4 + 0]);
+            if(swapped) px = (px >> 8) | (px << 8);
+            dst16[x] = px;
+        }
+    }
+    else {
+        for(x = 0; x < len; x++) {
+            dst[x * px_size + 0] = src[x * 4 + 0];
+            dst[x * px_size + 1] = src[x * 4 + 1];
+            dst[x * px_size + 2] = src[x * 4 + 2];
+        }
+    }
+}
+
+/**
+ * Average 2x2 pixels of two rows into one row
+ * @param row0      the upper row
+ * @param row1      the lower row
+ * @param dst       store the result here. Its width is `(src_w + 1) / 2`
+ * @param src_w     width of the source rows in pixels
+ * @param ch        number of channels per pixel (1 or 4)
+ */
+static void pyramid_downsample_rows(const uint8_t * row0, const uint8_t * row1, uint8_t * dst, int32_t src_w,
+                                    uint32_t ch)
+{
+    /*Handle the channel counts separately so that the inner loops have a fixed length*/
+    int32_t pair_cnt = src_w >> 1;
+    int32_t x;
+    uint32_t c;
+    if(ch == 1) {
+        for(x = 0; x < pair_cnt; x++) {
+            dst[x] = (uint8_t)((row0[x * 2] + row0[x * 2 + 1] + row1[x * 2] + row1[x * 2 + 1] + 2) >> 2);
+        }
+    }
+    else {
+        for(x = 0; x < pair_cnt; x++) {
+            for(c = 0; c < 4; c++) {
+                dst[x * 4 + c] = (uint8_t)((row0[x * 8 + c] + row0[x * 8 + 4 + c] +
+                                            row1[x * 8 + c] + row1[x * 8 + 4 + c] + 2) >> 2);
+            }
+        }
+    }
+
+    /*The last pixel has no pair on odd width*/
+    if(src_w & 1) {
+        int32_t k = (src_w - 1) * ch;
+        for(c = 0; c < ch; c++) {
+            dst[pair_cnt * ch + c] = (uint8_t)((row0[k + c] + row1[k + c] + 1) >> 1);
+        }
+    }
+}
+
+/**
+ * Mix a pixel with its neighbor at 1/4 distance. Used on the edges of the upscaled rows.
+ * @param cur       channels of the pixel
+ * @param near      channels of the neighbor pixel
+ * @param dst       store the result here
+ * @param ch        number of channels per pixel
+ */
+static inline void pyramid_upsample_px(const uint16_t * cur, const uint16_t * near, uint8_t * dst, uint32_t ch)
+{
+    uint32_t c;
+    for(c = 0; c < ch; c++) {
+        dst[c] = (uint8_t)((cur[c] * 3 + near[c] + 8) >> 4);
+    }
+}
+
+/**
+ * Get a row of the 2x upscaled image with bilinear interpolation
+ * @param src       the source image
+ * @param src_w     width of the source image
+ * @param src_h     height of the source image
+ * @param y         the row to get on the upscaled image
+ * @param dst       store the row here
+ * @param dst_w     width of the upscaled image. `src_w * 2` or `src_w * 2 - 1`
+ * @param ch        number of channels per pixel (1 or 4)
+ * @param tmp       buffer for `src_w * ch` elements
+ */
+static void pyramid_upsample_row(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t y, uint8_t * dst,
+                                 int32_t dst_w, uint32_t ch, uint16_t * tmp)
+{
+    /*The upscaled pixels are at 1/4 and 3/4 between the source pixels.
+     *Mix the rows first, and the pixels of the mixed row after that.*/
+    int32_t len = src_w * ch;
+    int32_t sy = y >> 1;
+    int32_t sy_near = (y & 1) ? LV_MIN(sy + 1, src_h - 1) : LV_MAX(sy - 1, 0);
+    const uint8_t * row = &src[sy * len];
+    const uint8_t * row_near = &src[sy_near * len];
+    int32_t k;
+    for(k = 0; k < len; k++) {
+        tmp[k] = row[k] * 3 + row_near[k];
+    }
+
+    /*Every source pixel gives a left and a right pixel. Handle the edges separately
+     *to have no clamping in the loop of the inner pixels.*/
+    int32_t last = src_w - 1;
+    pyramid_upsample_px(&tmp[0], &tmp[0], &dst[0], ch);
+    if(dst_w > 1) pyramid_upsample_px(&tmp[0], &tmp[LV_MIN(1, last) * ch], &dst[ch], ch);
+
+    int32_t sx;
+    uint32_t c;
+    if(ch == 1) {
+        for(sx = 1; sx < last; sx++) {
+            int32_t a = tmp[sx] * 3 + 8;
+            dst[sx * 2] = (uint8_t)((a + tmp[sx - 1]) >> 4);
+            dst[sx * 2 + 1] = (uint8_t)((a + tmp[sx + 1]) >> 4);
+        }
+    }
+    else {
+        for(sx = 1; sx < last; sx++) {
+            for(c = 0; c < 4; c++) {
+                int32_t a = tmp[sx * 4 + c] * 3 + 8;
+                dst[sx * 8 + c] = (uint8_t)((a + tmp[sx * 4 - 4 + c]) >> 4);
+                dst[sx * 8 + 4 + c] = (uint8_t)((a + tmp[sx * 4 + 4 + c]) >> 4);
+            }
+        }
+    }
+
+    if(last > 0) {
+        pyramid_upsample_px(&tmp[last * ch], &tmp[(last - 1) * ch], &dst[last * 2 * ch], ch);
+        if(last * 2 + 1 < dst_w) pyramid_upsample_px(&tmp[last * ch], &tmp[last * ch], &dst[(last * 2 + 1) * ch], ch);
+    }
+}
+
+/**
+ * Blur an image with a box filter horizontally and vertically
+ * @param buf       the image to blur, the result is stored here too
+ * @param tmp       buffer with the same size as the image
+ * @param w         width of the image
+ * @param h         height of the image
+ * @param ch        number of channels per pixel (1 or 4)
+ * @param kr        the radius of the box. The box is `2 * kr + 1` pixels large
+ * @param col_sum   buffer for `w * ch` elements
+ * @param pad_row   buffer for `(w + 2 * kr + 1) * ch` elements
+ */
+static void pyramid_box_blur(uint8_t * buf, uint8_t * tmp, int32_t w, int32_t h, uint32_t ch, int32_t kr,
+                             int32_t * col_sum, uint8_t * pad_row)
+{
+    /*Divide by the box size with a multiplication*/
+    uint32_t mul = (1 << 16) / (2 * kr + 1);
+    int32_t len = w * ch;
+    int32_t x;
+    int32_t y;
+    int32_t i;
+    int32_t k;
+    uint32_t c;
+
+    /*Rows from `buf` to `tmp` with a sliding sum. The row is padded by repeating the edge pixels
+     *so that the window never needs to be clamped*/
+    for(y = 0; y < h; y++) {
+        const uint8_t * src = &buf[y * len];
+        uint8_t * dst = &tmp[y * len];
+        for(i = 0; i <= kr; i++) lv_memcpy(&pad_row[i * ch], &src[0], ch);
+        lv_memcpy(&pad_row[(kr + 1) * ch], src, len);
+        for(i = 0; i < kr; i++) lv_memcpy(&pad_row[(kr + 1 + w + i) * ch], &src[len - ch], ch);
+
+        uint32_t sum[4] = {0};
+        for(i = 0; i < 2 * kr + 1; i++) {
+            for(c = 0; c < ch; c++) sum[c] += pad_row[i * ch + c];
+        }
+
+        const uint8_t * add = &pad_row[(2 * kr + 1) * ch];
+        if(ch == 1) {
+            for(x = 0; x < w; x++) {
+                sum[0] += add[x] - pad_row[x];
+                dst[x] = (uint8_t)((sum[0] * mul + 0x8000) >> 16);
+            }
+        }
+        else {
+            for(x = 0; x < w; x++) {
+                for(c = 0; c < 4; c++) {
+                    sum[c] += add[x * 4 + c] - pad_row[x * 4 + c];
+                    dst[x * 4 + c] = (uint8_t)((sum[c] * mul + 0x8000) >> 16);
+                }
+            }
+        }
+    }
+
+    /*Columns from `tmp` to `buf`. Slide the sums of all columns together to process whole rows*/
+    lv_memzero(col_sum, len * sizeof(int32_t));
+    for(i = -kr; i <= kr; i++) {
+        const uint8_t * src = &tmp[LV_CLAMP(0, i, h - 1) * len];
+        for(k = 0; k < len; k++) {
+            col_sum[k] += src[k];
+        }
+    }
+
+    for(y = 0; y < h; y++) {
+        const uint8_t * top = &tmp[LV_MAX(y - kr, 0) * len];
+        const uint8_t * bottom = &tmp[LV_MIN(y + kr + 1, h - 1) * len];
+        uint8_t * dst = &buf[y * len];
+        for(k = 0; k < len; k++) {
+            uint32_t v = col_sum[k];
+            dst[k] = (uint8_t)((v * mul + 0x8000) >> 16);
+            col_sum[k] = v + bottom[k] - top[k];
+        }
+    }
+}
 
 #endif /*LV_USE_DRAW_SW*/
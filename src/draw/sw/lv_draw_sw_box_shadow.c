@@ -15,6 +15,7 @@
 #if LV_DRAW_SW_COMPLEX
 
 #include "blend/lv_draw_sw_blend_private.h"
+#include "lv_draw_sw_private.h"
 #include "../../core/lv_global.h"
 
 /*********************
@@ -38,6 +39,14 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(const lv_area_t *
                                                                int32_t r);
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf);
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    static lv_cache_compare_res_t shadow_cache_compare_cb(const lv_draw_sw_shadow_cache_data_t * lhs,
+                                                          const lv_draw_sw_shadow_cache_data_t * rhs);
+    static uint32_t shadow_cache_hash_cb(const lv_draw_sw_shadow_cache_data_t * data);
+    static bool shadow_cache_create_cb(lv_draw_sw_shadow_cache_data_t * data, void * user_data);
+    static void shadow_cache_free_cb(lv_draw_sw_shadow_cache_data_t * data, void * user_data);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -50,6 +59,26 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t
  *   GLOBAL FUNCTIONS
  **********************/
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+void lv_draw_sw_shadow_cache_init(void)
+{
+    shadow_cache = lv_cache_create(&lv_cache_class_lru_ht_count, sizeof(lv_draw_sw_shadow_cache_data_t),
+    LV_DRAW_SW_SHADOW_CACHE_CNT, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) shadow_cache_compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t) shadow_cache_hash_cb,
+        .create_cb = (lv_cache_create_cb_t) shadow_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) shadow_cache_free_cb,
+    });
+    lv_cache_set_name(shadow_cache, "SW_SHADOW");
+}
+
+void lv_draw_sw_shadow_cache_deinit(void)
+{
+    lv_cache_destroy(shadow_cache, NULL);
+    shadow_cache = NULL;
+}
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+
 void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords)
 {
     /*Calculate the rectangle which is blurred to get the shadow in `shadow_area`*/
@@ -95,12 +124,23 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     lv_opa_t * sh_buf;
 
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
-    lv_draw_sw_shadow_cache_t * cache = &shadow_cache;
-    if(cache->cache_size == corner_size && cache->cache_r == r_sh) {
-        /*Use the cache if available*/
-        sh_buf = lv_malloc(corner_size * corner_size);
+    /*The far edges of the core area don't affect the corner if they are at least `corner_size + r_sh` away*/
+    lv_draw_sw_shadow_cache_data_t search_key = {
+        .w = LV_MIN(lv_area_get_width(&core_area), corner_size + r_sh),
+        .h = LV_MIN(lv_area_get_height(&core_area), corner_size + r_sh),
+        .r = r_sh,
+        .sw = dsc->width,
+    };
+
+    lv_cache_entry_t * entry = shadow_cache ? lv_cache_acquire(shadow_cache, &search_key, NULL) : NULL;
+    if(entry) {
+        /*Copy the cached corner. Keep the same size as when it's calculated, because the
+         *corners are blended from full lines of the buffer.*/
+        lv_draw_sw_shadow_cache_data_t * cached = lv_cache_entry_get_data(entry);
+        sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
         LV_ASSERT_MALLOC(sh_buf);
-        lv_memcpy(sh_buf, cache->cache, corner_size * corner_size);
+        lv_memcpy(sh_buf, cached->buf, corner_size * corner_size);
+        lv_cache_release(shadow_cache, entry, NULL);
     }
     else {
         /*A larger buffer is required for calculation*/
@@ -108,11 +148,11 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
         LV_ASSERT_MALLOC(sh_buf);
         shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
 
-        /*Cache the corner if it fits into the cache size*/
-        if((uint32_t)corner_size * corner_size < sizeof(cache->cache)) {
-            lv_memcpy(cache->cache, sh_buf, corner_size * corner_size);
-            cache->cache_size = corner_size;
-            cache->cache_r = r_sh;
+        /*Cache the corner if it's not too large. If an other draw thread has added
+         *the same corner in the meantime that one is acquired instead.*/
+        if(shadow_cache && corner_size <= LV_DRAW_SW_SHADOW_CACHE_SIZE) {
+            entry = lv_cache_acquire_or_create(shadow_cache, &search_key, sh_buf);
+            if(entry) lv_cache_release(shadow_cache, entry, NULL);
         }
     }
 #else
@@ -696,35 +736,93 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(int32_t size, int32_t sw, u
         else sh_ups_buf[i] = sh_ups_buf[i] / sw;
     }
 
+    /*Process the image row by row and keep a running sum for each column.
+     *The inner loops are branchless and work on consecutive memory, so
+     *the compiler can vectorize them with SIMD instructions (NEON, SSE, etc)*/
+    int32_t * col_sum = lv_malloc(size * sizeof(int32_t));
+    LV_ASSERT_MALLOC(col_sum);
+
+    /*The source rows are read until `s_right` rows later, so the results are
+     *stored in a ring buffer and written back with `s_right` rows delay*/
+    int32_t ring_rows = s_right + 1;
+    uint16_t * ring_buf = lv_malloc(ring_rows * size * sizeof(uint16_t));
+    LV_ASSERT_MALLOC(ring_buf);
+
     for(x = 0; x < size; x++) {
-        sh_ups_tmp_buf = &sh_ups_buf[x];
-        int32_t v = sh_ups_tmp_buf[0] * sw;
-        for(y = 0; y < size ; y++, sh_ups_tmp_buf += size) {
-            sh_ups_blur_buf[y] = v < 0 ? 0 : (v >> SHADOW_UPSCALE_SHIFT);
-
-            /*Forget the top pixel*/
-            uint32_t top_val;
-            if(y - s_right <= 0) top_val = sh_ups_tmp_buf[0];
-            else top_val = sh_ups_buf[(y - s_right) * size + x];
-            v -= top_val;
-
-            /*Add the bottom pixel*/
-            uint32_t bottom_val;
-            if(y + s_left + 1 < size) bottom_val = sh_ups_buf[(y + s_left + 1) * size + x];
-            else bottom_val = sh_ups_buf[(size - 1) * size + x];
-            v += bottom_val;
+        col_sum[x] = sh_ups_buf[x] * sw;
+    }
+
+    for(y = 0; y < size; y++) {
+        /*Forget the top row*/
+        const uint16_t * top_row = y - s_right <= 0 ? &sh_ups_buf[y * size] : &sh_ups_buf[(y - s_right) * size];
+        /*Add the bottom row*/
+        const uint16_t * bottom_row = y + s_left + 1 < size ? &sh_ups_buf[(y + s_left + 1) * size] :
+                                      &sh_ups_buf[(size - 1) * size];
+        uint16_t * res_row = &ring_buf[(y % ring_rows) * size];
+
+        for(x = 0; x < size; x++) {
+            int32_t v = col_sum[x];
+            res_row[x] = v < 0 ? 0 : (v >> SHADOW_UPSCALE_SHIFT);
+            col_sum[x] = v - top_row[x] + bottom_row[x];
         }
 
-        /*Write back the result into `sh_ups_buf`*/
-        sh_ups_tmp_buf = &sh_ups_buf[x];
-        for(y = 0; y < size; y++, sh_ups_tmp_buf += size) {
-            (*sh_ups_tmp_buf) = sh_ups_blur_buf[y];
+        /*The row `s_right` above is not read anymore, write back its result*/
+        if(y - s_right >= 0) {
+            int32_t done_y = y - s_right;
+            lv_memcpy(&sh_ups_buf[done_y * size], &ring_buf[(done_y % ring_rows) * size], size * sizeof(uint16_t));
         }
     }
 
+    /*Write back the remaining rows*/
+    for(y = LV_MAX(size - s_right, 0); y < size; y++) {
+        lv_memcpy(&sh_ups_buf[y * size], &ring_buf[(y % ring_rows) * size], size * sizeof(uint16_t));
+    }
+
+    lv_free(ring_buf);
+    lv_free(col_sum);
     lv_free(sh_ups_blur_buf);
 }
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+
+static lv_cache_compare_res_t shadow_cache_compare_cb(const lv_draw_sw_shadow_cache_data_t * lhs,
+                                                      const lv_draw_sw_shadow_cache_data_t * rhs)
+{
+    if(lhs->sw != rhs->sw) return lhs->sw > rhs->sw ? 1 : -1;
+    if(lhs->r != rhs->r) return lhs->r > rhs->r ? 1 : -1;
+    if(lhs->w != rhs->w) return lhs->w > rhs->w ? 1 : -1;
+    if(lhs->h != rhs->h) return lhs->h > rhs->h ? 1 : -1;
+    return 0;
+}
+
+static uint32_t shadow_cache_hash_cb(const lv_draw_sw_shadow_cache_data_t * data)
+{
+    uint32_t hash = lv_cache_hash_data(&data->sw, sizeof(data->sw), LV_CACHE_HASH_SEED);
+    hash = lv_cache_hash_data(&data->r, sizeof(data->r), hash);
+    hash = lv_cache_hash_data(&data->w, sizeof(data->w), hash);
+    return lv_cache_hash_data(&data->h, sizeof(data->h), hash);
+}
+
+static bool shadow_cache_create_cb(lv_draw_sw_shadow_cache_data_t * data, void * user_data)
+{
+    /*`user_data` is the freshly calculated corner*/
+    uint32_t buf_size = (data->sw + data->r) * (data->sw + data->r);
+    data->buf = lv_malloc(buf_size);
+    if(data->buf == NULL) return false;
+
+    lv_memcpy(data->buf, user_data, buf_size);
+    return true;
+}
+
+static void shadow_cache_free_cb(lv_draw_sw_shadow_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(data->buf);
+    data->buf = NULL;
+}
+
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+
 #else /*LV_DRAW_SW_COMPLEX*/
 
 void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords)
@@ -9,7 +9,9 @@
 #include "lv_draw_sw_grad.h"
 #if LV_USE_DRAW_SW
 
+#include "lv_draw_sw_private.h"
 #include "../../osal/lv_os_private.h"
+#include "../../core/lv_global.h"
 
 /*********************
  *      DEFINES
@@ -24,6 +26,13 @@
     #define ALIGN(X)    (((X) + 3) & ~3)
 #endif
 
+#if LV_DRAW_SW_GRAD_CACHE_CNT
+    #define grad_cache LV_GLOBAL_DEFAULT()->sw_grad_cache
+#endif
+
+/*The complex gradients calculate the color map indices in chunks of this many pixels*/
+#define GRAD_LINE_CHUNK     64
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -70,12 +79,23 @@ typedef struct {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-typedef lv_result_t (*op_cache_t)(lv_draw_sw_grad_calc_t * c, void * ctx);
-static lv_draw_sw_grad_calc_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h);
+static lv_draw_sw_grad_calc_t * allocate_item(int32_t size);
+static lv_draw_sw_grad_calc_t * grad_map_get(const lv_grad_dsc_t * g, int32_t size);
+static void grad_map_calculate(const lv_grad_dsc_t * g, lv_draw_sw_grad_calc_t * item);
+
+#if LV_DRAW_SW_GRAD_CACHE_CNT
+    static lv_cache_compare_res_t grad_cache_compare_cb(const lv_draw_sw_grad_cache_data_t * lhs,
+                                                        const lv_draw_sw_grad_cache_data_t * rhs);
+    static uint32_t grad_cache_hash_cb(const lv_draw_sw_grad_cache_data_t * data);
+    static bool grad_cache_create_cb(lv_draw_sw_grad_cache_data_t * data, void * user_data);
+    static void grad_cache_free_cb(lv_draw_sw_grad_cache_data_t * data, void * user_data);
+#endif
 
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
-    static inline int32_t extend_w(int32_t w, lv_grad_extend_t extend);
+    static void extend_w_line(int32_t * w, int32_t len, lv_grad_extend_t extend);
+    static void map_line(const lv_draw_sw_grad_calc_t * grad, const int32_t * w, int32_t len,
+                         lv_color_t * buf, lv_opa_t * opa);
 
 #endif
 
@@ -87,23 +107,8 @@ static lv_draw_sw_grad_calc_t * allocate_item(const lv_grad_dsc_t * g, int32_t w
  *   STATIC FUNCTIONS
  **********************/
 
-static lv_draw_sw_grad_calc_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h)
+static lv_draw_sw_grad_calc_t * allocate_item(int32_t size)
 {
-    int32_t size;
-    switch(g->dir) {
-        case LV_GRAD_DIR_HOR:
-        case LV_GRAD_DIR_LINEAR:
-        case LV_GRAD_DIR_RADIAL:
-        case LV_GRAD_DIR_CONICAL:
-            size = w;
-            break;
-        case LV_GRAD_DIR_VER:
-            size = h;
-            break;
-        default:
-            size = 64;
-    }
-
     size_t req_size = ALIGN(sizeof(lv_draw_sw_grad_calc_t)) + ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(
                                                                                                            lv_opa_t));
     lv_draw_sw_grad_calc_t * item  = lv_malloc(req_size);
@@ -114,24 +119,130 @@ static lv_draw_sw_grad_calc_t * allocate_item(const lv_grad_dsc_t * g, int32_t w
     item->color_map = (lv_color_t *)(p + ALIGN(sizeof(*item)));
     item->opa_map = (lv_opa_t *)(p + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_color_t)));
     item->size = size;
+    item->cache_entry = NULL;
+    return item;
+}
+
+static void grad_map_calculate(const lv_grad_dsc_t * g, lv_draw_sw_grad_calc_t * item)
+{
+    uint32_t i;
+    for(i = 0; i < item->size; i++) {
+        lv_draw_sw_grad_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
+    }
+}
+
+/**
+ * Get a `size` long color map of a gradient from the cache or calculate it if not cached.
+ * The result needs to be released with `lv_draw_sw_grad_cleanup`.
+ */
+static lv_draw_sw_grad_calc_t * grad_map_get(const lv_grad_dsc_t * g, int32_t size)
+{
+#if LV_DRAW_SW_GRAD_CACHE_CNT
+    if(grad_cache && g->stops_count <= LV_GRADIENT_MAX_STOPS) {
+        lv_draw_sw_grad_cache_data_t search_key;
+        lv_memcpy(search_key.stops, g->stops, g->stops_count * sizeof(lv_grad_stop_t));
+        search_key.stops_count = g->stops_count;
+        search_key.size = size;
+        search_key.calc = NULL;
+
+        /*If an other draw thread creates the same map in the meantime, that one is acquired*/
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(grad_cache, &search_key, (void *)g);
+        if(entry) {
+            lv_draw_sw_grad_cache_data_t * cached = lv_cache_entry_get_data(entry);
+            return cached->calc;
+        }
+        /*The cache is full with maps in use, so calculate it without caching*/
+    }
+#endif
+
+    lv_draw_sw_grad_calc_t * item = allocate_item(size);
+    if(item == NULL) {
+        LV_LOG_WARN("Failed to allocate item for the gradient");
+        return NULL;
+    }
+
+    grad_map_calculate(g, item);
     return item;
 }
 
+#if LV_DRAW_SW_GRAD_CACHE_CNT
+
+static lv_cache_compare_res_t grad_cache_compare_cb(const lv_draw_sw_grad_cache_data_t * lhs,
+                                                    const lv_draw_sw_grad_cache_data_t * rhs)
+{
+    if(lhs->size != rhs->size) return lhs->size > rhs->size ? 1 : -1;
+    if(lhs->stops_count != rhs->stops_count) return lhs->stops_count > rhs->stops_count ? 1 : -1;
+
+    int32_t cmp_res = lv_memcmp(lhs->stops, rhs->stops, lhs->stops_count * sizeof(lv_grad_stop_t));
+    if(cmp_res != 0) return cmp_res > 0 ? 1 : -1;
+
+    return 0;
+}
+
+static uint32_t grad_cache_hash_cb(const lv_draw_sw_grad_cache_data_t * data)
+{
+    uint32_t hash = lv_cache_hash_data(&data->size, sizeof(data->size), LV_CACHE_HASH_SEED);
+    return lv_cache_hash_data(data->stops, data->stops_count * sizeof(lv_grad_stop_t), hash);
+}
+
+static bool grad_cache_create_cb(lv_draw_sw_grad_cache_data_t * data, void * user_data)
+{
+    const lv_grad_dsc_t * g = user_data;
+    data->calc = allocate_item(data->size);
+    if(data->calc == NULL) return false;
+
+    grad_map_calculate(g, data->calc);
+    data->calc->cache_entry = lv_cache_entry_get_entry(data, sizeof(lv_draw_sw_grad_cache_data_t));
+    return true;
+}
+
+static void grad_cache_free_cb(lv_draw_sw_grad_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(data->calc);
+    data->calc = NULL;
+}
+
+#endif /*LV_DRAW_SW_GRAD_CACHE_CNT*/
+
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
-static inline int32_t extend_w(int32_t w, lv_grad_extend_t extend)
+/**
+ * Apply the extend mode on a line of color map indices.
+ * The mode is checked only once per line so that the loops are branchless and can be vectorized.
+ */
+static void extend_w_line(int32_t * w, int32_t len, lv_grad_extend_t extend)
 {
+    int32_t i;
     if(extend == LV_GRAD_EXTEND_PAD) {                  /**< Repeat the same color*/
-        return w < 0 ? 0 : LV_MIN(w, 255);
+        for(i = 0; i < len; i++) {
+            int32_t v = w[i] < 0 ? 0 : w[i];
+            w[i] = v > 255 ? 255 : v;
+        }
     }
-    if(extend == LV_GRAD_EXTEND_REPEAT) {       /**< Repeat the pattern*/
-        return w & 255;
+    else if(extend == LV_GRAD_EXTEND_REPEAT) {          /**< Repeat the pattern*/
+        for(i = 0; i < len; i++) {
+            w[i] &= 255;
+        }
+    }
+    else {                                              /*LV_GRAD_EXTEND_REFLECT*/
+        for(i = 0; i < len; i++) {
+            int32_t v = w[i] & 511;
+            w[i] = v ^ ((v >> 8) * 511);                /* 511 - w if w > 255 */
+        }
+    }
+}
+
+static void map_line(const lv_draw_sw_grad_calc_t * grad, const int32_t * w, int32_t len,
+                     lv_color_t * buf, lv_opa_t * opa)
+{
+    const lv_color_t * color_map = grad->color_map;
+    const lv_opa_t * opa_map = grad->opa_map;
+    int32_t i;
+    for(i = 0; i < len; i++) {
+        buf[i] = color_map[w[i]];
+        opa[i] = opa_map[w[i]];
     }
-    /*LV_GRAD_EXTEND_REFLECT*/
-    w &= 511;
-    if(w > 255)
-        w ^= 511;   /* 511 - w */
-    return w;
 }
 
 #endif
@@ -140,24 +251,47 @@ static inline int32_t extend_w(int32_t w, lv_grad_extend_t extend)
  *     FUNCTIONS
  **********************/
 
+#if LV_DRAW_SW_GRAD_CACHE_CNT
+void lv_draw_sw_grad_cache_init(void)
+{
+    grad_cache = lv_cache_create(&lv_cache_class_lru_ht_count, sizeof(lv_draw_sw_grad_cache_data_t),
+    LV_DRAW_SW_GRAD_CACHE_CNT, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) grad_cache_compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t) grad_cache_hash_cb,
+        .create_cb = (lv_cache_create_cb_t) grad_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) grad_cache_free_cb,
+    });
+    lv_cache_set_name(grad_cache, "SW_GRADIENT");
+}
+
+void lv_draw_sw_grad_cache_deinit(void)
+{
+    lv_cache_destroy(grad_cache, NULL);
+    grad_cache = NULL;
+}
+#endif /*LV_DRAW_SW_GRAD_CACHE_CNT*/
+
 lv_draw_sw_grad_calc_t * lv_draw_sw_grad_get(const lv_grad_dsc_t * g, int32_t w, int32_t h)
 {
     /* No gradient, no cache */
     if(g->dir == LV_GRAD_DIR_NONE) return NULL;
 
-    /* Step 1: Search cache for the given key */
-    lv_draw_sw_grad_calc_t * item = allocate_item(g, w, h);
-    if(item == NULL) {
-        LV_LOG_WARN("Failed to allocate item for the gradient");
-        return item;
-    }
-
-    /* Step 3: Fill it with the gradient, as expected */
-    uint32_t i;
-    for(i = 0; i < item->size; i++) {
-        lv_draw_sw_grad_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
+    switch(g->dir) {
+        case LV_GRAD_DIR_HOR:
+            return grad_map_get(g, w);
+        case LV_GRAD_DIR_VER:
+            return grad_map_get(g, h);
+        case LV_GRAD_DIR_LINEAR:
+        case LV_GRAD_DIR_RADIAL:
+        case LV_GRAD_DIR_CONICAL: {
+                /*The lines are calculated by the `..._get_line` functions, just allocate a line buffer*/
+                lv_draw_sw_grad_calc_t * item = allocate_item(w);
+                if(item == NULL) LV_LOG_WARN("Failed to allocate item for the gradient");
+                return item;
+            }
+        default:
+            return grad_map_get(g, 64);
     }
-    return item;
 }
 
 void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_grad_color_calculate(const lv_grad_dsc_t * dsc, int32_t range,
@@ -215,6 +349,12 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_grad_color_calculate(const lv_grad_dsc_t *
 
 void lv_draw_sw_grad_cleanup(lv_draw_sw_grad_calc_t * grad)
 {
+#if LV_DRAW_SW_GRAD_CACHE_CNT
+    if(grad->cache_entry) {
+        lv_cache_release(grad_cache, grad->cache_entry, NULL);
+        return;
+    }
+#endif
     lv_free(grad);
 }
 
@@ -293,7 +433,7 @@ void lv_draw_sw_grad_radial_setup(lv_grad_dsc_t * dsc, const lv_area_t * coords)
     LV_ASSERT(r_end != 0);
 
     /* Create gradient color map */
-    state->cgrad = lv_draw_sw_grad_get(dsc, 256, 0);
+    state->cgrad = grad_map_get(dsc, 256);
 
     state->x0 = start.x;
     state->y0 = start.y;
@@ -353,7 +493,6 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_grad_radial_get_line(lv_grad_dsc_t * dsc,
     lv_opa_t * opa = result->opa_map;
     lv_draw_sw_grad_calc_t * grad = state->cgrad;
 
-    int32_t w;  /* the result: this is an offset into the 256 element gradient color table */
     int32_t b, db, c, dc;
 
     /* check for possible clipping */
@@ -391,42 +530,47 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_grad_radial_get_line(lv_grad_dsc_t * dsc,
     db = state->dx << 1;
     dc = ((xp - state->x0) << 1) + 1;
 
-    if(state->a4 == 0) {   /* not a quadratic equation: solve linear equation: w = -c/b */
-        for(; width > 0; width--) {
-            w = extend_w(b == 0 ? 0 : -(c << 8) / b, dsc->extend);
-            *buf++ = grad->color_map[w];
-            *opa++ = grad->opa_map[w];
-            b += db;
-            c -= dc;
-            dc += 2;
+    /* special case: concentric circles: w = (sqrt((xp-x0)^2 + (yx-y0)^2)-r0)/(r1-r0) */
+    bool concentric = state->a4 != 0 && state->bpx == 0 && state->bpy == 0;
+    if(concentric) c = lv_sqr(xp - state->x0) + lv_sqr(yp - state->y0);
+
+    /* Calculate the color map indices in chunks and look up the colors together */
+    int32_t w_buf[GRAD_LINE_CHUNK];
+    while(width > 0) {
+        int32_t len = LV_MIN(width, GRAD_LINE_CHUNK);
+        int32_t i;
+        if(state->a4 == 0) {   /* not a quadratic equation: solve linear equation: w = -c/b */
+            for(i = 0; i < len; i++) {
+                w_buf[i] = b == 0 ? 0 : -(c << 8) / b;
+                b += db;
+                c -= dc;
+                dc += 2;
+            }
         }
-    }
-    else {                  /* solve quadratical equation */
-        if(state->bpx ||
-           state->bpy) {    /* general case (circles are not concentric): w = (-b + sqrt(b^2 - 4ac))/2a (we only need the more positive root)*/
+        else if(!concentric) {  /* general case (circles are not concentric): w = (-b + sqrt(b^2 - 4ac))/2a (we only need the more positive root)*/
             int32_t a4 = state->a4 >> 4;
-            for(; width > 0; width--) {
+            for(i = 0; i < len; i++) {
                 int32_t det = lv_sqr(b >> 4) - (a4 * (c >> 4));     /* b^2 shifted down by 2*4=8, 4ac shifted down by 8 */
                 /* check determinant: if negative, then there is no solution: use starting color */
-                w = det < 0 ? 0 : extend_w(((lv_sqrt32(det) - (b >> 4)) * state->inv_a4) >>  16,
-                                           dsc->extend);        /* square root shifted down by 4 (includes *256 to set output range) */
-                *buf++ = grad->color_map[w];
-                *opa++ = grad->opa_map[w];
+                w_buf[i] = det < 0 ? 0 : ((lv_sqrt32(det) - (b >> 4)) * state->inv_a4) >>
+                           16;   /* square root shifted down by 4 (includes *256 to set output range) */
                 b += db;
                 c -= dc;
                 dc += 2;
             }
         }
-        else {              /* special case: concentric circles: w = (sqrt((xp-x0)^2 + (yx-y0)^2)-r0)/(r1-r0) */
-            c = lv_sqr(xp - state->x0) + lv_sqr(yp - state->y0);
-            for(; width > 0; width--) {
-                w = extend_w((((lv_sqrt32(c) - state->r0)) * state->inv_dr) >> 16, dsc->extend);
-                *buf++ = grad->color_map[w];
-                *opa++ = grad->opa_map[w];
+        else {
+            for(i = 0; i < len; i++) {
+                w_buf[i] = ((lv_sqrt32(c) - state->r0) * state->inv_dr) >> 16;
                 c += dc;
                 dc += 2;
             }
         }
+        extend_w_line(w_buf, len, dsc->extend);
+        map_line(grad, w_buf, len, buf, opa);
+        buf += len;
+        opa += len;
+        width -= len;
     }
 }
 
@@ -462,7 +606,7 @@ void lv_draw_sw_grad_linear_setup(lv_grad_dsc_t * dsc, const lv_area_t * coords)
     dsc->state = state;
 
     /* Create gradient color map */
-    state->cgrad = lv_draw_sw_grad_get(dsc, 256, 0);
+    state->cgrad = grad_map_get(dsc, 256);
 
     /* Convert from percentage coordinates */
     int32_t wdt = lv_area_get_width(coords);
@@ -490,7 +634,7 @@ void lv_draw_sw_grad_linear_cleanup(lv_grad_dsc_t * dsc)
     if(state == NULL)
         return;
     if(state->cgrad)
-        lv_free(state->cgrad);
+        lv_draw_sw_grad_cleanup(state->cgrad);
     lv_free(state);
 }
 
@@ -502,17 +646,25 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_grad_linear_get_line(lv_grad_dsc_t * dsc,
     lv_opa_t * opa = result->opa_map;
     lv_draw_sw_grad_calc_t * grad = state->cgrad;
 
-    int32_t w;  /* the result: this is an offset into the 256 element gradient color table */
     int32_t x, d;
 
     x = xp * state->a + yp * state->b - state->c;
     d = state->a;
 
-    for(; width > 0; width--) {
-        w = extend_w(x >> 8, dsc->extend);
-        *buf++ = grad->color_map[w];
-        *opa++ = grad->opa_map[w];
-        x += d;
+    /* Calculate the color map indices in chunks. These loops are simple enough to be vectorized. */
+    int32_t w_buf[GRAD_LINE_CHUNK];
+    while(width > 0) {
+        int32_t len = LV_MIN(width, GRAD_LINE_CHUNK);
+        int32_t i;
+        for(i = 0; i < len; i++) {
+            w_buf[i] = (x + i * d) >> 8;
+        }
+        x += len * d;
+        extend_w_line(w_buf, len, dsc->extend);
+        map_line(grad, w_buf, len, buf, opa);
+        buf += len;
+        opa += len;
+        width -= len;
     }
 }
 
@@ -537,7 +689,7 @@ void lv_draw_sw_grad_conical_setup(lv_grad_dsc_t * dsc, const lv_area_t * coords
     dsc->state = state;
 
     /* Create gradient color map */
-    state->cgrad = lv_draw_sw_grad_get(dsc, 256, 0);
+    state->cgrad = grad_map_get(dsc, 256);
 
     /* Convert from percentage coordinates */
     int32_t wdt = lv_area_get_width(coords);
@@ -562,7 +714,7 @@ void lv_draw_sw_grad_conical_cleanup(lv_grad_dsc_t * dsc)
     if(state == NULL)
         return;
     if(state->cgrad)
-        lv_free(state->cgrad);
+        lv_draw_sw_grad_cleanup(state->cgrad);
     lv_free(state);
 }
 
@@ -574,36 +726,31 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_grad_conical_get_line(lv_grad_dsc_t * dsc,
     lv_opa_t * opa = result->opa_map;
     lv_draw_sw_grad_calc_t * grad = state->cgrad;
 
-    int32_t w;  /* the result: this is an offset into the 256 element gradient color table */
     int32_t dx = xp - state->x0;
     int32_t dy = yp - state->y0;
 
-    if(dy == 0) {   /* we will eventually go through the center of the conical: need an extra test in the loop to avoid both dx and dy being zero in atan2 */
-        for(; width > 0; width--) {
-            if(dx == 0) {
-                w = 0;
+    int32_t w_buf[GRAD_LINE_CHUNK];
+    while(width > 0) {
+        int32_t len = LV_MIN(width, GRAD_LINE_CHUNK);
+        int32_t i;
+        for(i = 0; i < len; i++) {
+            /* if dy == 0, we will eventually go through the center of the conical: avoid both dx and dy being zero in atan2 */
+            if(dy == 0 && dx == 0) {
+                w_buf[i] = 0;
             }
             else {
                 int32_t d = lv_atan2(dy, dx) - state->a;
                 if(d < 0)
                     d += 360;
-                w = extend_w((d * state->inv_da) >> 8, dsc->extend);
+                w_buf[i] = (d * state->inv_da) >> 8;
             }
-            *buf++ = grad->color_map[w];
-            *opa++ = grad->opa_map[w];
-            dx++;
-        }
-    }
-    else {
-        for(; width > 0; width--) {
-            int32_t d = lv_atan2(dy, dx) - state->a;
-            if(d < 0)
-                d += 360;
-            w = extend_w((d * state->inv_da) >> 8, dsc->extend);
-            *buf++ = grad->color_map[w];
-            *opa++ = grad->opa_map[w];
             dx++;
         }
+        extend_w_line(w_buf, len, dsc->extend);
+        map_line(grad, w_buf, len, buf, opa);
+        buf += len;
+        opa += len;
+        width -= len;
     }
 }
 
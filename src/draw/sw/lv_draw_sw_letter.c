@@ -15,22 +15,37 @@
 
     #include "../../font/freetype/lv_freetype_private.h"
     #include "../lv_draw_vector_private.h"
+    #include "../../misc/lv_text_private.h"
 
 #endif
 
 #if LV_USE_DRAW_SW
 
+#include "lv_draw_sw_private.h"
 #include "../../core/lv_refr_private.h"
 
 /*********************
  *      DEFINES
  *********************/
 
+/*Max. number of missing outlines collected before rasterizing them in parallel*/
+#define OUTLINE_BATCH_MAX   32
+
 /**********************
  *      TYPEDEFS
  **********************/
 #if LV_USE_FREETYPE && LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
 
+typedef struct {
+    const lv_font_t * font;
+    uint32_t glyph_index;
+} outline_job_t;
+
+typedef struct {
+    outline_job_t jobs[OUTLINE_BATCH_MAX];
+    uint32_t job_cnt;
+} outline_batch_t;
+
 #endif /* LV_USE_FREETYPE && LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG */
 
 /**********************
@@ -44,6 +59,8 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ draw_letter_cb(lv_draw_task_t * t, lv_dr
 
     static void freetype_outline_event_cb(lv_event_t * e);
     static void draw_letter_outline(lv_draw_task_t * t, lv_draw_glyph_dsc_t * dsc);
+    static void prefetch_outlines(lv_draw_task_t * t, const lv_draw_label_dsc_t * dsc);
+    static void outline_job_cb(void * user_data, uint32_t job_idx);
 
 #endif
 
@@ -103,6 +120,8 @@ void lv_draw_sw_label(lv_draw_task_t * t, const lv_draw_label_dsc_t * dsc, const
         lv_freetype_outline_add_event(freetype_outline_event_cb, LV_EVENT_ALL, t);
         is_init = true;
     }
+
+    prefetch_outlines(t, dsc);
 #endif
 
     lv_draw_label_iterate_characters(t, dsc, coords, draw_letter_cb);
@@ -334,6 +353,56 @@ static void draw_letter_outline(lv_draw_task_t * t, lv_draw_glyph_dsc_t * glyph_
 
 }
 
+/* Collect the glyphs of the label whose outline is not cached yet and rasterize
+ * them up front as parallel jobs instead of one by one while the letters are drawn */
+static void prefetch_outlines(lv_draw_task_t * t, const lv_draw_label_dsc_t * dsc)
+{
+    if(dsc->text == NULL || dsc->font == NULL) return;
+
+    LV_PROFILER_DRAW_BEGIN;
+    outline_batch_t batch;
+    batch.job_cnt = 0;
+
+    uint32_t ofs = 0;
+    while(ofs < dsc->text_length && dsc->text[ofs] != '\0') {
+        uint32_t letter;
+        uint32_t letter_next;
+        lv_text_encoded_letter_next_2(dsc->text, &letter, &letter_next, &ofs);
+        if(letter < 0x20 || lv_text_is_marker(letter)) continue;
+
+        lv_font_glyph_dsc_t g;
+        if(!lv_font_get_glyph_dsc(dsc->font, &g, letter, letter_next)) continue;
+        if(g.format != LV_FONT_GLYPH_FORMAT_VECTOR || g.box_w == 0 || g.box_h == 0) continue;
+        if(!lv_freetype_is_outline_font(g.resolved_font)) continue;
+
+        uint32_t i;
+        for(i = 0; i < batch.job_cnt; i++) {
+            if(batch.jobs[i].font == g.resolved_font && batch.jobs[i].glyph_index == g.gid.index) break;
+        }
+        if(i < batch.job_cnt) continue;
+
+        if(lv_freetype_outline_is_cached(g.resolved_font, g.gid.index)) continue;
+
+        batch.jobs[batch.job_cnt].font = g.resolved_font;
+        batch.jobs[batch.job_cnt].glyph_index = g.gid.index;
+        batch.job_cnt++;
+
+        if(batch.job_cnt == OUTLINE_BATCH_MAX) {
+            lv_draw_sw_run_jobs(t, outline_job_cb, &batch, batch.job_cnt);
+            batch.job_cnt = 0;
+        }
+    }
+
+    lv_draw_sw_run_jobs(t, outline_job_cb, &batch, batch.job_cnt);
+    LV_PROFILER_DRAW_END;
+}
+
+static void outline_job_cb(void * user_data, uint32_t job_idx)
+{
+    outline_batch_t * batch = user_data;
+    lv_freetype_outline_prefetch(batch->jobs[job_idx].font, batch->jobs[job_idx].glyph_index);
+}
+
 /* Build the inside and outside vector paths for a glyph based
  * on the received outline events emitted by lv_freetype_outline.c */
 static void freetype_outline_event_cb(lv_event_t * e)
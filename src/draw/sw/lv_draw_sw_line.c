@@ -20,10 +20,31 @@
  *      DEFINES
  *********************/
 
+/*Size of the coverage buffer of a polyline in bytes*/
+#define POLYLINE_BAND_SIZE (16 * 1024)
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_SW_COMPLEX
+typedef struct {
+    lv_draw_sw_mask_line_param_t left;
+    lv_draw_sw_mask_line_param_t right;
+    lv_draw_sw_mask_line_param_t top;
+    lv_draw_sw_mask_line_param_t bottom;
+    void * masks[5];
+    lv_area_t area;     /**< Area to mask*/
+} line_skew_masks_t;
+
+typedef struct {
+    lv_opa_t * cov_buf;     /**< Coverage of a band of rows, the stride is the width of `band_area`*/
+    lv_opa_t * row_buf;     /**< Mask of one row of a segment*/
+    lv_area_t band_area;    /**< The area of `cov_buf`*/
+    lv_area_t dirty_area;   /**< The area of `band_area` with non zero coverage*/
+} polyline_ctx_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -31,6 +52,16 @@
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_skew(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_hor(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_ver(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
+#if LV_DRAW_SW_COMPLEX
+static bool line_skew_masks_init(line_skew_masks_t * m, const lv_point_precise_t * point1,
+                                 const lv_point_precise_t * point2, int32_t width, bool raw_end);
+static void line_skew_masks_free(line_skew_masks_t * m);
+static void polyline_add_segment(polyline_ctx_t * ctx, const lv_draw_line_dsc_t * dsc,
+                                 const lv_point_precise_t * p1, const lv_point_precise_t * p2);
+static void polyline_add_disc(polyline_ctx_t * ctx, const lv_draw_line_dsc_t * dsc, const lv_point_precise_t * p);
+static void polyline_add_area(polyline_ctx_t * ctx, const lv_area_t * area, void * masks[]);
+static inline bool point_is_valid(const lv_point_precise_t * p);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -96,6 +127,99 @@ void lv_draw_sw_line(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc)
     LV_PROFILER_DRAW_END;
 }
 
+void lv_draw_sw_polyline(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc)
+{
+    if(dsc->points == NULL) {
+        lv_draw_sw_line(t, dsc);
+        return;
+    }
+
+#if LV_DRAW_SW_COMPLEX
+    if(dsc->width == 0) return;
+    if(dsc->opa <= LV_OPA_MIN) return;
+    if(dsc->point_cnt < 2) return;
+
+    /*The dashes are started again on each segment*/
+    if(dsc->dash_gap && dsc->dash_width) {
+        lv_draw_line_iterate(t, (lv_draw_line_dsc_t *)dsc, lv_draw_sw_line);
+        return;
+    }
+
+    lv_area_t draw_area;
+    if(!lv_area_intersect(&draw_area, &t->area, &t->clip_area)) return;
+
+    LV_PROFILER_DRAW_BEGIN;
+
+    /*Render the coverage of the segments in bands of rows and blend each band once*/
+    int32_t draw_w = lv_area_get_width(&draw_area);
+    int32_t band_h = LV_CLAMP(1, POLYLINE_BAND_SIZE / draw_w, lv_area_get_height(&draw_area));
+    lv_opa_t * cov_buf = lv_malloc((size_t)draw_w * band_h);
+    lv_opa_t * row_buf = lv_malloc(draw_w);
+    if(cov_buf == NULL || row_buf == NULL) {
+        LV_LOG_WARN("Couldn't allocate the coverage buffer");
+        lv_free(cov_buf);
+        lv_free(row_buf);
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+
+    polyline_ctx_t ctx;
+    ctx.cov_buf = cov_buf;
+    ctx.row_buf = row_buf;
+    ctx.band_area.x1 = draw_area.x1;
+    ctx.band_area.x2 = draw_area.x2;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.mask_buf = cov_buf;
+    blend_dsc.mask_area = &ctx.band_area;
+    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+
+    const lv_point_precise_t * points = dsc->points;
+    int32_t point_cnt = dsc->point_cnt;
+    int32_t y;
+    for(y = draw_area.y1; y <= draw_area.y2; y += band_h) {
+        ctx.band_area.y1 = y;
+        ctx.band_area.y2 = LV_MIN(y + band_h - 1, draw_area.y2);
+        ctx.dirty_area.x1 = LV_COORD_MAX;
+        ctx.dirty_area.y1 = LV_COORD_MAX;
+        ctx.dirty_area.x2 = LV_COORD_MIN;
+        ctx.dirty_area.y2 = LV_COORD_MIN;
+        lv_memzero(cov_buf, (size_t)draw_w * lv_area_get_height(&ctx.band_area));
+
+        int32_t i;
+        for(i = 0; i < point_cnt; i++) {
+            if(!point_is_valid(&points[i])) continue;
+            bool prev_valid = i > 0 && point_is_valid(&points[i - 1]);
+            bool next_valid = i < point_cnt - 1 && point_is_valid(&points[i + 1]);
+
+            if(next_valid) polyline_add_segment(&ctx, dsc, &points[i], &points[i + 1]);
+
+            /*Round joins between the segments and round caps at the ends of the runs*/
+            bool disc;
+            if(prev_valid && next_valid) disc = dsc->width > 2;
+            else if(next_valid) disc = dsc->round_start;
+            else if(prev_valid) disc = dsc->round_end;
+            else disc = false;
+            if(disc) polyline_add_disc(&ctx, dsc, &points[i]);
+        }
+
+        if(ctx.dirty_area.x1 <= ctx.dirty_area.x2) {
+            blend_dsc.blend_area = &ctx.dirty_area;
+            lv_draw_sw_blend(t, &blend_dsc);
+        }
+    }
+
+    lv_free(cov_buf);
+    lv_free(row_buf);
+    LV_PROFILER_DRAW_END;
+#else
+    lv_draw_line_iterate(t, (lv_draw_line_dsc_t *)dsc, lv_draw_sw_line);
+#endif /*LV_DRAW_SW_COMPLEX*/
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -250,91 +374,20 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_ver(lv_draw_task_t * t, const lv_dra
 static void LV_ATTRIBUTE_FAST_MEM draw_line_skew(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc)
 {
 #if LV_DRAW_SW_COMPLEX
-    /*Keep the great y in p1*/
-    lv_point_t p1;
-    lv_point_t p2;
-    if(dsc->p1.y < dsc->p2.y) {
-        p1 = lv_point_from_precise(&dsc->p1);
-        p2 = lv_point_from_precise(&dsc->p2);
-    }
-    else {
-        p1 = lv_point_from_precise(&dsc->p2);
-        p2 = lv_point_from_precise(&dsc->p1);
-    }
-
-    int32_t xdiff = p2.x - p1.x;
-    int32_t ydiff = p2.y - p1.y;
-    bool flat = LV_ABS(xdiff) > LV_ABS(ydiff);
-
-    static const uint8_t wcorr[] = {
-        128, 128, 128, 129, 129, 130, 130, 131,
-        132, 133, 134, 135, 137, 138, 140, 141,
-        143, 145, 147, 149, 151, 153, 155, 158,
-        160, 162, 165, 167, 170, 173, 175, 178,
-        181,
-    };
-
-    int32_t w = dsc->width;
-    int32_t wcorr_i = 0;
-    if(flat) wcorr_i = (LV_ABS(ydiff) << 5) / LV_ABS(xdiff);
-    else wcorr_i = (LV_ABS(xdiff) << 5) / LV_ABS(ydiff);
-
-    w = (w * wcorr[wcorr_i] + 63) >> 7;     /*+ 63 for rounding*/
-    int32_t w_half0 = w >> 1;
-    int32_t w_half1 = w_half0 + (w & 0x1); /*Compensate rounding error*/
+    line_skew_masks_t m;
+    if(!line_skew_masks_init(&m, &dsc->p1, &dsc->p2, dsc->width, dsc->raw_end)) return;
 
     lv_area_t blend_area;
-    blend_area.x1 = LV_MIN(p1.x, p2.x) - w;
-    blend_area.x2 = LV_MAX(p1.x, p2.x) + w;
-    blend_area.y1 = LV_MIN(p1.y, p2.y) - w;
-    blend_area.y2 = LV_MAX(p1.y, p2.y) + w;
-
     /*Get the union of `coords` and `clip`*/
     /*`clip` is already truncated to the `draw_buf` size
      *in 'lv_refr_area' function*/
-    bool is_common = lv_area_intersect(&blend_area, &blend_area, &t->clip_area);
-    if(is_common == false) return;
-
-    lv_draw_sw_mask_line_param_t mask_left_param;
-    lv_draw_sw_mask_line_param_t mask_right_param;
-    lv_draw_sw_mask_line_param_t mask_top_param;
-    lv_draw_sw_mask_line_param_t mask_bottom_param;
-
-    void * masks[5] = {&mask_left_param, & mask_right_param, NULL, NULL, NULL};
-
-    if(flat) {
-        if(xdiff > 0) {
-            lv_draw_sw_mask_line_points_init(&mask_left_param, p1.x, p1.y - w_half0, p2.x, p2.y - w_half0,
-                                             LV_DRAW_SW_MASK_LINE_SIDE_LEFT);
-            lv_draw_sw_mask_line_points_init(&mask_right_param, p1.x, p1.y + w_half1, p2.x, p2.y + w_half1,
-                                             LV_DRAW_SW_MASK_LINE_SIDE_RIGHT);
-        }
-        else {
-            lv_draw_sw_mask_line_points_init(&mask_left_param, p1.x, p1.y + w_half1, p2.x, p2.y + w_half1,
-                                             LV_DRAW_SW_MASK_LINE_SIDE_LEFT);
-            lv_draw_sw_mask_line_points_init(&mask_right_param, p1.x, p1.y - w_half0, p2.x, p2.y - w_half0,
-                                             LV_DRAW_SW_MASK_LINE_SIDE_RIGHT);
-        }
-    }
-    else {
-        lv_draw_sw_mask_line_points_init(&mask_left_param, p1.x + w_half1, p1.y, p2.x + w_half1, p2.y,
-                                         LV_DRAW_SW_MASK_LINE_SIDE_LEFT);
-        lv_draw_sw_mask_line_points_init(&mask_right_param, p1.x - w_half0, p1.y, p2.x - w_half0, p2.y,
-                                         LV_DRAW_SW_MASK_LINE_SIDE_RIGHT);
-
-    }
-
-    /*Use the normal vector for the endings*/
-
-    if(!dsc->raw_end) {
-        lv_draw_sw_mask_line_points_init(&mask_top_param, p1.x, p1.y, p1.x - ydiff, p1.y + xdiff,
-                                         LV_DRAW_SW_MASK_LINE_SIDE_BOTTOM);
-        lv_draw_sw_mask_line_points_init(&mask_bottom_param, p2.x, p2.y, p2.x - ydiff, p2.y + xdiff,
-                                         LV_DRAW_SW_MASK_LINE_SIDE_TOP);
-        masks[2] = &mask_top_param;
-        masks[3] = &mask_bottom_param;
+    bool is_common = lv_area_intersect(&blend_area, &m.area, &t->clip_area);
+    if(is_common == false) {
+        line_skew_masks_free(&m);
+        return;
     }
 
+    void ** masks = m.masks;
 
     /*Draw the background line by line*/
     int32_t h;
@@ -391,12 +444,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_skew(lv_draw_task_t * t, const lv_dr
 
     lv_free(mask_buf);
 
-    lv_draw_sw_mask_free_param(&mask_left_param);
-    lv_draw_sw_mask_free_param(&mask_right_param);
-    if(!dsc->raw_end) {
-        lv_draw_sw_mask_free_param(&mask_top_param);
-        lv_draw_sw_mask_free_param(&mask_bottom_param);
-    }
+    line_skew_masks_free(&m);
 #else
     LV_UNUSED(t);
     LV_UNUSED(dsc);
@@ -404,4 +452,233 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_skew(lv_draw_task_t * t, const lv_dr
 #endif /*LV_DRAW_SW_COMPLEX*/
 }
 
+#if LV_DRAW_SW_COMPLEX
+
+/**
+ * Initialize the masks of a skewed line
+ * @param m         the masks to initialize
+ * @param point1    the first point of the line
+ * @param point2    the second point of the line
+ * @param width     width of the line
+ * @param raw_end   true: don't cut the ends of the line perpendicularly
+ * @return          false if the line is not skewed
+ */
+static bool line_skew_masks_init(line_skew_masks_t * m, const lv_point_precise_t * point1,
+                                 const lv_point_precise_t * point2, int32_t width, bool raw_end)
+{
+    /*Keep the great y in p1*/
+    lv_point_t p1;
+    lv_point_t p2;
+    if(point1->y < point2->y) {
+        p1 = lv_point_from_precise(point1);
+        p2 = lv_point_from_precise(point2);
+    }
+    else {
+        p1 = lv_point_from_precise(point2);
+        p2 = lv_point_from_precise(point1);
+    }
+
+    int32_t xdiff = p2.x - p1.x;
+    int32_t ydiff = p2.y - p1.y;
+    if(xdiff == 0 || ydiff == 0) return false;
+    bool flat = LV_ABS(xdiff) > LV_ABS(ydiff);
+
+    static const uint8_t wcorr[] = {
+        128, 128, 128, 129, 129, 130, 130, 131,
+        132, 133, 134, 135, 137, 138, 140, 141,
+        143, 145, 147, 149, 151, 153, 155, 158,
+        160, 162, 165, 167, 170, 173, 175, 178,
+        181,
+    };
+
+    int32_t w = width;
+    int32_t wcorr_i = 0;
+    if(flat) wcorr_i = (LV_ABS(ydiff) << 5) / LV_ABS(xdiff);
+    else wcorr_i = (LV_ABS(xdiff) << 5) / LV_ABS(ydiff);
+
+    w = (w * wcorr[wcorr_i] + 63) >> 7;     /*+ 63 for rounding*/
+    int32_t w_half0 = w >> 1;
+    int32_t w_half1 = w_half0 + (w & 0x1); /*Compensate rounding error*/
+
+    m->area.x1 = LV_MIN(p1.x, p2.x) - w;
+    m->area.x2 = LV_MAX(p1.x, p2.x) + w;
+    m->area.y1 = LV_MIN(p1.y, p2.y) - w;
+    m->area.y2 = LV_MAX(p1.y, p2.y) + w;
+
+    if(flat) {
+        if(xdiff > 0) {
+            lv_draw_sw_mask_line_points_init(&m->left, p1.x, p1.y - w_half0, p2.x, p2.y - w_half0,
+                                             LV_DRAW_SW_MASK_LINE_SIDE_LEFT);
+            lv_draw_sw_mask_line_points_init(&m->right, p1.x, p1.y + w_half1, p2.x, p2.y + w_half1,
+                                             LV_DRAW_SW_MASK_LINE_SIDE_RIGHT);
+        }
+        else {
+            lv_draw_sw_mask_line_points_init(&m->left, p1.x, p1.y + w_half1, p2.x, p2.y + w_half1,
+                                             LV_DRAW_SW_MASK_LINE_SIDE_LEFT);
+            lv_draw_sw_mask_line_points_init(&m->right, p1.x, p1.y - w_half0, p2.x, p2.y - w_half0,
+                                             LV_DRAW_SW_MASK_LINE_SIDE_RIGHT);
+        }
+    }
+    else {
+        lv_draw_sw_mask_line_points_init(&m->left, p1.x + w_half1, p1.y, p2.x + w_half1, p2.y,
+                                         LV_DRAW_SW_MASK_LINE_SIDE_LEFT);
+        lv_draw_sw_mask_line_points_init(&m->right, p1.x - w_half0, p1.y, p2.x - w_half0, p2.y,
+                                         LV_DRAW_SW_MASK_LINE_SIDE_RIGHT);
+
+    }
+
+    m->masks[0] = &m->left;
+    m->masks[1] = &m->right;
+    m->masks[2] = NULL;
+    m->masks[3] = NULL;
+    m->masks[4] = NULL;
+
+    /*Use the normal vector for the endings*/
+    if(!raw_end) {
+        lv_draw_sw_mask_line_points_init(&m->top, p1.x, p1.y, p1.x - ydiff, p1.y + xdiff,
+                                         LV_DRAW_SW_MASK_LINE_SIDE_BOTTOM);
+        lv_draw_sw_mask_line_points_init(&m->bottom, p2.x, p2.y, p2.x - ydiff, p2.y + xdiff,
+                                         LV_DRAW_SW_MASK_LINE_SIDE_TOP);
+        m->masks[2] = &m->top;
+        m->masks[3] = &m->bottom;
+    }
+
+    return true;
+}
+
+static void line_skew_masks_free(line_skew_masks_t * m)
+{
+    lv_draw_sw_mask_free_param(&m->left);
+    lv_draw_sw_mask_free_param(&m->right);
+    if(m->masks[2]) {
+        lv_draw_sw_mask_free_param(&m->top);
+        lv_draw_sw_mask_free_param(&m->bottom);
+    }
+}
+
+/**
+ * Add the coverage of a segment of a polyline to the current band
+ * @param ctx       the polyline context
+ * @param dsc       the line draw descriptor
+ * @param p1        the first point of the segment
+ * @param p2        the second point of the segment
+ */
+static void polyline_add_segment(polyline_ctx_t * ctx, const lv_draw_line_dsc_t * dsc,
+                                 const lv_point_precise_t * p1, const lv_point_precise_t * p2)
+{
+    if(p1->x == p2->x && p1->y == p2->y) return;
+
+    /*Quick check with a larger area to skip the segments far from the band.
+     *The width of skewed lines is corrected by at most sqrt(2).*/
+    int32_t margin = dsc->width * 2;
+    lv_area_t a;
+    a.x1 = (int32_t)LV_MIN(p1->x, p2->x) - margin;
+    a.x2 = (int32_t)LV_MAX(p1->x, p2->x) + margin;
+    a.y1 = (int32_t)LV_MIN(p1->y, p2->y) - margin;
+    a.y2 = (int32_t)LV_MAX(p1->y, p2->y) + margin;
+    if(!lv_area_is_on(&a, &ctx->band_area)) return;
+
+    /*The same geometry as the separately drawn lines*/
+    int32_t w = dsc->width - 1;
+    int32_t w_half0 = w >> 1;
+    int32_t w_half1 = w_half0 + (w & 0x1); /*Compensate rounding error*/
+    if((int32_t)p1->y == (int32_t)p2->y) {
+        a.x1 = (int32_t)LV_MIN(p1->x, p2->x);
+        a.x2 = (int32_t)LV_MAX(p1->x, p2->x) - 1;
+        a.y1 = (int32_t)p1->y - w_half1;
+        a.y2 = (int32_t)p1->y + w_half0;
+        polyline_add_area(ctx, &a, NULL);
+    }
+    else if((int32_t)p1->x == (int32_t)p2->x) {
+        a.x1 = (int32_t)p1->x - w_half1;
+        a.x2 = (int32_t)p1->x + w_half0;
+        a.y1 = (int32_t)LV_MIN(p1->y, p2->y);
+        a.y2 = (int32_t)LV_MAX(p1->y, p2->y) - 1;
+        polyline_add_area(ctx, &a, NULL);
+    }
+    else {
+        line_skew_masks_t m;
+        if(!line_skew_masks_init(&m, p1, p2, dsc->width, dsc->raw_end)) return;
+        polyline_add_area(ctx, &m.area, m.masks);
+        line_skew_masks_free(&m);
+    }
+}
+
+/**
+ * Add the coverage of a circle (round join or cap) to the current band
+ * @param ctx       the polyline context
+ * @param dsc       the line draw descriptor
+ * @param p         the center of the circle
+ */
+static void polyline_add_disc(polyline_ctx_t * ctx, const lv_draw_line_dsc_t * dsc, const lv_point_precise_t * p)
+{
+    int32_t r = (dsc->width >> 1);
+    int32_t r_corr = (dsc->width & 1) ? 0 : 1;
+    lv_area_t cir_area;
+    cir_area.x1 = (int32_t)p->x - r;
+    cir_area.y1 = (int32_t)p->y - r;
+    cir_area.x2 = (int32_t)p->x + r - r_corr;
+    cir_area.y2 = (int32_t)p->y + r - r_corr;
+    if(!lv_area_is_on(&cir_area, &ctx->band_area)) return;
+
+    lv_draw_sw_mask_radius_param_t param;
+    lv_draw_sw_mask_radius_init(&param, &cir_area, LV_RADIUS_CIRCLE, false);
+    void * masks[2] = {&param, NULL};
+    polyline_add_area(ctx, &cir_area, masks);
+    lv_draw_sw_mask_free_param(&param);
+}
+
+/**
+ * Add an area with the maximum of the current and the masked coverage to the current band
+ * @param ctx       the polyline context
+ * @param area      the area to add
+ * @param masks     NULL terminated array of masks or NULL to fully cover the area
+ */
+static void polyline_add_area(polyline_ctx_t * ctx, const lv_area_t * area, void * masks[])
+{
+    lv_area_t a;
+    if(!lv_area_intersect(&a, area, &ctx->band_area)) return;
+
+    int32_t stride = lv_area_get_width(&ctx->band_area);
+    int32_t w = lv_area_get_width(&a);
+    lv_opa_t * cov = ctx->cov_buf + (a.y1 - ctx->band_area.y1) * stride + (a.x1 - ctx->band_area.x1);
+    bool covered = false;
+    int32_t y;
+    for(y = a.y1; y <= a.y2; y++, cov += stride) {
+        if(masks == NULL) {
+            lv_memset(cov, 0xff, w);
+        }
+        else {
+            lv_memset(ctx->row_buf, 0xff, w);
+            lv_draw_sw_mask_res_t res = lv_draw_sw_mask_apply(masks, ctx->row_buf, a.x1, y, w);
+            if(res == LV_DRAW_SW_MASK_RES_TRANSP) continue;
+            if(res == LV_DRAW_SW_MASK_RES_FULL_COVER) {
+                lv_memset(cov, 0xff, w);
+            }
+            else {
+                int32_t x;
+                for(x = 0; x < w; x++) {
+                    if(ctx->row_buf[x] > cov[x]) cov[x] = ctx->row_buf[x];
+                }
+            }
+        }
+
+        ctx->dirty_area.y1 = LV_MIN(ctx->dirty_area.y1, y);
+        ctx->dirty_area.y2 = LV_MAX(ctx->dirty_area.y2, y);
+        covered = true;
+    }
+
+    if(covered) {
+        ctx->dirty_area.x1 = LV_MIN(ctx->dirty_area.x1, a.x1);
+        ctx->dirty_area.x2 = LV_MAX(ctx->dirty_area.x2, a.x2);
+    }
+}
+
+static inline bool point_is_valid(const lv_point_precise_t * p)
+{
+    return p->x != LV_DRAW_LINE_POINT_NONE && p->y != LV_DRAW_LINE_POINT_NONE;
+}
+
+#endif /*LV_DRAW_SW_COMPLEX*/
+
 #endif /*LV_USE_DRAW_SW*/
@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_draw_sw.h"
+#include "lv_draw_sw_grad.h"
 #include "../lv_draw_private.h"
 
 #if LV_USE_DRAW_SW
@@ -31,6 +32,23 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+/**
+ * ThorVG state of a SW render thread kept between the vector draw tasks.
+ * Zero initialized means not created yet.
+ */
+typedef struct {
+    void * canvas;              /**< The `Tvg_Canvas` of the thread*/
+    void * paint_pool;          /**< A `Tvg_Scene` keeping the reusable shapes alive*/
+    lv_array_t paints;          /**< The reusable `Tvg_Paint *` shapes, all in `paint_pool`*/
+    void * target_buf;          /**< The buffer the canvas draws to currently*/
+    uint32_t target_stride;
+    int32_t target_w;
+    int32_t target_h;
+    lv_draw_buf_t * argb_buf;   /**< ARGB8888 buffer to draw layers with other color formats*/
+} lv_draw_sw_vector_ctx_t;
+#endif
+
 typedef struct {
     lv_draw_task_t * task_act;
     lv_thread_t thread;
@@ -39,29 +57,107 @@ typedef struct {
     uint32_t idx;
     volatile bool inited;
     volatile bool exit_status;
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+    lv_draw_sw_vector_ctx_t vector_ctx;
+#endif
 } lv_draw_sw_thread_dsc_t;
 
+/**
+ * Execute a job of a batch started by `lv_draw_sw_run_jobs`
+ * @param user_data     the `user_data` passed to `lv_draw_sw_run_jobs`
+ * @param job_idx       index of the job to execute (0 .. job_cnt - 1)
+ */
+typedef void (*lv_draw_sw_job_cb_t)(void * user_data, uint32_t job_idx);
+
 struct _lv_draw_sw_unit_t {
     lv_draw_unit_t base_unit;
 #if LV_USE_OS
     lv_draw_sw_thread_dsc_t thread_dscs[LV_DRAW_SW_DRAW_UNIT_CNT];
+    lv_mutex_t job_lock;                            /**< Protects `job_batch_act` and the job counters*/
+    struct _lv_draw_sw_job_batch_t * job_batch_act; /**< The batch the idle threads can help with*/
 #else
     lv_draw_task_t * task_act;
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+    lv_draw_sw_vector_ctx_t vector_ctx;
+#endif
 #endif
 };
 
-#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+#if LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_SIZE
+/**
+ * A blurred shadow corner in the shadow cache.
+ * The corner depends only on these parameters and not on the position of the shadow.
+ */
 typedef struct {
-    uint8_t cache[LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE];
-    int32_t cache_size;
-    int32_t cache_r;
-} lv_draw_sw_shadow_cache_t;
+    int32_t w;              /**< Width of the shadow's core area, clamped to where it stops mattering*/
+    int32_t h;              /**< Height of the shadow's core area, clamped to where it stops mattering*/
+    int32_t r;              /**< Clamped radius of the core area*/
+    int32_t sw;             /**< Shadow width*/
+    lv_opa_t * buf;         /**< `(sw + r)^2` opacity values of the corner*/
+} lv_draw_sw_shadow_cache_data_t;
+#endif
+
+#if LV_DRAW_SW_GRAD_CACHE_CNT
+/**
+ * A gradient color map in the gradient cache.
+ * The map depends only on the stops and its length, not on the direction or the extend mode.
+ */
+typedef struct {
+    lv_grad_stop_t stops[LV_GRADIENT_MAX_STOPS];    /**< The stops of the gradient, only `stops_count` are used*/
+    uint8_t stops_count;                            /**< The number of stops*/
+    uint32_t size;                                  /**< Length of the color map*/
+    lv_draw_sw_grad_calc_t * calc;                  /**< The calculated color and opacity map*/
+} lv_draw_sw_grad_cache_data_t;
 #endif
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Execute independent jobs of a draw task, e.g. rasterize the glyphs of a label.
+ * The SW render threads which are idle at the moment take jobs too, and the function
+ * returns when all the jobs are finished.
+ * Without OS, or if another batch is being executed, the jobs are executed one by one.
+ * @param t             the draw task executed by the calling thread
+ * @param job_cb        called for each job, from any SW render thread
+ * @param user_data     passed to `job_cb`
+ * @param job_cnt       number of jobs
+ */
+void lv_draw_sw_run_jobs(lv_draw_task_t * t, lv_draw_sw_job_cb_t job_cb, void * user_data, uint32_t job_cnt);
+
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+/**
+ * Free the ThorVG canvas, the shapes and the buffer of a SW render thread
+ * @param ctx       pointer to the vector context of the thread
+ */
+void lv_draw_sw_vector_ctx_deinit(lv_draw_sw_vector_ctx_t * ctx);
+#endif
+
+#if LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_SIZE
+/**
+ * Create the cache of the blurred shadow corners
+ */
+void lv_draw_sw_shadow_cache_init(void);
+
+/**
+ * Free the cache of the blurred shadow corners
+ */
+void lv_draw_sw_shadow_cache_deinit(void);
+#endif
+
+#if LV_DRAW_SW_GRAD_CACHE_CNT
+/**
+ * Create the cache of the gradient color maps
+ */
+void lv_draw_sw_grad_cache_init(void);
+
+/**
+ * Free the cache of the gradient color maps
+ */
+void lv_draw_sw_grad_cache_deinit(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
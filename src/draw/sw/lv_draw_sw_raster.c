@@ -0,0 +1,480 @@
+/**
+ * @file lv_draw_sw_raster.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_raster_private.h"
+#if LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX
+
+#include "../../misc/lv_area_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Size of the cells of a band in bytes*/
+#define RASTER_BAND_SIZE    (16 * 1024)
+
+/*Full coverage of a cell*/
+#define CELL_ONE            (1 << (2 * LV_DRAW_SW_RASTER_SHIFT))
+
+#define SPAN_EMPTY          INT32_MAX
+
+/*`row_y` when no row is being read*/
+#define RASTER_NO_ROW       INT32_MIN
+
+/*Transparent gaps wider than this split a row into separate runs*/
+#define RASTER_GAP_MIN      16
+
+/*pi with 30 fractional bits*/
+#define TRIGO_PI_Q30        3373259426LL
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void add_edge(lv_draw_sw_raster_t * r, int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+static void render_band(lv_draw_sw_raster_t * r, int32_t y);
+static void clear_band(lv_draw_sw_raster_t * r);
+static void add_row_segment(lv_draw_sw_raster_t * r, int32_t row, int32_t xa, int32_t xb, int32_t d);
+static void LV_ATTRIBUTE_FAST_MEM add_cells(lv_draw_sw_raster_t * r, int32_t row, int32_t x0, int32_t x1, int32_t d);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_draw_sw_raster_init(lv_draw_sw_raster_t * r, const lv_area_t * clip_area)
+{
+    lv_memzero(r, sizeof(lv_draw_sw_raster_t));
+    r->clip_area = *clip_area;
+
+    /*+2 cells for the edges on the right side of the clip area*/
+    r->cell_w = lv_area_get_width(clip_area) + 2;
+    r->band_h = LV_CLAMP(1, RASTER_BAND_SIZE / (r->cell_w * (int32_t)sizeof(int32_t)), lv_area_get_height(clip_area));
+    r->cells = lv_malloc_zeroed((size_t)r->cell_w * r->band_h * sizeof(int32_t));
+    r->span_x1 = lv_malloc((size_t)r->band_h * sizeof(int32_t));
+    r->span_x2 = lv_malloc((size_t)r->band_h * sizeof(int32_t));
+    if(r->cells == NULL || r->span_x1 == NULL || r->span_x2 == NULL) {
+        LV_LOG_WARN("Couldn't allocate the cells");
+        lv_free(r->cells);
+        lv_free(r->span_x1);
+        lv_free(r->span_x2);
+        r->cells = NULL;
+        r->span_x1 = NULL;
+        r->span_x2 = NULL;
+        return LV_RESULT_INVALID;
+    }
+
+    int32_t i;
+    for(i = 0; i < r->band_h; i++) r->span_x1[i] = SPAN_EMPTY;
+
+    /*Nothing is rendered yet*/
+    r->band_area.x1 = clip_area->x1;
+    r->band_area.x2 = clip_area->x2;
+    r->band_area.y1 = clip_area->y1 - 1;
+    r->band_area.y2 = clip_area->y1 - 1;
+
+    r->y_min = INT32_MAX;
+    r->y_max = INT32_MIN;
+    r->sub_path_empty = true;
+    r->row_y = RASTER_NO_ROW;
+
+    lv_array_init(&r->edges, 32, sizeof(lv_draw_sw_raster_edge_t));
+
+    return LV_RESULT_OK;
+}
+
+void lv_draw_sw_raster_deinit(lv_draw_sw_raster_t * r)
+{
+    lv_array_deinit(&r->edges);
+    lv_free(r->cells);
+    lv_free(r->span_x1);
+    lv_free(r->span_x2);
+    r->cells = NULL;
+    r->span_x1 = NULL;
+    r->span_x2 = NULL;
+}
+
+void lv_draw_sw_raster_move_to(lv_draw_sw_raster_t * r, int32_t x, int32_t y)
+{
+    lv_draw_sw_raster_close(r);
+    r->start_x = x;
+    r->start_y = y;
+    r->last_x = x;
+    r->last_y = y;
+    r->sub_path_empty = true;
+}
+
+void lv_draw_sw_raster_line_to(lv_draw_sw_raster_t * r, int32_t x, int32_t y)
+{
+    add_edge(r, r->last_x, r->last_y, x, y);
+    r->last_x = x;
+    r->last_y = y;
+    r->sub_path_empty = false;
+}
+
+void lv_draw_sw_raster_arc_to(lv_draw_sw_raster_t * r, int32_t cx, int32_t cy, int32_t radius,
+                              int32_t start_angle, int32_t end_angle)
+{
+    if(radius <= 0) {
+        if(r->sub_path_empty) lv_draw_sw_raster_move_to(r, cx, cy);
+        else lv_draw_sw_raster_line_to(r, cx, cy);
+        return;
+    }
+
+    /*A segment of angle `a` deviates `radius * a^2 / 8` from the circle,
+     *so keep `a` below sqrt(1/8 / radius) rad ~ 20.26 / sqrt(radius) deg*/
+    int32_t radius_px = LV_MAX(radius >> LV_DRAW_SW_RASTER_SHIFT, 1);
+    int32_t step = (20 * LV_DRAW_SW_RASTER_ONE + 66) / LV_MAX(lv_sqrt32((uint32_t)radius_px), 1);
+    step = LV_CLAMP(LV_DRAW_SW_RASTER_ONE / 16, step, 10 * LV_DRAW_SW_RASTER_ONE);
+
+    int32_t span = end_angle - start_angle;
+    int32_t n = (LV_ABS(span) + step - 1) / step;
+    if(n < 1) n = 1;
+
+    /*Rotate the radius vector by the angle of one segment instead of calculating a sine for each point.
+     *The rotation uses 30 fractional bits and the Taylor series of the sine and cosine, so the error is
+     *negligible even after many segments.*/
+    int64_t d = ((int64_t)span * TRIGO_PI_Q30 / (180 * LV_DRAW_SW_RASTER_ONE)) / n;
+    int64_t d2 = (d * d) >> 30;
+    int64_t d3 = (d2 * d) >> 30;
+    int64_t d4 = (d2 * d2) >> 30;
+    int64_t d5 = (d4 * d) >> 30;
+    int64_t rot_cos = ((int64_t)1 << 30) - d2 / 2 + d4 / 24;
+    int64_t rot_sin = d - d3 / 6 + d5 / 120;
+    int64_t ux = (int64_t)lv_draw_sw_raster_sin(start_angle + 90 * LV_DRAW_SW_RASTER_ONE) << (30 - LV_TRIGO_SHIFT);
+    int64_t uy = (int64_t)lv_draw_sw_raster_sin(start_angle) << (30 - LV_TRIGO_SHIFT);
+
+    int32_t i;
+    for(i = 0; i <= n; i++) {
+        int32_t x = cx + (int32_t)((radius * ux) >> 30);
+        int32_t y = cy + (int32_t)((radius * uy) >> 30);
+        if(i == 0 && r->sub_path_empty) lv_draw_sw_raster_move_to(r, x, y);
+        else lv_draw_sw_raster_line_to(r, x, y);
+
+        int64_t ux_next = (ux * rot_cos - uy * rot_sin) >> 30;
+        uy = (ux * rot_sin + uy * rot_cos) >> 30;
+        ux = ux_next;
+    }
+}
+
+void lv_draw_sw_raster_close(lv_draw_sw_raster_t * r)
+{
+    add_edge(r, r->last_x, r->last_y, r->start_x, r->start_y);
+    r->last_x = r->start_x;
+    r->last_y = r->start_y;
+    r->sub_path_empty = true;
+}
+
+int32_t lv_draw_sw_raster_sin(int32_t angle)
+{
+    int32_t deg = angle >> LV_DRAW_SW_RASTER_SHIFT;
+    int32_t frac = angle & (LV_DRAW_SW_RASTER_ONE - 1);
+    while(deg >= 360) deg -= 360;
+    while(deg < 0) deg += 360;
+
+    int32_t s0 = lv_trigo_sin((int16_t)deg);
+    if(frac == 0) return s0;
+    int32_t s1 = lv_trigo_sin((int16_t)(deg + 1));
+    return s0 + (((s1 - s0) * frac) >> LV_DRAW_SW_RASTER_SHIFT);
+}
+
+lv_draw_sw_mask_res_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_raster_get_row(lv_draw_sw_raster_t * r, int32_t y,
+                                                                      lv_opa_t * buf, int32_t * x1, int32_t * x2)
+{
+    if(r->cells == NULL) return LV_DRAW_SW_MASK_RES_TRANSP;
+
+    /*Start a new row. The cells of a row left unfinished are cleared with the band.*/
+    if(y != r->row_y) {
+        r->row_y = RASTER_NO_ROW;
+        if(y < r->clip_area.y1 || y > r->clip_area.y2) return LV_DRAW_SW_MASK_RES_TRANSP;
+        if((y << LV_DRAW_SW_RASTER_SHIFT) >= r->y_max || ((y + 1) << LV_DRAW_SW_RASTER_SHIFT) <= r->y_min) {
+            return LV_DRAW_SW_MASK_RES_TRANSP;
+        }
+
+        if(y > r->band_area.y2) render_band(r, y);
+        if(y < r->band_area.y1) {
+            LV_LOG_WARN("The rows need to be read in increasing order");
+            return LV_DRAW_SW_MASK_RES_TRANSP;
+        }
+
+        int32_t span_x1 = r->span_x1[y - r->band_area.y1];
+        if(span_x1 == SPAN_EMPTY) return LV_DRAW_SW_MASK_RES_TRANSP;
+        r->row_y = y;
+        r->row_x = span_x1;
+        r->row_sum = 0;
+    }
+
+    /*The coverage is the running sum of the cells. Clear the cells on the way for the next band.*/
+    int32_t row = y - r->band_area.y1;
+    int32_t * cells = r->cells + row * r->cell_w;
+    int32_t span_x2 = r->span_x2[row];
+    int32_t last = LV_MIN(span_x2, r->cell_w - 3);
+    int32_t sum = r->row_sum;
+    int32_t run_x1 = -1;
+    int32_t run_x2 = -1;
+    int32_t x = r->row_x;
+    while(x <= last) {
+        sum += cells[x];
+        cells[x] = 0;
+        int32_t v = LV_ABS(sum) >> LV_DRAW_SW_RASTER_SHIFT;
+        lv_opa_t opa = v > LV_OPA_COVER ? LV_OPA_COVER : (lv_opa_t)v;
+
+        /*The coverage changes only in the touched cells, so handle the untouched cells at once*/
+        int32_t run_end = x + 1;
+        while(run_end <= last && cells[run_end] == 0) run_end++;
+
+        if(opa != LV_OPA_TRANSP) {
+            if(run_x1 < 0) run_x1 = x;
+            run_x2 = run_end - 1;
+            lv_memset(&buf[x], opa, run_end - x);
+        }
+        else if(run_x1 >= 0) {
+            /*A wider transparent gap (e.g. the hole of a ring) ends the run*/
+            if(run_end - x > RASTER_GAP_MIN) {
+                x = run_end;
+                break;
+            }
+            lv_memzero(&buf[x], run_end - x);
+        }
+        x = run_end;
+    }
+
+    r->row_x = x;
+    r->row_sum = sum;
+    if(x > last) {
+        /*The row is finished, clear the cells on the right of the clip area too*/
+        for(x = last + 1; x <= span_x2; x++) cells[x] = 0;
+        r->span_x1[row] = SPAN_EMPTY;
+        r->row_y = RASTER_NO_ROW;
+    }
+
+    if(run_x1 < 0) return LV_DRAW_SW_MASK_RES_TRANSP;
+
+    *x1 = r->clip_area.x1 + run_x1;
+    *x2 = r->clip_area.x1 + run_x2;
+    return LV_DRAW_SW_MASK_RES_CHANGED;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void add_edge(lv_draw_sw_raster_t * r, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    /*Horizontal edges don't change the coverage*/
+    if(y0 == y1) return;
+
+    lv_draw_sw_raster_edge_t e;
+    if(y0 < y1) {
+        e.x0 = x0;
+        e.y0 = y0;
+        e.x1 = x1;
+        e.y1 = y1;
+        e.dir = 1;
+    }
+    else {
+        e.x0 = x1;
+        e.y0 = y1;
+        e.x1 = x0;
+        e.y1 = y0;
+        e.dir = -1;
+    }
+
+    /*Skip the edges above or below the clip area*/
+    if(e.y1 <= (r->clip_area.y1 << LV_DRAW_SW_RASTER_SHIFT)) return;
+    if(e.y0 >= ((r->clip_area.y2 + 1) << LV_DRAW_SW_RASTER_SHIFT)) return;
+
+    r->y_min = LV_MIN(r->y_min, e.y0);
+    r->y_max = LV_MAX(r->y_max, e.y1);
+    lv_array_push_back(&r->edges, &e);
+}
+
+static void render_band(lv_draw_sw_raster_t * r, int32_t y)
+{
+    clear_band(r);
+
+    r->band_area.y1 = y;
+    r->band_area.y2 = LV_MIN(y + r->band_h - 1, r->clip_area.y2);
+
+    int32_t band_y1 = r->band_area.y1 << LV_DRAW_SW_RASTER_SHIFT;
+    int32_t band_y2 = (r->band_area.y2 + 1) << LV_DRAW_SW_RASTER_SHIFT;
+    int32_t ofs_x = r->clip_area.x1 << LV_DRAW_SW_RASTER_SHIFT;
+
+    uint32_t edge_cnt = lv_array_size(&r->edges);
+    uint32_t i;
+    for(i = 0; i < edge_cnt; i++) {
+        const lv_draw_sw_raster_edge_t * e = lv_array_at(&r->edges, i);
+        int32_t ey0 = LV_MAX(e->y0, band_y1);
+        int32_t ey1 = LV_MIN(e->y1, band_y2);
+        if(ey0 >= ey1) continue;
+
+        /*x change in 1 unit of y with 32 fractional bits. It's precise enough to avoid dividing in each row.*/
+        int64_t slope = ((int64_t)(e->x1 - e->x0) << 32) / (e->y1 - e->y0);
+        int32_t row = (ey0 >> LV_DRAW_SW_RASTER_SHIFT) - r->band_area.y1;
+        int32_t xa = e->x0 + (int32_t)(((ey0 - e->y0) * slope) >> 32);
+        while(ey0 < ey1) {
+            /*The part of the edge in this row*/
+            int32_t ry1 = LV_MIN(ey1, (r->band_area.y1 + row + 1) << LV_DRAW_SW_RASTER_SHIFT);
+            int32_t xb = e->x0 + (int32_t)(((ry1 - e->y0) * slope) >> 32);
+            add_row_segment(r, row, xa - ofs_x, xb - ofs_x, (ry1 - ey0) * e->dir);
+            ey0 = ry1;
+            xa = xb;
+            row++;
+        }
+    }
+}
+
+/**
+ * Clear the cells of the rows of the band which were not read
+ * @param r     pointer to a rasterizer
+ */
+static void clear_band(lv_draw_sw_raster_t * r)
+{
+    int32_t h = lv_area_get_height(&r->band_area);
+    int32_t row;
+    for(row = 0; row < h; row++) {
+        if(r->span_x1[row] == SPAN_EMPTY) continue;
+        int32_t * cells = r->cells + row * r->cell_w;
+        lv_memzero(&cells[r->span_x1[row]], (r->span_x2[row] - r->span_x1[row] + 1) * sizeof(int32_t));
+        r->span_x1[row] = SPAN_EMPTY;
+    }
+}
+
+/**
+ * Add a segment of an edge within a row. The parts out of the clip area are clipped:
+ * the left parts are moved to the left side of the clip area to keep their effect on the
+ * coverage of the row and the right parts are dropped.
+ * @param r     pointer to a rasterizer
+ * @param row   index of the row in the band
+ * @param xa    x coordinate of the top of the segment relative to the left side of the clip area
+ * @param xb    x coordinate of the bottom of the segment relative to the left side of the clip area
+ * @param d     signed height of the segment
+ */
+static void add_row_segment(lv_draw_sw_raster_t * r, int32_t row, int32_t xa, int32_t xb, int32_t d)
+{
+    /*The area on the right of the segment doesn't depend on its direction*/
+    if(xa > xb) {
+        int32_t tmp = xa;
+        xa = xb;
+        xb = tmp;
+    }
+
+    int32_t right = (r->cell_w - 2) << LV_DRAW_SW_RASTER_SHIFT;
+    if(xa >= right) return;
+    if(xb <= 0) {
+        add_cells(r, row, 0, 0, d);
+        return;
+    }
+
+    int32_t len = xb - xa;
+    int32_t d_left = 0;
+    if(xa < 0) {
+        d_left = (int32_t)(((int64_t)d * -xa) / len);
+        add_cells(r, row, 0, 0, d_left);
+    }
+    if(xb > right) {
+        d -= (int32_t)(((int64_t)d * (xb - right)) / len);
+        xb = right;
+    }
+    if(xa < 0) {
+        d -= d_left;
+        xa = 0;
+    }
+
+    add_cells(r, row, xa, xb, d);
+}
+
+/**
+ * Accumulate the area on the right of a segment of an edge in a row
+ * (based on the accumulation of font-rs).
+ * @param r     pointer to a rasterizer
+ * @param row   index of the row in the band
+ * @param x0    the smaller x coordinate of the segment, relative to the left side of the clip area
+ * @param x1    the greater x coordinate of the segment
+ * @param d     signed height of the segment
+ */
+static void LV_ATTRIBUTE_FAST_MEM add_cells(lv_draw_sw_raster_t * r, int32_t row, int32_t x0, int32_t x1, int32_t d)
+{
+    if(d == 0) return;
+
+    int32_t * cells = r->cells + row * r->cell_w;
+    const int32_t one = LV_DRAW_SW_RASTER_ONE;
+    const int32_t total = d * one;
+    int32_t x0i = x0 >> LV_DRAW_SW_RASTER_SHIFT;
+    int32_t x1i = (x1 + one - 1) >> LV_DRAW_SW_RASTER_SHIFT;
+    int32_t last;
+
+    if(x1i <= x0i + 1) {
+        /*In one pixel: split the area by the middle of the segment*/
+        int32_t xmf = ((x0 + x1) >> 1) - (x0i << LV_DRAW_SW_RASTER_SHIFT);
+        int32_t a = d * (one - xmf);
+        cells[x0i] += a;
+        cells[x0i + 1] += total - a;
+        last = x0i + 1;
+    }
+    else {
+        /*`s` is the change of the area in 1 px, the first and last pixels get a triangle*/
+        int64_t s = ((int64_t)1 << (3 * LV_DRAW_SW_RASTER_SHIFT)) / (x1 - x0);
+        int32_t x0f = x0 - (x0i << LV_DRAW_SW_RASTER_SHIFT);
+        int32_t x1f = x1 - (x1i << LV_DRAW_SW_RASTER_SHIFT) + one;
+        int32_t a0 = (int32_t)(((int64_t)(one - x0f) * (one - x0f) * s) >> (2 * LV_DRAW_SW_RASTER_SHIFT + 1));
+        int32_t am = (int32_t)(((int64_t)x1f * x1f * s) >> (2 * LV_DRAW_SW_RASTER_SHIFT + 1));
+
+        int32_t v = (int32_t)(((int64_t)d * a0) >> LV_DRAW_SW_RASTER_SHIFT);
+        int32_t sum = v;
+        cells[x0i] += v;
+        if(x1i == x0i + 2) {
+            v = (int32_t)(((int64_t)d * (CELL_ONE - a0 - am)) >> LV_DRAW_SW_RASTER_SHIFT);
+            cells[x0i + 1] += v;
+            sum += v;
+        }
+        else {
+            int32_t a1 = (int32_t)(((int64_t)(one + one / 2 - x0f) * s) >> LV_DRAW_SW_RASTER_SHIFT);
+            v = (int32_t)(((int64_t)d * (a1 - a0)) >> LV_DRAW_SW_RASTER_SHIFT);
+            cells[x0i + 1] += v;
+            sum += v;
+
+            int32_t ds = (int32_t)((d * s) >> LV_DRAW_SW_RASTER_SHIFT);
+            int32_t xi;
+            for(xi = x0i + 2; xi < x1i - 1; xi++) {
+                cells[xi] += ds;
+                sum += ds;
+            }
+
+            int32_t a2 = a1 + (int32_t)((x1i - x0i - 3) * s);
+            v = (int32_t)(((int64_t)d * (CELL_ONE - a2 - am)) >> LV_DRAW_SW_RASTER_SHIFT);
+            cells[x1i - 1] += v;
+            sum += v;
+        }
+
+        /*Put the rounding error to the last cell so that the sum of the row remains exact*/
+        cells[x1i] += total - sum;
+        last = x1i;
+    }
+
+    if(r->span_x1[row] == SPAN_EMPTY) {
+        r->span_x1[row] = x0i;
+        r->span_x2[row] = last;
+    }
+    else {
+        if(x0i < r->span_x1[row]) r->span_x1[row] = x0i;
+        if(last > r->span_x2[row]) r->span_x2[row] = last;
+    }
+}
+
+#endif /*LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX*/
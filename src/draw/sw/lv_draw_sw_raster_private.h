@@ -0,0 +1,160 @@
+/**
+ * @file lv_draw_sw_raster_private.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_RASTER_PRIVATE_H
+#define LV_DRAW_SW_RASTER_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_draw_sw_mask.h"
+
+#if LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** Number of fractional bits of the coordinates passed to the rasterizer*/
+#define LV_DRAW_SW_RASTER_SHIFT    8
+
+/** 1 pixel in the coordinate system of the rasterizer*/
+#define LV_DRAW_SW_RASTER_ONE      (1 << LV_DRAW_SW_RASTER_SHIFT)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    int32_t x0;     /**< x coordinate of the top point*/
+    int32_t y0;     /**< y coordinate of the top point*/
+    int32_t x1;     /**< x coordinate of the bottom point*/
+    int32_t y1;     /**< y coordinate of the bottom point*/
+    int32_t dir;    /**< 1: the edge goes downward, -1: it goes upward*/
+} lv_draw_sw_raster_edge_t;
+
+/**
+ * Anti-aliased scanline rasterizer. The edges of the shapes are collected in an edge list
+ * and their signed area is accumulated in a band of cells. The coverage of a row is the running
+ * sum of its cells, so the cost depends on the length of the edges and not on the area of the shape.
+ */
+typedef struct {
+    lv_array_t edges;           /**< `lv_draw_sw_raster_edge_t` elements*/
+    lv_area_t clip_area;        /**< Only this area is rendered*/
+    lv_area_t band_area;        /**< The rows of `cells` which are currently rendered*/
+    int32_t * cells;            /**< Accumulated area of the band, `cell_w` cells per row*/
+    int32_t * span_x1;          /**< The first touched cell of each row of the band*/
+    int32_t * span_x2;          /**< The last touched cell of each row of the band*/
+    int32_t cell_w;             /**< Number of cells per row*/
+    int32_t band_h;             /**< Maximal height of a band*/
+    int32_t start_x;            /**< Start of the current sub-path*/
+    int32_t start_y;
+    int32_t last_x;             /**< End of the last added segment*/
+    int32_t last_y;
+    int32_t y_min;              /**< Vertical extent of the edges*/
+    int32_t y_max;
+    int32_t row_y;              /**< The row whose runs are being read*/
+    int32_t row_x;              /**< The next cell of `row_y` to read*/
+    int32_t row_sum;            /**< Running sum of the cells of `row_y` before `row_x`*/
+    bool sub_path_empty;        /**< No segments were added to the current sub-path yet*/
+} lv_draw_sw_raster_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize a rasterizer
+ * @param r             pointer to a rasterizer
+ * @param clip_area     only this area will be rendered
+ * @return              LV_RESULT_INVALID if the buffers couldn't be allocated
+ */
+lv_result_t lv_draw_sw_raster_init(lv_draw_sw_raster_t * r, const lv_area_t * clip_area);
+
+/**
+ * Free the edges and the buffers of a rasterizer
+ * @param r             pointer to a rasterizer
+ */
+void lv_draw_sw_raster_deinit(lv_draw_sw_raster_t * r);
+
+/**
+ * Start a new closed sub-path. The previous sub-path is closed automatically.
+ * The coordinates are in 1/`LV_DRAW_SW_RASTER_ONE` pixel units and
+ * (0;0) is the top left corner of the top left pixel.
+ * @param r             pointer to a rasterizer
+ * @param x             x coordinate of the first point
+ * @param y             y coordinate of the first point
+ */
+void lv_draw_sw_raster_move_to(lv_draw_sw_raster_t * r, int32_t x, int32_t y);
+
+/**
+ * Add a straight segment to the current sub-path
+ * @param r             pointer to a rasterizer
+ * @param x             x coordinate of the end point
+ * @param y             y coordinate of the end point
+ */
+void lv_draw_sw_raster_line_to(lv_draw_sw_raster_t * r, int32_t x, int32_t y);
+
+/**
+ * Add a circular arc to the current sub-path. A segment is added from the end of the
+ * current sub-path to the start of the arc. If the sub-path has no segments yet, it's started
+ * on the start of the arc instead.
+ * The arc is flattened to segments deviating less than 1/64 px from the circle.
+ * @param r             pointer to a rasterizer
+ * @param cx            x coordinate of the center
+ * @param cy            y coordinate of the center
+ * @param radius        radius of the arc
+ * @param start_angle   start angle in 1/`LV_DRAW_SW_RASTER_ONE` degree units. 0° is on the right and it goes clockwise.
+ * @param end_angle     end angle in the same unit. If smaller than `start_angle` the arc goes counterclockwise.
+ */
+void lv_draw_sw_raster_arc_to(lv_draw_sw_raster_t * r, int32_t cx, int32_t cy, int32_t radius,
+                              int32_t start_angle, int32_t end_angle);
+
+/**
+ * Close the current sub-path
+ * @param r             pointer to a rasterizer
+ */
+void lv_draw_sw_raster_close(lv_draw_sw_raster_t * r);
+
+/**
+ * Get the sine of an angle with linear interpolation between the degrees
+ * @param angle         angle in 1/`LV_DRAW_SW_RASTER_ONE` degree units
+ * @return              sine in `LV_TRIGO_SIN_MAX` range
+ */
+int32_t lv_draw_sw_raster_sin(int32_t angle);
+
+/**
+ * Get the next covered run of a row. Call it again with the same `y` to get the following runs of
+ * the row until it returns LV_DRAW_SW_MASK_RES_TRANSP. The runs are separated by wider transparent
+ * gaps, e.g. the hole of a ring. The rows need to be read in increasing order.
+ * The shape is filled with the non-zero rule.
+ * @param r             pointer to a rasterizer
+ * @param y             the row to get
+ * @param buf           a buffer with `lv_area_get_width(clip_area)` elements.
+ *                      The coverage of `x` is written to `buf[x - clip_area.x1]` between `x1` and `x2`
+ * @param x1            store the first pixel of the run here
+ * @param x2            store the last pixel of the run here
+ * @return              LV_DRAW_SW_MASK_RES_TRANSP: no more runs in the row,
+ *                      LV_DRAW_SW_MASK_RES_CHANGED: the coverage of the run is in `buf`
+ */
+lv_draw_sw_mask_res_t lv_draw_sw_raster_get_row(lv_draw_sw_raster_t * r, int32_t y, lv_opa_t * buf,
+                                                int32_t * x1, int32_t * x2);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_RASTER_PRIVATE_H*/
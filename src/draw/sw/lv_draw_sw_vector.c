@@ -9,7 +9,8 @@
 #include "../../image/lv_image_decoder_private.h"
 #include "../lv_draw_vector_private.h"
 #include "../lv_draw_private.h"
-#include "lv_draw_sw.h"
+#include "../../misc/lv_area_private.h"
+#include "lv_draw_sw_private.h"
 
 #if LV_USE_DRAW_SW && LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
 #if LV_USE_THORVG_INTERNAL
@@ -18,8 +19,6 @@
     #include <thorvg_capi.h>
 #endif
 #include "blend/lv_draw_sw_blend_private.h"
-#include "blend/lv_draw_sw_blend_to_rgb565.h"
-#include "blend/lv_draw_sw_blend_to_rgb888.h"
 
 /*********************
  *      DEFINES
@@ -43,8 +42,10 @@ typedef struct {
 } _tvg_color;
 
 typedef struct {
-    Tvg_Canvas * canvas;
-    int32_t partial_y_offset;
+    lv_draw_sw_vector_ctx_t * ctx;
+    uint32_t paint_idx;             /*Index of the next reusable shape in `ctx->paints`*/
+    lv_area_t clip_area;            /*Clip area of the task relative to the target buffer*/
+    bool viewport_set;
     int32_t translate_x;
     int32_t translate_y;
     lv_opa_t opa;
@@ -390,55 +391,64 @@ static void _set_paint_blend_mode(Tvg_Paint * obj, lv_vector_blend_t blend)
     tvg_paint_set_blend_method(obj, lv_blend_to_tvg(blend));
 }
 
-static void _blend_draw_buf(lv_draw_buf_t * draw_buf, const lv_area_t * dst_area, const lv_draw_buf_t * new_buf,
-                            const lv_area_t * src_area)
+static Tvg_Paint * _get_paint(_tvg_draw_state * state)
 {
-    lv_draw_sw_blend_image_dsc_t fill_dsc;
-    fill_dsc.dest_w = src_area->x2;
-    fill_dsc.dest_h = src_area->y2;
-    fill_dsc.dest_stride = draw_buf->header.stride;
-    fill_dsc.dest_buf = draw_buf->data;
-
-    fill_dsc.opa = LV_OPA_100;
-    fill_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
-    fill_dsc.src_stride = new_buf->header.stride;
-    fill_dsc.src_color_format = new_buf->header.cf;
-    fill_dsc.src_buf = new_buf->data;
-
-    fill_dsc.mask_buf = NULL;
-    fill_dsc.mask_stride = 0;
-
-    fill_dsc.relative_area = *dst_area;
-    fill_dsc.src_area  = *src_area;
-
-    switch(draw_buf->header.cf) {
-#if LV_DRAW_SW_SUPPORT_RGB565
-        case LV_COLOR_FORMAT_RGB565:
-        case LV_COLOR_FORMAT_RGB565A8:
-            lv_draw_sw_blend_image_to_rgb565(&fill_dsc);
-            break;
-#endif
-#if LV_DRAW_SW_SUPPORT_RGB888
-        case LV_COLOR_FORMAT_RGB888:
-            lv_draw_sw_blend_image_to_rgb888(&fill_dsc, 3);
-            break;
-#endif
-        default:
-            break;
+    lv_draw_sw_vector_ctx_t * ctx = state->ctx;
+    Tvg_Paint * obj;
+
+    if(state->paint_idx < lv_array_size(&ctx->paints)) {
+        obj = *(Tvg_Paint **)lv_array_at(&ctx->paints, state->paint_idx);
+
+        /*Restore what a new shape would have. The stroke can't be removed
+         *but a zero width stroke is not drawn*/
+        tvg_shape_reset(obj);
+        tvg_shape_set_fill_color(obj, 0, 0, 0, 0);
+        tvg_shape_set_fill_rule(obj, TVG_FILL_RULE_WINDING);
+        tvg_shape_set_stroke_width(obj, 0);
+        tvg_shape_set_stroke_color(obj, 0, 0, 0, 0);
+        tvg_shape_set_stroke_dash(obj, NULL, 0);
+        tvg_paint_set_blend_method(obj, TVG_BLEND_METHOD_NORMAL);
+    }
+    else {
+        obj = tvg_shape_new();
+        /*The pool holds a reference, so clearing the canvas won't free the shape*/
+        tvg_scene_push(ctx->paint_pool, obj);
+        lv_array_push_back(&ctx->paints, &obj);
+    }
+
+    state->paint_idx++;
+    return obj;
+}
+
+static void _set_viewport(_tvg_draw_state * state, const lv_area_t * scissor_area)
+{
+    /*The viewport can be set only before the first shape is pushed*/
+    if(state->viewport_set) return;
+    state->viewport_set = true;
+
+    lv_area_t vp = state->clip_area;
+    if(scissor_area) {
+        lv_area_t scissor = *scissor_area;
+        lv_area_move(&scissor, state->translate_x, state->translate_y);
+        if(!lv_area_intersect(&vp, &vp, &scissor)) lv_area_set(&vp, 0, 0, -1, -1);
     }
+
+    tvg_canvas_set_viewport(state->ctx->canvas, vp.x1, vp.y1, lv_area_get_width(&vp), lv_area_get_height(&vp));
 }
 
 static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_vector_path_ctx_t * dsc)
 {
     _tvg_draw_state * state = (_tvg_draw_state *)ctx;
-    Tvg_Canvas * canvas = (Tvg_Canvas *)state->canvas;
+    Tvg_Canvas * canvas = (Tvg_Canvas *)state->ctx->canvas;
 
-    Tvg_Paint * obj = tvg_shape_new();
+    Tvg_Paint * obj = _get_paint(state);
 
     _tvg_rect rc;
     lv_area_to_tvg(&rc, &dsc->scissor_area);
 
     if(!path) {  /*clear*/
+        _set_viewport(state, NULL);
+
         _tvg_color c;
         lv_color_to_tvg(&c, &dsc->fill_dsc.color, dsc->fill_dsc.opa);
 
@@ -452,8 +462,7 @@ static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_ve
         tvg_shape_set_fill_color(obj, c.r, c.g, c.b, c.a);
     }
     else {
-        tvg_canvas_set_viewport(canvas, (int32_t)rc.x + state->translate_x, (int32_t)rc.y + state->translate_y,
-                                (int32_t)rc.w, (int32_t)rc.h);
+        _set_viewport(state, &dsc->scissor_area);
 
         lv_matrix_t matrix;
         lv_matrix_identity(&matrix);
@@ -473,6 +482,49 @@ static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_ve
     tvg_canvas_push(canvas, obj);
 }
 
+static bool _ctx_init(lv_draw_sw_vector_ctx_t * ctx)
+{
+    if(ctx->canvas) return true;
+
+    ctx->canvas = tvg_swcanvas_create();
+    if(ctx->canvas == NULL) return false;
+
+    /*The threads render in parallel so they can't share the outline buffers*/
+    tvg_swcanvas_set_mempool(ctx->canvas, TVG_MEMPOOL_POLICY_INDIVIDUAL);
+
+    ctx->paint_pool = tvg_scene_new();
+    lv_array_init(&ctx->paints, 8, sizeof(Tvg_Paint *));
+    return true;
+}
+
+static void _ctx_set_target(lv_draw_sw_vector_ctx_t * ctx, void * buf, uint32_t stride, int32_t w, int32_t h)
+{
+    /*Setting the target frees the compositor buffers so do it only if the target changes*/
+    if(ctx->target_buf == buf && ctx->target_stride == stride && ctx->target_w == w && ctx->target_h == h) return;
+
+    tvg_swcanvas_set_target(ctx->canvas, buf, stride / 4, w, h, TVG_COLORSPACE_ARGB8888);
+    ctx->target_buf = buf;
+    ctx->target_stride = stride;
+    ctx->target_w = w;
+    ctx->target_h = h;
+}
+
+static lv_draw_sw_vector_ctx_t * _get_thread_ctx(lv_draw_task_t * t)
+{
+    lv_draw_sw_unit_t * u = (lv_draw_sw_unit_t *)t->draw_unit;
+    if(u == NULL) return NULL;
+
+#if LV_USE_OS
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        if(u->thread_dscs[i].task_act == t) return &u->thread_dscs[i].vector_ctx;
+    }
+    return NULL;
+#else
+    return u->task_act == t ? &u->vector_ctx : NULL;
+#endif
+}
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -487,48 +539,110 @@ void lv_draw_sw_vector(lv_draw_task_t * t, lv_draw_vector_dsc_t * dsc)
     if(draw_buf == NULL)
         return;
 
-    void * buf = draw_buf->data;
-    int32_t width = lv_area_get_width(&layer->buf_area);
-    int32_t height = lv_area_get_height(&layer->buf_area);
-    uint32_t stride = draw_buf->header.stride;
-
-    lv_color_format_t cf = draw_buf->header.cf;
+    lv_area_t clip_area;
+    if(!lv_area_intersect(&clip_area, &t->clip_area, &layer->buf_area)) {
+        lv_vector_for_each_destroy_tasks(dsc->task_list, NULL, NULL);
+        dsc->task_list = NULL;
+        return;
+    }
 
-    bool allow_buffer = false;
-    lv_draw_buf_t * new_buf = NULL;
+    /*Tasks not dispatched to a render thread (e.g. vector glyphs) use a temporary context*/
+    lv_draw_sw_vector_ctx_t tmp_ctx;
+    lv_draw_sw_vector_ctx_t * ctx = _get_thread_ctx(t);
+    if(ctx == NULL) {
+        lv_memzero(&tmp_ctx, sizeof(tmp_ctx));
+        ctx = &tmp_ctx;
+    }
 
-    if(cf != LV_COLOR_FORMAT_ARGB8888 && \
-       cf != LV_COLOR_FORMAT_XRGB8888) {
-        allow_buffer = true;
-        new_buf = lv_draw_buf_create(width, height, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
-        lv_draw_buf_clear(new_buf, NULL);
-        buf = new_buf->data;
-        stride = new_buf->header.stride;
+    if(!_ctx_init(ctx)) {
+        LV_LOG_WARN("Couldn't create the ThorVG canvas");
+        lv_vector_for_each_destroy_tasks(dsc->task_list, NULL, NULL);
+        dsc->task_list = NULL;
+        return;
     }
-    Tvg_Canvas * canvas = tvg_swcanvas_create();
-    tvg_swcanvas_set_target(canvas, buf, stride / 4, width, height, TVG_COLORSPACE_ARGB8888);
 
-    _tvg_rect rc;
-    lv_area_to_tvg(&rc, &t->clip_area);
-    tvg_canvas_set_viewport(canvas, (int32_t)rc.x, (int32_t)(rc.y - layer->partial_y_offset), (int32_t)rc.w, (int32_t)rc.h);
+    lv_color_format_t cf = draw_buf->header.cf;
+    bool argb_target = cf == LV_COLOR_FORMAT_ARGB8888 || cf == LV_COLOR_FORMAT_XRGB8888;
+
+    /*ThorVG draws to ARGB8888 only. Other color formats are drawn to a buffer
+     *as large as the clip area and blended from there*/
+    const lv_area_t * target_area;
+    if(argb_target) {
+        target_area = &layer->buf_area;
+        _ctx_set_target(ctx, draw_buf->data, draw_buf->header.stride,
+                        lv_area_get_width(&layer->buf_area), lv_area_get_height(&layer->buf_area));
+    }
+    else {
+        int32_t w = lv_area_get_width(&clip_area);
+        int32_t h = lv_area_get_height(&clip_area);
+        if(ctx->argb_buf == NULL ||
+           lv_draw_buf_reshape(ctx->argb_buf, LV_COLOR_FORMAT_ARGB8888, w, h, LV_STRIDE_AUTO) == NULL) {
+            if(ctx->argb_buf) lv_draw_buf_destroy(ctx->argb_buf);
+            ctx->argb_buf = lv_draw_buf_create(w, h, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+            if(ctx->argb_buf == NULL) {
+                LV_LOG_WARN("Couldn't allocate the ARGB8888 buffer");
+                lv_vector_for_each_destroy_tasks(dsc->task_list, NULL, NULL);
+                dsc->task_list = NULL;
+                if(ctx == &tmp_ctx) lv_draw_sw_vector_ctx_deinit(ctx);
+                return;
+            }
+        }
+        lv_draw_buf_clear(ctx->argb_buf, NULL);
+        target_area = &clip_area;
+        _ctx_set_target(ctx, ctx->argb_buf->data, ctx->argb_buf->header.stride, w, h);
+    }
 
-    _tvg_draw_state state = {canvas, layer->partial_y_offset, -layer->buf_area.x1, -layer->buf_area.y1, t->opa};
+    _tvg_draw_state state;
+    lv_memzero(&state, sizeof(state));
+    state.ctx = ctx;
+    state.translate_x = -target_area->x1;
+    state.translate_y = -target_area->y1;
+    state.opa = t->opa;
+    state.clip_area = clip_area;
+    lv_area_move(&state.clip_area, state.translate_x, state.translate_y);
 
     lv_ll_t * task_list = dsc->task_list;
     lv_vector_for_each_destroy_tasks(task_list, _task_draw_cb, &state);
     dsc->task_list = NULL;
 
+    Tvg_Canvas * canvas = ctx->canvas;
     if(tvg_canvas_draw(canvas) == TVG_RESULT_SUCCESS) {
         tvg_canvas_sync(canvas);
     }
 
-    if(allow_buffer) {
-        lv_area_t src_area = {0, 0, width, height};
-        _blend_draw_buf(draw_buf, &layer->buf_area, new_buf, &src_area);
-        lv_draw_buf_destroy(new_buf);
+    /*Release the pictures of patterns but keep the pooled shapes.
+     *Clearing resets the viewport of the renderer, so reset the canvas's too.*/
+    tvg_canvas_clear(canvas, true);
+    tvg_canvas_set_viewport(canvas, 0, 0, ctx->target_w, ctx->target_h);
+
+    if(!argb_target) {
+        lv_draw_sw_blend_dsc_t blend_dsc;
+        lv_memzero(&blend_dsc, sizeof(blend_dsc));
+        blend_dsc.blend_area = &clip_area;
+        blend_dsc.src_area = &clip_area;
+        blend_dsc.src_buf = ctx->argb_buf->data;
+        blend_dsc.src_stride = ctx->argb_buf->header.stride;
+        blend_dsc.src_color_format = LV_COLOR_FORMAT_ARGB8888;
+        blend_dsc.opa = LV_OPA_COVER;
+        blend_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+        lv_draw_sw_blend(t, &blend_dsc);
     }
 
-    tvg_canvas_destroy(canvas);
+    if(ctx == &tmp_ctx) lv_draw_sw_vector_ctx_deinit(ctx);
+}
+
+void lv_draw_sw_vector_ctx_deinit(lv_draw_sw_vector_ctx_t * ctx)
+{
+    if(ctx->canvas) {
+        tvg_canvas_destroy(ctx->canvas);
+        /*Frees the pooled shapes too*/
+        tvg_paint_del(ctx->paint_pool);
+        lv_array_deinit(&ctx->paints);
+    }
+
+    if(ctx->argb_buf) lv_draw_buf_destroy(ctx->argb_buf);
+
+    lv_memzero(ctx, sizeof(lv_draw_sw_vector_ctx_t));
 }
 
 /**********************
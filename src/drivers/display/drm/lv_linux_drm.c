@@ -39,7 +39,14 @@
     #error LV_COLOR_DEPTH not supported
 #endif
 
-#define BUFFER_CNT 2
+#define BUFFER_CNT LV_LINUX_DRM_BUFFER_COUNT
+
+#if BUFFER_CNT < 2 || BUFFER_CNT > 3
+    #error LV_LINUX_DRM_BUFFER_COUNT must be 2 or 3
+#endif
+
+/*Should be at least the number of invalidated areas of LVGL*/
+#define DAMAGE_CLIP_CNT 32
 
 /**********************
  *      TYPEDEFS
@@ -51,6 +58,10 @@ typedef struct {
     unsigned long int size;
     uint8_t * map;
     uint32_t fb_handle;
+    struct drm_mode_rect damage[DAMAGE_CLIP_CNT];
+    uint32_t damage_cnt;
+    bool damage_full;       /*Too many areas, update the whole plane*/
+    uint64_t flush_time_us; /*When the rendering was finished*/
 } drm_buffer_t;
 
 typedef struct {
@@ -75,6 +86,17 @@ typedef struct {
     drmModePropertyPtr conn_props[128];
     drm_buffer_t drm_bufs[BUFFER_CNT];
     drm_buffer_t * act_buf;
+    drm_buffer_t * pending_buf;  /*Committed, waiting for the page flip*/
+    drm_buffer_t * queued_buf;   /*Rendered, waiting for the pending flip to complete*/
+#if BUFFER_CNT > 2
+    lv_draw_buf_t buf3;
+#endif
+    uint64_t commit_time_us;
+    uint64_t flip_time_us;
+    uint32_t flip_sequence;
+    uint32_t vblank_period_us;
+    uint64_t latency_sum_us;
+    lv_linux_drm_flip_stats_t stats;
 #if LV_USE_LINUX_DRM_GBM_BUFFERS
     struct gbm_device * gbm_device;
 #endif
@@ -110,6 +132,9 @@ static uint32_t tick_get_cb(void);
 
 static int drm_setup_buffers(drm_dev_t * drm_dev);
 static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf);
+static void drm_add_damage(drm_buffer_t * buf, const lv_area_t * area);
+static uint32_t get_flip_in_progress_cnt(drm_dev_t * drm_dev);
+static uint64_t time_get_us(void);
 static void drm_flush_wait(lv_display_t * drm_dev);
 static void drm_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 static void drm_dmabuf_set_active_buf(lv_event_t * event);
@@ -175,6 +200,8 @@ static void drm_dmabuf_set_active_buf(lv_event_t * event)
         for(i = 0; i < BUFFER_CNT; i++) {
             if(act_buf->unaligned_data == drm_dev->drm_bufs[i].map) {
                 drm_dev->act_buf = &drm_dev->drm_bufs[i];
+                drm_dev->act_buf->damage_cnt = 0;
+                drm_dev->act_buf->damage_full = false;
                 LV_LOG_TRACE("Set active buffer idx: %d", i);
                 break;
             }
@@ -233,6 +260,18 @@ lv_result_t lv_linux_drm_set_file(lv_display_t * disp, const char * file, int64_
     lv_display_set_buffers_with_stride(disp, drm_dev->drm_bufs[1].map, drm_dev->drm_bufs[0].map, buf_size,
                                        stride, LV_DISPLAY_RENDER_MODE_DIRECT);
 
+#if BUFFER_CNT > 2
+    /* With a third buffer the next frame can be rendered while the previous one waits for vblank */
+    lv_draw_buf_init(&drm_dev->buf3, hor_res, ver_res, lv_display_get_color_format(disp), stride,
+                     drm_dev->drm_bufs[2].map, LV_MIN(buf_size, drm_dev->drm_bufs[2].size));
+    lv_display_set_3rd_draw_buffer(disp, &drm_dev->buf3);
+#endif
+
+    /* The pixel clock is in kHz. It's more precise than the rounded refresh rate */
+    if(drm_dev->mode.clock) {
+        drm_dev->vblank_period_us = (uint32_t)((uint64_t)drm_dev->mode.htotal * drm_dev->mode.vtotal * 1000 /
+                                               drm_dev->mode.clock);
+    }
 
     /* Set the handler that is called before a redraw occurs to set the active buffer/plane
      * when GBM buffers are used the DMA_BUF_SYNC_START is issued there */
@@ -253,6 +292,46 @@ void lv_linux_drm_set_mode_cb(lv_display_t * disp, lv_linux_drm_select_mode_cb_t
     LV_UNUSED(callback);
     LV_LOG_WARN("DRM without EGL support doesn't currently support setting a mode selection callback");
 }
+
+int lv_linux_drm_get_fd(lv_display_t * disp)
+{
+    drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
+    LV_ASSERT_NULL(drm_dev);
+    return drm_dev->fd;
+}
+
+void lv_linux_drm_handle_events(lv_display_t * disp)
+{
+    drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
+    LV_ASSERT_NULL(drm_dev);
+    if(drm_dev->fd < 0) return;
+
+    struct pollfd pfd;
+    pfd.fd = drm_dev->fd;
+    pfd.events = POLLIN;
+
+    /*drmHandleEvent blocks on read() so call it only if there is something to read*/
+    while(poll(&pfd, 1, 0) > 0) {
+        drmHandleEvent(drm_dev->fd, &drm_dev->drm_event_ctx);
+    }
+}
+
+void lv_linux_drm_get_flip_stats(lv_display_t * disp, lv_linux_drm_flip_stats_t * stats)
+{
+    drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
+    LV_ASSERT_NULL(drm_dev);
+    LV_ASSERT_NULL(stats);
+    *stats = drm_dev->stats;
+}
+
+void lv_linux_drm_reset_flip_stats(lv_display_t * disp)
+{
+    drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
+    LV_ASSERT_NULL(drm_dev);
+    lv_memzero(&drm_dev->stats, sizeof(drm_dev->stats));
+    drm_dev->latency_sum_us = 0;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -306,15 +385,47 @@ static void page_flip_handler(int fd, unsigned int sequence, unsigned int tv_sec
                               void * user_data)
 {
     LV_UNUSED(fd);
-    LV_UNUSED(sequence);
-    LV_UNUSED(tv_sec);
-    LV_UNUSED(tv_usec);
     LV_LOG_TRACE("flip");
     drm_dev_t * drm_dev = user_data;
     if(drm_dev->req) {
         drmModeAtomicFree(drm_dev->req);
         drm_dev->req = NULL;
     }
+
+    /* The timestamp of the vblank when the new buffer was latched (CLOCK_MONOTONIC) */
+    uint64_t flip_time_us = (uint64_t)tv_sec * 1000000 + tv_usec;
+    drm_buffer_t * buf = drm_dev->pending_buf;
+    drm_dev->pending_buf = NULL;
+
+    if(buf) {
+        lv_linux_drm_flip_stats_t * stats = &drm_dev->stats;
+        uint32_t latency = flip_time_us > buf->flush_time_us ? (uint32_t)(flip_time_us - buf->flush_time_us) : 0;
+        stats->flip_cnt++;
+        stats->last_latency_us = latency;
+        stats->max_latency_us = LV_MAX(stats->max_latency_us, latency);
+        drm_dev->latency_sum_us += latency;
+        stats->avg_latency_us = (uint32_t)(drm_dev->latency_sum_us / stats->flip_cnt);
+
+        /* A commit should be latched on the first vblank after it. Find that vblank's sequence
+         * number based on the previous flip and count the vblanks it has waited in addition */
+        if(drm_dev->vblank_period_us && drm_dev->flip_time_us && drm_dev->commit_time_us > drm_dev->flip_time_us) {
+            uint32_t expected = drm_dev->flip_sequence + 1 +
+                                (uint32_t)((drm_dev->commit_time_us - drm_dev->flip_time_us) / drm_dev->vblank_period_us);
+            if((int32_t)(sequence - expected) > 0) stats->missed_vblank_cnt += sequence - expected;
+        }
+    }
+
+    drm_dev->flip_sequence = sequence;
+    drm_dev->flip_time_us = flip_time_us;
+
+    /* Scan out the frame which was rendered while waiting for this flip */
+    if(drm_dev->queued_buf) {
+        buf = drm_dev->queued_buf;
+        drm_dev->queued_buf = NULL;
+        if(drm_dmabuf_set_plane(drm_dev, buf)) {
+            LV_LOG_ERROR("Flush fail");
+        }
+    }
 }
 
 static int drm_get_plane_props(drm_dev_t * drm_dev)
@@ -442,17 +553,7 @@ static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf)
     int ret;
     static int first = 1;
     uint32_t flags = DRM_MODE_PAGE_FLIP_EVENT | DRM_MODE_ATOMIC_NONBLOCK;
-
-#if LV_USE_LINUX_DRM_GBM_BUFFERS
-
-    struct dma_buf_sync sync_req;
-
-    sync_req.flags = DMA_BUF_SYNC_END | DMA_BUF_SYNC_RW;
-    if(ioctl(buf->handle, DMA_BUF_IOCTL_SYNC, &sync_req) != 0) {
-        LV_LOG_ERROR("Failed to end DMA-BUF R/W SYNC");
-    }
-
-#endif
+    uint32_t damage_blob_id = 0;
 
     drm_dev->req = drmModeAtomicAlloc();
 
@@ -479,16 +580,53 @@ static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf)
     drm_add_plane_property(drm_dev, "CRTC_W", drm_dev->width);
     drm_add_plane_property(drm_dev, "CRTC_H", drm_dev->height);
 
+    /* Tell the kernel which regions have changed since the previous commit, so
+     * drivers with self refresh panels or shadow buffers update only those */
+    if(!buf->damage_full && buf->damage_cnt > 0 && get_plane_property_id(drm_dev, "FB_DAMAGE_CLIPS")) {
+        if(drmModeCreatePropertyBlob(drm_dev->fd, buf->damage, buf->damage_cnt * sizeof(struct drm_mode_rect),
+                                     &damage_blob_id) == 0) {
+            drm_add_plane_property(drm_dev, "FB_DAMAGE_CLIPS", damage_blob_id);
+        }
+        else {
+            damage_blob_id = 0;
+        }
+    }
+
     ret = drmModeAtomicCommit(drm_dev->fd, drm_dev->req, flags, drm_dev);
+
+    /* The request holds a reference to the blob */
+    if(damage_blob_id) drmModeDestroyPropertyBlob(drm_dev->fd, damage_blob_id);
+
     if(ret) {
         LV_LOG_ERROR("drmModeAtomicCommit failed: %s (%d)", strerror(errno), errno);
         drmModeAtomicFree(drm_dev->req);
+        drm_dev->req = NULL;
         return ret;
     }
 
+    drm_dev->pending_buf = buf;
+    drm_dev->commit_time_us = time_get_us();
+
     return 0;
 }
 
+static void drm_add_damage(drm_buffer_t * buf, const lv_area_t * area)
+{
+    if(buf->damage_full) return;
+
+    if(buf->damage_cnt >= DAMAGE_CLIP_CNT) {
+        buf->damage_full = true;
+        return;
+    }
+
+    struct drm_mode_rect * rect = &buf->damage[buf->damage_cnt];
+    rect->x1 = area->x1;
+    rect->y1 = area->y1;
+    rect->x2 = area->x2 + 1;
+    rect->y2 = area->y2 + 1;
+    buf->damage_cnt++;
+}
+
 static int find_plane(drm_dev_t * drm_dev, unsigned int fourcc, uint32_t * plane_id, uint32_t crtc_id,
                       uint32_t crtc_idx)
 {
@@ -1011,29 +1149,21 @@ static int create_gbm_buffer(drm_dev_t * drm_dev, drm_buffer_t * buf)
 static int drm_setup_buffers(drm_dev_t * drm_dev)
 {
     int ret;
+    int i;
 
+    for(i = 0; i < BUFFER_CNT; i++) {
 #if LV_USE_LINUX_DRM_GBM_BUFFERS
-    ret = create_gbm_buffer(drm_dev, &drm_dev->drm_bufs[0]);
-    if(ret < 0) {
-        return ret;
-    }
-
-    ret = create_gbm_buffer(drm_dev, &drm_dev->drm_bufs[1]);
-    if(ret < 0) {
-        return ret;
-    }
-
+        ret = create_gbm_buffer(drm_dev, &drm_dev->drm_bufs[i]);
+        if(ret < 0) {
+            return ret;
+        }
 #else
-    /* Use dumb buffers */
-    ret = drm_allocate_dumb(drm_dev, &drm_dev->drm_bufs[0]);
-    if(ret)
-        return ret;
-
-    ret = drm_allocate_dumb(drm_dev, &drm_dev->drm_bufs[1]);
-    if(ret)
-        return ret;
-
+        /* Use dumb buffers */
+        ret = drm_allocate_dumb(drm_dev, &drm_dev->drm_bufs[i]);
+        if(ret)
+            return ret;
 #endif
+    }
 
     return 0;
 }
@@ -1046,7 +1176,10 @@ static void drm_flush_wait(lv_display_t * disp)
     pfd.fd = drm_dev->fd;
     pfd.events = POLLIN;
 
-    while(drm_dev->req) {
+    /* The buffer LVGL renders into next is free if at most BUFFER_CNT - 2 flips are in progress.
+     * I.e. with double buffering wait for the pending flip, with triple buffering only if
+     * a frame is already queued behind it */
+    while(get_flip_in_progress_cnt(drm_dev) > BUFFER_CNT - 2) {
         int ret;
         do {
             ret = poll(&pfd, 1, -1);
@@ -1063,21 +1196,47 @@ static void drm_flush_wait(lv_display_t * disp)
 
 static void drm_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
 {
-    if(!lv_display_flush_is_last(disp)) return;
-
-    LV_UNUSED(area);
     LV_UNUSED(px_map);
     drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
 
     LV_ASSERT(drm_dev->act_buf != NULL);
 
-    if(drm_dmabuf_set_plane(drm_dev, drm_dev->act_buf)) {
-        LV_LOG_ERROR("Flush fail");
-        return;
+    drm_add_damage(drm_dev->act_buf, area);
+
+    if(!lv_display_flush_is_last(disp)) return;
+
+    drm_buffer_t * buf = drm_dev->act_buf;
+    buf->flush_time_us = time_get_us();
+
+#if LV_USE_LINUX_DRM_GBM_BUFFERS
+    struct dma_buf_sync sync_req;
+
+    sync_req.flags = DMA_BUF_SYNC_END | DMA_BUF_SYNC_RW;
+    if(ioctl(buf->handle, DMA_BUF_IOCTL_SYNC, &sync_req) != 0) {
+        LV_LOG_ERROR("Failed to end DMA-BUF R/W SYNC");
     }
+#endif
 
     drm_dev->act_buf = NULL;
 
+    /* Only one commit can be in flight. Queue the buffer and commit it from the page flip handler */
+    if(drm_dev->pending_buf) {
+        drm_dev->queued_buf = buf;
+        drm_dev->stats.queued_cnt++;
+        return;
+    }
+
+    if(drm_dmabuf_set_plane(drm_dev, buf)) {
+        LV_LOG_ERROR("Flush fail");
+    }
+}
+
+static uint32_t get_flip_in_progress_cnt(drm_dev_t * drm_dev)
+{
+    uint32_t cnt = 0;
+    if(drm_dev->pending_buf) cnt++;
+    if(drm_dev->queued_buf) cnt++;
+    return cnt;
 }
 
 static void drm_del_event_cb(lv_event_t * e)
@@ -1205,6 +1364,13 @@ static void drm_del_event_cb(lv_event_t * e)
     lv_free(drm_dev);
 }
 
+static uint64_t time_get_us(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000 + t.tv_nsec / 1000;
+}
+
 static uint32_t tick_get_cb(void)
 {
     struct timespec t;
@@ -79,6 +79,7 @@ typedef struct {
 
 static void del_event_cb(lv_event_t * e);
 static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * color_p);
+static void flush_finish(lv_display_t * disp, lv_linux_fb_t * dsc);
 static uint32_t tick_get_cb(void);
 
 /**********************
@@ -328,48 +329,51 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
     const lv_color_format_t cf = lv_display_get_color_format(disp);
     const uint32_t px_size = lv_color_format_get_size(cf);
 
+    lv_area_t display_area;
+    lv_area_set(&display_area, 0, 0, dsc->vinfo.xres - 1, dsc->vinfo.yres - 1);
+
     lv_area_t rotated_area;
     const lv_display_rotation_t rotation = lv_display_get_rotation(disp);
 
     /* Not all framebuffer kernel drivers support hardware rotation, so we need to handle it in software here */
     if(rotation != LV_DISPLAY_ROTATION_0) {
-        int32_t src_w;
-        int32_t src_h;
+        const int32_t src_w = lv_area_get_width(area);
+        const int32_t src_h = lv_area_get_height(area);
         uint32_t src_stride;
 
-        /* Direct render mode rotation only works if we rotate the whole screen at the same time
-         * To do that, we use the display's resolution and as the area
-         *  we also grab the current draw buffer so that we can rotate the whole display */
+        /* In direct render mode the draw buffer has the size of the screen, so rotate only
+         * the flushed area of it. This way only the damaged areas are rotated and
+         * there is no need to wait for the last flush */
         if(LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_DIRECT) {
-            if(!is_last_flush) {
-                /* We need to wait for the last flush when using direct render mode with rotation*/
-                lv_display_flush_ready(disp);
-                return;
-            }
-            lv_draw_buf_t * draw_buf = lv_display_get_buf_active(disp);
-            src_w = lv_display_get_horizontal_resolution(disp);
-            src_h = lv_display_get_vertical_resolution(disp);
-            src_stride = lv_draw_buf_width_to_stride(src_w, cf);
-            color_p = draw_buf->data;
-            rotated_area.x1 = rotated_area.y1 =  0;
-            lv_area_set_width(&rotated_area, src_w);
-            lv_area_set_height(&rotated_area, src_h);
+            src_stride = lv_draw_buf_width_to_stride(lv_display_get_horizontal_resolution(disp), cf);
+            color_p += (area->y1 - disp->offset_y) * src_stride + (area->x1 - disp->offset_x) * px_size;
         }
         else {
-            /* For partial and full render modes, we need to rotate the current area
-             * In Full mode we will rotate the whole display just like with direct render mode
-             * but we don't need to do anything special since the area is already the full area of the display
-             * For Partial mode we will rotate just the part we're currently displaying*/
-            src_w = lv_area_get_width(area);
-            src_h = lv_area_get_height(area);
-            src_stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), cf);
-            rotated_area = *area;
+            /* For partial and full render modes the buffer contains only the current area
+             * In Full mode it's the whole display */
+            src_stride = lv_draw_buf_width_to_stride(src_w, cf);
         }
 
+        rotated_area = *area;
         lv_display_rotate_area(disp, &rotated_area);
+
+#if LV_LINUX_FBDEV_MMAP
+        /* Rotate straight into the framebuffer when the area is fully on the screen.
+         * The rows of the framebuffer are written sequentially, so it works well with write-combined memory too */
+        if(lv_area_is_in(&rotated_area, &display_area, 0)) {
+            uint8_t * fbp = (uint8_t *)dsc->fbp;
+            fbp += (rotated_area.x1 + dsc->vinfo.xoffset) * px_size +
+                   (rotated_area.y1 + dsc->vinfo.yoffset) * dsc->finfo.line_length;
+            lv_draw_sw_rotate(color_p, fbp, src_w, src_h, src_stride, dsc->finfo.line_length, rotation, cf);
+            flush_finish(disp, dsc);
+            return;
+        }
+#endif
+
+        /* Otherwise rotate the area into a temporary buffer and copy the visible part from there */
         const uint32_t dest_stride = lv_draw_buf_width_to_stride(lv_area_get_width(&rotated_area), cf);
         const size_t buf_size = dest_stride * lv_area_get_height(&rotated_area);
-        if(!dsc->rotated_buf || dsc->rotated_buf_size != buf_size) {
+        if(!dsc->rotated_buf || dsc->rotated_buf_size < buf_size) {
             dsc->rotated_buf = lv_realloc(dsc->rotated_buf, buf_size);
             LV_ASSERT_MALLOC(dsc->rotated_buf);
             dsc->rotated_buf_size = buf_size;
@@ -379,9 +383,6 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
         color_p = dsc->rotated_buf;
     }
 
-    lv_area_t display_area;
-    lv_area_set(&display_area, 0, 0, dsc->vinfo.xres - 1, dsc->vinfo.yres - 1);
-
     /* Clip the area to the display bounds */
     lv_area_t clipped_area;
     if(!lv_area_intersect(&clipped_area, area, &display_area)) {
@@ -420,6 +421,11 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
         }
     }
 
+    flush_finish(disp, dsc);
+}
+
+static void flush_finish(lv_display_t * disp, lv_linux_fb_t * dsc)
+{
     if(dsc->force_refresh) {
         dsc->vinfo.activate |= FB_ACTIVATE_NOW | FB_ACTIVATE_FORCE;
         if(ioctl(dsc->fbfd, FBIOPUT_VSCREENINFO, &(dsc->vinfo)) == -1) {
@@ -0,0 +1,251 @@
+/**
+ * @file lv_headless_display.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lvgl_public.h"
+#if LV_USE_HEADLESS_DISPLAY
+
+#include <time.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_draw_buf_t * draw_buf_1;
+    lv_draw_buf_t * draw_buf_2;
+    lv_draw_buf_t * sink;
+
+    uint32_t latency_us;
+    uint32_t kbyte_per_sec;
+    uint64_t transfer_end_us;   /*When the simulated transfer of the last flushed area is finished*/
+
+    lv_headless_display_frame_cb_t frame_cb;
+    void * frame_cb_user_data;
+
+    uint64_t refr_start_us;
+    uint64_t flush_elaps_us;
+    uint32_t refr_start_task_cnt;
+    lv_headless_display_frame_info_t frame;
+} lv_headless_display_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static void flush_wait_cb(lv_display_t * disp);
+static void refr_start_event_cb(lv_event_t * e);
+static void refr_ready_event_cb(lv_event_t * e);
+static void delete_event_cb(lv_event_t * e);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_display_t * lv_headless_display_create(int32_t hor_res, int32_t ver_res, lv_display_render_mode_t render_mode)
+{
+    lv_headless_display_t * dsc = lv_malloc_zeroed(sizeof(lv_headless_display_t));
+    LV_ASSERT_MALLOC(dsc);
+    if(dsc == NULL) return NULL;
+
+    lv_display_t * disp = lv_display_create(hor_res, ver_res);
+    if(disp == NULL) {
+        lv_free(dsc);
+        return NULL;
+    }
+
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+    int32_t buf_h = render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL ? LV_MAX(ver_res / 10, 1) : ver_res;
+    dsc->draw_buf_1 = lv_draw_buf_create(hor_res, buf_h, cf, LV_STRIDE_AUTO);
+    dsc->draw_buf_2 = lv_draw_buf_create(hor_res, buf_h, cf, LV_STRIDE_AUTO);
+    if(dsc->draw_buf_1 == NULL || dsc->draw_buf_2 == NULL) {
+        LV_LOG_ERROR("Couldn't allocate the draw buffers");
+        if(dsc->draw_buf_1) lv_draw_buf_destroy(dsc->draw_buf_1);
+        if(dsc->draw_buf_2) lv_draw_buf_destroy(dsc->draw_buf_2);
+        lv_display_delete(disp);
+        lv_free(dsc);
+        return NULL;
+    }
+
+    lv_display_set_draw_buffers(disp, dsc->draw_buf_1, dsc->draw_buf_2);
+    lv_display_set_render_mode(disp, render_mode);
+    lv_display_set_driver_data(disp, dsc);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_flush_wait_cb(disp, flush_wait_cb);
+    lv_display_add_event_cb(disp, refr_start_event_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(disp, refr_ready_event_cb, LV_EVENT_REFR_READY, NULL);
+    lv_display_add_event_cb(disp, delete_event_cb, LV_EVENT_DELETE, NULL);
+
+    return disp;
+}
+
+void lv_headless_display_set_transfer_time(lv_display_t * disp, uint32_t latency_us, uint32_t kbyte_per_sec)
+{
+    lv_headless_display_t * dsc = lv_display_get_driver_data(disp);
+    LV_ASSERT_NULL(dsc);
+
+    dsc->latency_us = latency_us;
+    dsc->kbyte_per_sec = kbyte_per_sec;
+}
+
+lv_result_t lv_headless_display_set_memory_sink(lv_display_t * disp, bool en)
+{
+    lv_headless_display_t * dsc = lv_display_get_driver_data(disp);
+    LV_ASSERT_NULL(dsc);
+
+    if(!en) {
+        if(dsc->sink) {
+            lv_draw_buf_destroy(dsc->sink);
+            dsc->sink = NULL;
+        }
+        return LV_RESULT_OK;
+    }
+
+    if(dsc->sink) return LV_RESULT_OK;
+
+    dsc->sink = lv_draw_buf_create(lv_display_get_horizontal_resolution(disp),
+                                   lv_display_get_vertical_resolution(disp),
+                                   lv_display_get_color_format(disp), LV_STRIDE_AUTO);
+    if(dsc->sink == NULL) {
+        LV_LOG_ERROR("Couldn't allocate the memory sink");
+        return LV_RESULT_INVALID;
+    }
+
+    lv_draw_buf_clear(dsc->sink, NULL);
+    return LV_RESULT_OK;
+}
+
+lv_draw_buf_t * lv_headless_display_get_memory_sink(lv_display_t * disp)
+{
+    lv_headless_display_t * dsc = lv_display_get_driver_data(disp);
+    LV_ASSERT_NULL(dsc);
+
+    return dsc->sink;
+}
+
+void lv_headless_display_set_frame_cb(lv_display_t * disp, lv_headless_display_frame_cb_t cb, void * user_data)
+{
+    lv_headless_display_t * dsc = lv_display_get_driver_data(disp);
+    LV_ASSERT_NULL(dsc);
+
+    dsc->frame_cb = cb;
+    dsc->frame_cb_user_data = user_data;
+}
+
+uint64_t lv_headless_display_get_time_us(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000 + t.tv_nsec / 1000;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(px_map);
+    lv_headless_display_t * dsc = lv_display_get_driver_data(disp);
+    uint64_t start = lv_headless_display_get_time_us();
+
+    if(dsc->sink) {
+        /*In partial mode only the area is in the buffer, else the whole screen*/
+        lv_draw_buf_t * draw_buf = lv_display_get_buf_active(disp);
+        lv_area_t src_area = *area;
+        if(lv_display_get_render_mode(disp) == LV_DISPLAY_RENDER_MODE_PARTIAL) {
+            lv_area_set(&src_area, 0, 0, lv_area_get_width(area) - 1, lv_area_get_height(area) - 1);
+        }
+        lv_draw_buf_copy(dsc->sink, area, draw_buf, &src_area);
+    }
+
+    uint32_t px_cnt = lv_area_get_size(area);
+    dsc->frame.flush_cnt++;
+    dsc->frame.flushed_px_cnt += px_cnt;
+
+    uint64_t now = lv_headless_display_get_time_us();
+    dsc->transfer_end_us = now + dsc->latency_us;
+    if(dsc->kbyte_per_sec) {
+        uint64_t byte_cnt = (uint64_t)px_cnt * lv_color_format_get_size(lv_display_get_color_format(disp));
+        dsc->transfer_end_us += byte_cnt * 1000 / dsc->kbyte_per_sec;
+    }
+
+    dsc->flush_elaps_us += now - start;
+}
+
+static void flush_wait_cb(lv_display_t * disp)
+{
+    lv_headless_display_t * dsc = lv_display_get_driver_data(disp);
+    uint64_t start = lv_headless_display_get_time_us();
+
+    /*Sleep as a DMA transfer wouldn't use the CPU either*/
+    uint64_t now = start;
+    while(now < dsc->transfer_end_us) {
+        uint64_t remaining = dsc->transfer_end_us - now;
+        struct timespec t;
+        t.tv_sec = (time_t)(remaining / 1000000);
+        t.tv_nsec = (long)(remaining % 1000000) * 1000;
+        nanosleep(&t, NULL);
+        now = lv_headless_display_get_time_us();
+    }
+
+    dsc->flush_elaps_us += now - start;
+}
+
+static void refr_start_event_cb(lv_event_t * e)
+{
+    lv_display_t * disp = lv_event_get_current_target(e);
+    lv_headless_display_t * dsc = lv_display_get_driver_data(disp);
+
+    lv_memzero(&dsc->frame, sizeof(dsc->frame));
+    dsc->flush_elaps_us = 0;
+    dsc->refr_start_task_cnt = lv_draw_get_task_count();
+    dsc->refr_start_us = lv_headless_display_get_time_us();
+}
+
+static void refr_ready_event_cb(lv_event_t * e)
+{
+    lv_display_t * disp = lv_event_get_current_target(e);
+    lv_headless_display_t * dsc = lv_display_get_driver_data(disp);
+
+    /*Nothing was invalidated*/
+    if(dsc->frame.flush_cnt == 0) return;
+
+    uint64_t elaps = lv_headless_display_get_time_us() - dsc->refr_start_us;
+    dsc->frame.flush_time_us = (uint32_t)dsc->flush_elaps_us;
+    dsc->frame.render_time_us = (uint32_t)(elaps - LV_MIN(elaps, dsc->flush_elaps_us));
+    dsc->frame.draw_task_cnt = lv_draw_get_task_count() - dsc->refr_start_task_cnt;
+
+    if(dsc->frame_cb) dsc->frame_cb(disp, &dsc->frame, dsc->frame_cb_user_data);
+}
+
+static void delete_event_cb(lv_event_t * e)
+{
+    lv_display_t * disp = lv_event_get_current_target(e);
+    lv_headless_display_t * dsc = lv_display_get_driver_data(disp);
+    if(dsc == NULL) return;
+
+    lv_draw_buf_destroy(dsc->draw_buf_1);
+    lv_draw_buf_destroy(dsc->draw_buf_2);
+    if(dsc->sink) lv_draw_buf_destroy(dsc->sink);
+
+    lv_display_set_driver_data(disp, NULL);
+    lv_free(dsc);
+}
+
+#endif /*LV_USE_HEADLESS_DISPLAY*/
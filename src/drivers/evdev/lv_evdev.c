@@ -17,6 +17,7 @@
 #include <dirent.h>
 #include <sys/stat.h>
 #include <sys/param.h> /*To detect BSD*/
+#include <time.h>
 #ifdef BSD
     #include <dev/evdev/input.h>
 #else
@@ -38,6 +39,11 @@
 #define ABS_XY_MASK ((1 << ABS_X) | (1 << ABS_Y))
 #define MAX_TOUCH_POINTS 5
 
+#ifndef input_event_sec
+    #define input_event_sec time.tv_sec
+    #define input_event_usec time.tv_usec
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -60,6 +66,7 @@ typedef struct {
     int key;
     lv_indev_state_t state;
     bool deleting;
+    bool monotonic_clock; /* The event times are from CLOCK_MONOTONIC */
     /* Multi-touch support */
 #if LV_USE_GESTURE_RECOGNITION
     lv_indev_touch_data_t touch_data[MAX_TOUCH_POINTS]; /* Array of touch points for gesture recognition */
@@ -142,6 +149,37 @@ static lv_point_t _evdev_process_pointer(lv_indev_t * indev, int x, int y)
     return p;
 }
 
+static void _evdev_set_pointer_data(lv_indev_t * indev, lv_indev_data_t * data)
+{
+    lv_evdev_t * dsc = lv_indev_get_driver_data(indev);
+
+#if LV_USE_GESTURE_RECOGNITION
+    if(dsc->touch_count > 0) {
+        data->state = dsc->touch_data[0].state;
+        data->point = _evdev_process_pointer(indev, dsc->touch_data[0].point.x, dsc->touch_data[0].point.y);
+        return;
+    }
+#endif
+
+    data->state = dsc->state;
+    data->point = _evdev_process_pointer(indev, dsc->root_x, dsc->root_y);
+}
+
+static uint32_t _evdev_get_timestamp(lv_evdev_t * dsc, const struct input_event * in)
+{
+    /*Without monotonic event times let LVGL use the current tick*/
+    if(!dsc->monotonic_clock) return 0;
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    int64_t age_ms = ((int64_t)now.tv_sec - in->input_event_sec) * 1000 +
+                     ((int64_t)now.tv_nsec / 1000 - in->input_event_usec) / 1000;
+    if(age_ms < 0) age_ms = 0;
+
+    uint32_t timestamp = lv_tick_get() - (uint32_t)age_ms;
+    return timestamp ? timestamp : 1;
+}
+
 static void _evdev_async_delete_cb(void * user_data)
 {
     lv_indev_t * indev = user_data;
@@ -241,62 +279,70 @@ static void _evdev_read(lv_indev_t * indev, lv_indev_data_t * data)
                 }
             }
         }
-#if LV_USE_GESTURE_RECOGNITION
         else if(in.type == EV_SYN && in.code == SYN_REPORT) {
-            /* Handle gesture recognition at sync event */
-            if(dsc->touch_count > 0 && dsc->touch_data_changed) {
-                LV_LOG_TRACE("=== SYN_REPORT: touch_count=%d ===", dsc->touch_count);
-                for(int i = 0; i < MAX_TOUCH_POINTS; i++) {
-                    if(dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED || dsc->touch_data[i].state == LV_INDEV_STATE_RELEASED) {
-                        LV_LOG_TRACE("Slot %d: state=%s, raw(%d, %d)",
-                                     i,
-                                     dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED ? "PRESSED" : "RELEASED",
-                                     dsc->touch_data[i].point.x, dsc->touch_data[i].point.y);
+#if LV_USE_GESTURE_RECOGNITION
+                /* Handle gesture recognition at sync event */
+                if(dsc->touch_count > 0 && dsc->touch_data_changed) {
+                    LV_LOG_TRACE("=== SYN_REPORT: touch_count=%d ===", dsc->touch_count);
+                    for(int i = 0; i < MAX_TOUCH_POINTS; i++) {
+                        if(dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED || dsc->touch_data[i].state == LV_INDEV_STATE_RELEASED) {
+                            LV_LOG_TRACE("Slot %d: state=%s, raw(%d, %d)",
+                                         i,
+                                         dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED ? "PRESSED" : "RELEASED",
+                                         dsc->touch_data[i].point.x, dsc->touch_data[i].point.y);
+                        }
                     }
-                }
 
-                /* Create a temporary array with calibrated coordinates for gesture recognition */
-                lv_indev_touch_data_t calibrated_touch_data[MAX_TOUCH_POINTS];
+                    /* Create a temporary array with calibrated coordinates for gesture recognition */
+                    lv_indev_touch_data_t calibrated_touch_data[MAX_TOUCH_POINTS];
 
-                int active_touches = 0;
+                    int active_touches = 0;
 
-                for(int i = 0; i < MAX_TOUCH_POINTS; i++) {
-                    if(dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED || dsc->touch_data[i].state == LV_INDEV_STATE_RELEASED) {
-                        calibrated_touch_data[active_touches] = dsc->touch_data[i];
+                    for(int i = 0; i < MAX_TOUCH_POINTS; i++) {
+                        if(dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED || dsc->touch_data[i].state == LV_INDEV_STATE_RELEASED) {
+                            calibrated_touch_data[active_touches] = dsc->touch_data[i];
 
-                        lv_point_t calib_point = _evdev_process_pointer(indev, dsc->touch_data[i].point.x, dsc->touch_data[i].point.y);
-                        calibrated_touch_data[active_touches].point = calib_point;
+                            lv_point_t calib_point = _evdev_process_pointer(indev, dsc->touch_data[i].point.x, dsc->touch_data[i].point.y);
+                            calibrated_touch_data[active_touches].point = calib_point;
 
-                        LV_LOG_TRACE("Touch %d (slot %d): state=%s, raw(%d, %d) -> calib(%d, %d)",
-                                     active_touches, i,
-                                     dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED ? "PRESSED" : "RELEASED",
-                                     dsc->touch_data[i].point.x, dsc->touch_data[i].point.y,
-                                     calib_point.x, calib_point.y);
-                        active_touches++;
+                            LV_LOG_TRACE("Touch %d (slot %d): state=%s, raw(%d, %d) -> calib(%d, %d)",
+                                         active_touches, i,
+                                         dsc->touch_data[i].state == LV_INDEV_STATE_PRESSED ? "PRESSED" : "RELEASED",
+                                         dsc->touch_data[i].point.x, dsc->touch_data[i].point.y,
+                                         calib_point.x, calib_point.y);
+                            active_touches++;
+                        }
                     }
-                }
 
-                LV_LOG_TRACE("Gesture recognition: %d touches detected", active_touches);
-                lv_indev_gesture_recognizers_update(indev, calibrated_touch_data, active_touches);
-                lv_indev_gesture_recognizers_set_data(indev, data);
-
-                /* Clear RELEASED touch points after gesture recognition to prevent duplicate processing */
-                for(int i = 0; i < MAX_TOUCH_POINTS; i++) {
-                    if(dsc->touch_data[i].state == LV_INDEV_STATE_RELEASED) {
-                        /* Mark touch point as invalid by zeroing out the data */
-                        dsc->touch_data[i].point.x = 0;
-                        dsc->touch_data[i].point.y = 0;
-                        dsc->touch_data[i].id = -1; /* Mark as invalid */
-                        /* Note: We keep the RELEASED state for this frame, it will be naturally
-                         * cleared when new touch events come in or when all touches end */
-                        LV_LOG_TRACE("Cleared released touch point slot %d", i);
+                    LV_LOG_TRACE("Gesture recognition: %d touches detected", active_touches);
+                    lv_indev_gesture_recognizers_update(indev, calibrated_touch_data, active_touches);
+                    lv_indev_gesture_recognizers_set_data(indev, data);
+
+                    /* Clear RELEASED touch points after gesture recognition to prevent duplicate processing */
+                    for(int i = 0; i < MAX_TOUCH_POINTS; i++) {
+                        if(dsc->touch_data[i].state == LV_INDEV_STATE_RELEASED) {
+                            /* Mark touch point as invalid by zeroing out the data */
+                            dsc->touch_data[i].point.x = 0;
+                            dsc->touch_data[i].point.y = 0;
+                            dsc->touch_data[i].id = -1; /* Mark as invalid */
+                            /* Note: We keep the RELEASED state for this frame, it will be naturally
+                             * cleared when new touch events come in or when all touches end */
+                            LV_LOG_TRACE("Cleared released touch point slot %d", i);
+                        }
                     }
+
+                    dsc->touch_data_changed = false;
                 }
+#endif
 
-                dsc->touch_data_changed = false;
+            /*Push every report so the intermediate positions are not lost if buffering is enabled*/
+            if(lv_indev_get_type(indev) == LV_INDEV_TYPE_POINTER) {
+                lv_indev_data_t sample = *data;
+                _evdev_set_pointer_data(indev, &sample);
+                sample.timestamp = _evdev_get_timestamp(dsc, &in);
+                lv_indev_push_sample(indev, &sample);
             }
         }
-#endif
     }
 
     if(!dsc->deleting && br == -1 && errno != EAGAIN) {
@@ -317,19 +363,7 @@ static void _evdev_read(lv_indev_t * indev, lv_indev_data_t * data)
             data->key = dsc->key;
             break;
         case LV_INDEV_TYPE_POINTER:
-#if LV_USE_GESTURE_RECOGNITION
-            if(dsc->touch_count > 0) {
-                data->state = dsc->touch_data[0].state;
-                data->point = _evdev_process_pointer(indev, dsc->touch_data[0].point.x, dsc->touch_data[0].point.y);
-            }
-            else {
-                data->state = dsc->state;
-                data->point = _evdev_process_pointer(indev, dsc->root_x, dsc->root_y);
-            }
-#else
-            data->state = dsc->state;
-            data->point = _evdev_process_pointer(indev, dsc->root_x, dsc->root_y);
-#endif
+            _evdev_set_pointer_data(indev, data);
             break;
         default:
             break;
@@ -536,6 +570,12 @@ lv_indev_t * lv_evdev_create_fd(lv_indev_type_t indev_type, int fd)
         goto err_after_malloc;
     }
 
+#ifdef EVIOCSCLOCKID
+    /* Get the event times on the monotonic clock to timestamp the buffered samples */
+    int clock_id = CLOCK_MONOTONIC;
+    dsc->monotonic_clock = ioctl(dsc->fd, EVIOCSCLOCKID, &clock_id) == 0;
+#endif
+
     /* Detect the minimum and maximum values of the input device for calibration. */
 
     if(indev_type == LV_INDEV_TYPE_POINTER) {
@@ -660,6 +700,13 @@ void lv_evdev_set_calibration(lv_indev_t * indev, int min_x, int min_y, int max_
     dsc->max_y = max_y;
 }
 
+int lv_evdev_get_fd(lv_indev_t * indev)
+{
+    lv_evdev_t * dsc = lv_indev_get_driver_data(indev);
+    LV_ASSERT_NULL(dsc);
+    return dsc->fd;
+}
+
 bool lv_evdev_is_raw_key(lv_event_t * e)
 {
     LV_CHECK_ARG(e != NULL, return false);
@@ -24,6 +24,7 @@
 #include <libinput.h>
 #include <pthread.h>
 #include <string.h>
+#include <sys/eventfd.h>
 
 #if LV_LIBINPUT_BSD
     #include <dev/evdev/input.h>
@@ -151,6 +152,7 @@ lv_indev_t * lv_libinput_create(lv_indev_type_t indev_type, const char * dev_pat
     lv_libinput_t * dsc = lv_malloc_zeroed(sizeof(lv_libinput_t));
     LV_ASSERT_MALLOC(dsc);
     if(dsc == NULL) return NULL;
+    dsc->notify_fd = -1;
 
     dsc->libinput_context = libinput_path_create_context(&interface, NULL);
     if(!dsc->libinput_context) {
@@ -178,6 +180,14 @@ lv_indev_t * lv_libinput_create(lv_indev_type_t indev_type, const char * dev_pat
     dsc->fds[0].events = POLLIN;
     dsc->fds[0].revents = 0;
 
+    /* Signaled by the worker thread so that event loops can wait for new input */
+    dsc->notify_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if(dsc->notify_fd < 0) {
+        LV_LOG_ERROR("eventfd failed: %s", strerror(errno));
+        _delete(dsc);
+        return NULL;
+    }
+
 #if LV_LIBINPUT_XKB
     struct xkb_rule_names names = XKB_RULE_NAMES;
     lv_xkb_init(&(dsc->xkb), names);
@@ -200,6 +210,13 @@ lv_indev_t * lv_libinput_create(lv_indev_type_t indev_type, const char * dev_pat
     return indev;
 }
 
+int lv_libinput_get_fd(lv_indev_t * indev)
+{
+    lv_libinput_t * dsc = lv_indev_get_driver_data(indev);
+    LV_ASSERT_NULL(dsc);
+    return dsc->notify_fd;
+}
+
 void lv_libinput_delete(lv_indev_t * indev)
 {
     _delete(lv_indev_get_driver_data(indev));
@@ -349,6 +366,11 @@ static void * _poll_thread(void * data)
             libinput_event_destroy(event);
         }
         pthread_mutex_unlock(&dsc->event_lock);
+
+        uint64_t one = 1;
+        if(write(dsc->notify_fd, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+            LV_LOG_WARN("libinput: notify failed: %s", strerror(errno));
+        }
         LV_LOG_INFO("libinput: event read");
     }
 
@@ -400,6 +422,12 @@ static void _read(lv_indev_t * indev, lv_indev_data_t * data)
     lv_libinput_t * dsc = lv_indev_get_driver_data(indev);
     LV_ASSERT_NULL(dsc);
 
+    /* Consume the notification before taking the events so none of them gets lost */
+    uint64_t cnt;
+    if(read(dsc->notify_fd, &cnt, sizeof(cnt)) < 0 && errno != EAGAIN) {
+        LV_LOG_WARN("libinput: reading notification failed: %s", strerror(errno));
+    }
+
     pthread_mutex_lock(&dsc->event_lock);
 
     lv_libinput_event_t * evt = _get_event(dsc);
@@ -684,6 +712,10 @@ static void _delete(lv_libinput_t * dsc)
     lv_xkb_deinit(&(dsc->xkb));
 #endif /* LV_LIBINPUT_XKB */
 
+    if(dsc->notify_fd >= 0) {
+        close(dsc->notify_fd);
+    }
+
     lv_free(dsc);
 }
 
@@ -54,6 +54,7 @@ struct _lv_libinput_t {
                                    * to keep indev state consistent
                                    */
     bool deinit; /* Tell worker thread to quit */
+    int notify_fd; /* eventfd signaled by the worker thread when new events are queued */
     pthread_mutex_t event_lock;
     pthread_t worker_thread;
 
@@ -0,0 +1,393 @@
+/**
+ * @file lv_linux_event_loop.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl_public.h"
+
+#if LV_USE_LINUX_EVENT_LOOP
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Maximal number of ready file descriptors handled by one `epoll_wait`*/
+#define EVENT_LOOP_MAX_EVENTS 16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    int fd;
+    lv_linux_event_loop_cb_t cb;
+    void * user_data;
+    bool removed;           /**< Removed while dispatching, free it after the dispatch*/
+} lv_linux_event_loop_source_t;
+
+struct _lv_linux_event_loop_t {
+    int epoll_fd;
+    int timer_fd;
+    lv_ll_t source_ll;      /**< lv_linux_event_loop_source_t*/
+    bool dispatching;       /**< Sources can't be freed as pending epoll events may point to them*/
+    bool timer_resumed;     /**< A timer was resumed while the timer handler was running*/
+    bool running;
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void timer_arm(lv_linux_event_loop_t * loop, uint32_t ms);
+static void timer_resume_cb(void * data);
+static void timer_fd_cb(int fd, uint32_t events, void * user_data);
+static lv_linux_event_loop_source_t * source_find(lv_linux_event_loop_t * loop, int fd);
+static void sources_cleanup(lv_linux_event_loop_t * loop);
+static void indev_fd_cb(int fd, uint32_t events, void * user_data);
+static void indev_delete_cb(lv_event_t * e);
+#if LV_USE_LINUX_DRM && !LV_LINUX_DRM_USE_EGL
+    static void drm_fd_cb(int fd, uint32_t events, void * user_data);
+    static void drm_delete_cb(lv_event_t * e);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_linux_event_loop_t * lv_linux_event_loop_create(void)
+{
+    lv_linux_event_loop_t * loop = lv_malloc_zeroed(sizeof(lv_linux_event_loop_t));
+    LV_ASSERT_MALLOC(loop);
+    if(loop == NULL) return NULL;
+
+    lv_ll_init(&loop->source_ll, sizeof(lv_linux_event_loop_source_t));
+
+    loop->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if(loop->epoll_fd < 0) {
+        LV_LOG_ERROR("epoll_create1 failed: %s", strerror(errno));
+        lv_free(loop);
+        return NULL;
+    }
+
+    loop->timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if(loop->timer_fd < 0) {
+        LV_LOG_ERROR("timerfd_create failed: %s", strerror(errno));
+        close(loop->epoll_fd);
+        lv_free(loop);
+        return NULL;
+    }
+
+    if(lv_linux_event_loop_add_fd(loop, loop->timer_fd, EPOLLIN, timer_fd_cb, loop) != LV_RESULT_OK) {
+        close(loop->timer_fd);
+        close(loop->epoll_fd);
+        lv_free(loop);
+        return NULL;
+    }
+
+    /*Wake up immediately when a timer is created, resumed or made ready*/
+    lv_timer_handler_set_resume_cb(timer_resume_cb, loop);
+    timer_arm(loop, 0);
+
+    return loop;
+}
+
+void lv_linux_event_loop_delete(lv_linux_event_loop_t * loop)
+{
+    if(loop == NULL) return;
+
+    lv_timer_handler_set_resume_cb(NULL, NULL);
+
+    lv_indev_t * indev = lv_indev_get_next(NULL);
+    while(indev) {
+        lv_indev_remove_event_cb_with_user_data(indev, indev_delete_cb, loop);
+        indev = lv_indev_get_next(indev);
+    }
+
+#if LV_USE_LINUX_DRM && !LV_LINUX_DRM_USE_EGL
+    lv_display_t * disp = lv_display_get_next(NULL);
+    while(disp) {
+        lv_display_remove_event_cb_with_user_data(disp, drm_delete_cb, loop);
+        disp = lv_display_get_next(disp);
+    }
+#endif
+
+    lv_ll_clear(&loop->source_ll);
+    close(loop->timer_fd);
+    close(loop->epoll_fd);
+    lv_free(loop);
+}
+
+lv_result_t lv_linux_event_loop_add_fd(lv_linux_event_loop_t * loop, int fd, uint32_t events,
+                                       lv_linux_event_loop_cb_t cb, void * user_data)
+{
+    LV_ASSERT_NULL(loop);
+    LV_ASSERT_NULL(cb);
+
+    if(source_find(loop, fd)) {
+        LV_LOG_WARN("fd %d is already added", fd);
+        return LV_RESULT_INVALID;
+    }
+
+    lv_linux_event_loop_source_t * src = lv_ll_ins_tail(&loop->source_ll);
+    LV_ASSERT_MALLOC(src);
+    if(src == NULL) return LV_RESULT_INVALID;
+
+    src->fd = fd;
+    src->cb = cb;
+    src->user_data = user_data;
+    src->removed = false;
+
+    struct epoll_event ev;
+    lv_memzero(&ev, sizeof(ev));
+    ev.events = events;
+    ev.data.ptr = src;
+    if(epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        LV_LOG_ERROR("epoll_ctl failed to add fd %d: %s", fd, strerror(errno));
+        lv_ll_remove(&loop->source_ll, src);
+        lv_free(src);
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+}
+
+void lv_linux_event_loop_remove_fd(lv_linux_event_loop_t * loop, int fd)
+{
+    LV_ASSERT_NULL(loop);
+
+    lv_linux_event_loop_source_t * src = source_find(loop, fd);
+    if(src == NULL) return;
+
+    /*It fails if the fd was already closed, but then it was removed from the epoll set anyway*/
+    epoll_ctl(loop->epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+
+    src->removed = true;
+    if(!loop->dispatching) sources_cleanup(loop);
+}
+
+lv_result_t lv_linux_event_loop_add_indev(lv_linux_event_loop_t * loop, lv_indev_t * indev, int fd)
+{
+    LV_ASSERT_NULL(loop);
+    LV_ASSERT_NULL(indev);
+
+    lv_result_t res = lv_linux_event_loop_add_fd(loop, fd, EPOLLIN, indev_fd_cb, indev);
+    if(res != LV_RESULT_OK) return res;
+
+    /*The read timer is resumed by the indev itself while it's pressed to detect long presses*/
+    lv_indev_set_mode(indev, LV_INDEV_MODE_EVENT);
+    lv_indev_add_event_cb(indev, indev_delete_cb, LV_EVENT_DELETE, loop);
+
+    return LV_RESULT_OK;
+}
+
+#if LV_USE_LINUX_DRM && !LV_LINUX_DRM_USE_EGL
+lv_result_t lv_linux_event_loop_add_drm(lv_linux_event_loop_t * loop, lv_display_t * disp)
+{
+    LV_ASSERT_NULL(loop);
+    LV_ASSERT_NULL(disp);
+
+    int fd = lv_linux_drm_get_fd(disp);
+    if(fd < 0) {
+        LV_LOG_WARN("The DRM device is not opened yet");
+        return LV_RESULT_INVALID;
+    }
+
+    lv_result_t res = lv_linux_event_loop_add_fd(loop, fd, EPOLLIN, drm_fd_cb, disp);
+    if(res != LV_RESULT_OK) return res;
+
+    lv_display_add_event_cb(disp, drm_delete_cb, LV_EVENT_DELETE, loop);
+
+    return LV_RESULT_OK;
+}
+#endif /*LV_USE_LINUX_DRM && !LV_LINUX_DRM_USE_EGL*/
+
+lv_result_t lv_linux_event_loop_run_once(lv_linux_event_loop_t * loop, int32_t timeout_ms)
+{
+    LV_ASSERT_NULL(loop);
+
+    struct epoll_event events[EVENT_LOOP_MAX_EVENTS];
+    int cnt = epoll_wait(loop->epoll_fd, events, EVENT_LOOP_MAX_EVENTS, timeout_ms);
+    if(cnt < 0) {
+        if(errno == EINTR) return LV_RESULT_OK;
+        LV_LOG_ERROR("epoll_wait failed: %s", strerror(errno));
+        return LV_RESULT_INVALID;
+    }
+
+    /*Handle the input and flips first so that the timers below already see their result*/
+    loop->dispatching = true;
+    int i;
+    for(i = 0; i < cnt; i++) {
+        lv_linux_event_loop_source_t * src = events[i].data.ptr;
+        if(src->removed) continue;
+        src->cb(src->fd, events[i].events, src->user_data);
+    }
+    loop->dispatching = false;
+    sources_cleanup(loop);
+
+    loop->timer_resumed = false;
+    uint32_t time_until_next = lv_timer_handler();
+
+    /*If a timer was resumed meanwhile the timer fd is already armed to fire immediately*/
+    if(!loop->timer_resumed) timer_arm(loop, time_until_next);
+
+    return LV_RESULT_OK;
+}
+
+void lv_linux_event_loop_run(lv_linux_event_loop_t * loop)
+{
+    LV_ASSERT_NULL(loop);
+
+    loop->running = true;
+    while(loop->running) {
+        if(lv_linux_event_loop_run_once(loop, -1) != LV_RESULT_OK) break;
+    }
+}
+
+void lv_linux_event_loop_stop(lv_linux_event_loop_t * loop)
+{
+    LV_ASSERT_NULL(loop);
+    loop->running = false;
+}
+
+int lv_linux_event_loop_get_fd(lv_linux_event_loop_t * loop)
+{
+    LV_ASSERT_NULL(loop);
+    return loop->epoll_fd;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Arm the timer fd to expire after `ms` milliseconds.
+ * `0` means as soon as possible, `LV_NO_TIMER_READY` disarms it.
+ */
+static void timer_arm(lv_linux_event_loop_t * loop, uint32_t ms)
+{
+    struct itimerspec spec;
+    lv_memzero(&spec, sizeof(spec));
+
+    if(ms != LV_NO_TIMER_READY) {
+        /*A zero it_value would disarm the timer so use the shortest possible delay instead*/
+        spec.it_value.tv_sec = ms / 1000;
+        spec.it_value.tv_nsec = ms == 0 ? 1 : (long)(ms % 1000) * 1000000;
+    }
+
+    if(timerfd_settime(loop->timer_fd, 0, &spec, NULL) < 0) {
+        LV_LOG_ERROR("timerfd_settime failed: %s", strerror(errno));
+    }
+}
+
+static void timer_resume_cb(void * data)
+{
+    lv_linux_event_loop_t * loop = data;
+    loop->timer_resumed = true;
+    timer_arm(loop, 0);
+}
+
+static void timer_fd_cb(int fd, uint32_t events, void * user_data)
+{
+    LV_UNUSED(events);
+    LV_UNUSED(user_data);
+
+    /*Just clear the expiration, the timers run after every dispatch*/
+    uint64_t expirations;
+    if(read(fd, &expirations, sizeof(expirations)) < 0 && errno != EAGAIN) {
+        LV_LOG_WARN("reading the timer fd failed: %s", strerror(errno));
+    }
+}
+
+static lv_linux_event_loop_source_t * source_find(lv_linux_event_loop_t * loop, int fd)
+{
+    lv_linux_event_loop_source_t * src;
+    LV_LL_READ(&loop->source_ll, src) {
+        if(src->fd == fd && !src->removed) return src;
+    }
+
+    return NULL;
+}
+
+static void sources_cleanup(lv_linux_event_loop_t * loop)
+{
+    lv_linux_event_loop_source_t * src = lv_ll_get_head(&loop->source_ll);
+    while(src) {
+        lv_linux_event_loop_source_t * src_next = lv_ll_get_next(&loop->source_ll, src);
+        if(src->removed) {
+            lv_ll_remove(&loop->source_ll, src);
+            lv_free(src);
+        }
+        src = src_next;
+    }
+}
+
+static void indev_fd_cb(int fd, uint32_t events, void * user_data)
+{
+    LV_UNUSED(fd);
+    LV_UNUSED(events);
+
+    /*Also called on EPOLLERR/EPOLLHUP so that the driver can notice that the device is gone*/
+    lv_indev_t * indev = user_data;
+    lv_indev_read(indev);
+}
+
+static void indev_delete_cb(lv_event_t * e)
+{
+    lv_indev_t * indev = lv_event_get_current_target(e);
+    lv_linux_event_loop_t * loop = lv_event_get_user_data(e);
+
+    lv_linux_event_loop_source_t * src;
+    LV_LL_READ(&loop->source_ll, src) {
+        if(src->cb == indev_fd_cb && src->user_data == indev && !src->removed) {
+            lv_linux_event_loop_remove_fd(loop, src->fd);
+            break;
+        }
+    }
+}
+
+#if LV_USE_LINUX_DRM && !LV_LINUX_DRM_USE_EGL
+
+static void drm_fd_cb(int fd, uint32_t events, void * user_data)
+{
+    LV_UNUSED(fd);
+    LV_UNUSED(events);
+
+    /*Complete the flip here so that the next flush doesn't have to block for it*/
+    lv_display_t * disp = user_data;
+    lv_linux_drm_handle_events(disp);
+}
+
+static void drm_delete_cb(lv_event_t * e)
+{
+    lv_display_t * disp = lv_event_get_current_target(e);
+    lv_linux_event_loop_t * loop = lv_event_get_user_data(e);
+
+    lv_linux_event_loop_source_t * src;
+    LV_LL_READ(&loop->source_ll, src) {
+        if(src->cb == drm_fd_cb && src->user_data == disp && !src->removed) {
+            lv_linux_event_loop_remove_fd(loop, src->fd);
+            break;
+        }
+    }
+}
+
+#endif /*LV_USE_LINUX_DRM && !LV_LINUX_DRM_USE_EGL*/
+
+#endif /*LV_USE_LINUX_EVENT_LOOP*/
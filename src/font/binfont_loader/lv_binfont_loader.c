@@ -10,16 +10,36 @@
 #include "../../lvgl_public.h"
 #include "../fmt_txt/lv_font_fmt_txt_private.h"
 #include "../../fs/lv_fs_private.h"
+#include "../../misc/cache/lv_cache.h"
+#include "../../misc/cache/lv_cache_entry.h"
 
 /**********************
  *      TYPEDEFS
  **********************/
 typedef struct {
     lv_fs_file_t * fp;
+    const uint8_t * data;   /*If not NULL read from here instead of `fp`*/
     int8_t bit_pos;
     uint8_t byte_value;
 } bit_iterator_t;
 
+/*Font descriptor of the fonts created by `lv_binfont_create_streaming`*/
+typedef struct {
+    lv_font_fmt_txt_dsc_t fmt_txt;  /*Needs to be the first as it's also used as `lv_font_fmt_txt_dsc_t`*/
+    lv_fs_file_t file;              /*Kept open to read the glyph bitmaps*/
+    const uint8_t * glyf_mapped;    /*The glyph table mapped into the memory or NULL*/
+    uint32_t glyf_start;            /*File offset of the glyph table*/
+    uint32_t glyf_length;
+    uint32_t * glyph_offset;        /*Offset of each glyph in the glyph table. `glyph_cnt + 1` elements*/
+    uint32_t header_bits;           /*Length of the glyph headers in bits*/
+    lv_cache_t * bitmap_cache;
+} binfont_stream_dsc_t;
+
+typedef struct {
+    uint32_t gid;
+    uint8_t * bitmap;
+} binfont_glyph_cache_data_t;
+
 typedef struct font_header_bin {
     uint32_t version;
     uint16_t tables_count;
@@ -60,8 +80,8 @@ typedef struct cmap_table_bin {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp);
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font);
+static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp, const uint8_t * data);
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, binfont_stream_dsc_t * stream);
 int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
 
 static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
@@ -72,6 +92,14 @@ static void binfont_font_delete_cb(lv_font_t * font);
 static void * binfont_font_dup_src_cb(const void * src);
 static void binfont_font_free_src_cb(void * src);
 
+static const void * stream_get_bitmap_cb(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf);
+static void stream_release_glyph_cb(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc);
+static bool glyph_cache_create_cb(binfont_glyph_cache_data_t * data, void * user_data);
+static void glyph_cache_free_cb(binfont_glyph_cache_data_t * data, void * user_data);
+static lv_cache_compare_res_t glyph_cache_compare_cb(const binfont_glyph_cache_data_t * lhs,
+                                                     const binfont_glyph_cache_data_t * rhs);
+static uint32_t glyph_cache_hash_cb(const binfont_glyph_cache_data_t * data);
+
 /**********************
  *      MACROS
  **********************/
@@ -102,7 +130,7 @@ lv_font_t * lv_binfont_create(const char * path)
     lv_font_t * font = lv_malloc_zeroed(sizeof(lv_font_t));
     LV_ASSERT_MALLOC(font);
 
-    if(!lvgl_load_font(&file, font)) {
+    if(!lvgl_load_font(&file, font, NULL)) {
         LV_LOG_WARN("Error loading font file: %s", path);
         /*
         * When `lvgl_load_font` fails it can leak some pointers.
@@ -118,6 +146,54 @@ lv_font_t * lv_binfont_create(const char * path)
     return font;
 }
 
+lv_font_t * lv_binfont_create_streaming(const char * path, uint32_t cache_cnt)
+{
+    LV_ASSERT_NULL(path);
+    LV_ASSERT(cache_cnt > 0);
+
+    lv_font_t * font = lv_malloc_zeroed(sizeof(lv_font_t));
+    LV_ASSERT_MALLOC(font);
+    binfont_stream_dsc_t * stream = lv_malloc_zeroed(sizeof(binfont_stream_dsc_t));
+    LV_ASSERT_MALLOC(stream);
+    if(font == NULL || stream == NULL) {
+        lv_free(font);
+        lv_free(stream);
+        return NULL;
+    }
+
+    lv_fs_res_t fs_res = lv_fs_open(&stream->file, path, LV_FS_MODE_RD);
+    if(fs_res != LV_FS_RES_OK) {
+        lv_free(font);
+        lv_free(stream);
+        return NULL;
+    }
+
+    /*From now `lv_binfont_destroy` will take care of the stream and the file*/
+    font->dsc = stream;
+    font->get_glyph_bitmap = stream_get_bitmap_cb;
+
+    if(!lvgl_load_font(&stream->file, font, stream)) {
+        LV_LOG_WARN("Error loading font file: %s", path);
+        lv_binfont_destroy(font);
+        return NULL;
+    }
+
+    stream->bitmap_cache = lv_cache_create(&lv_cache_class_lru_ht_count, sizeof(binfont_glyph_cache_data_t), cache_cnt,
+    (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) glyph_cache_compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t) glyph_cache_hash_cb,
+        .create_cb = (lv_cache_create_cb_t) glyph_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) glyph_cache_free_cb,
+    });
+    if(stream->bitmap_cache == NULL) {
+        lv_binfont_destroy(font);
+        return NULL;
+    }
+    lv_cache_set_name(stream->bitmap_cache, "BINFONT_GLYPH");
+
+    return font;
+}
+
 #if LV_USE_FS_MEMFS
 lv_font_t * lv_binfont_create_from_buffer(void * buffer, uint32_t size)
 {
@@ -135,6 +211,14 @@ void lv_binfont_destroy(lv_font_t * font)
     const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
     if(dsc == NULL) return;
 
+    if(font->get_glyph_bitmap == stream_get_bitmap_cb) {
+        binfont_stream_dsc_t * stream = (binfont_stream_dsc_t *)dsc;
+        if(stream->bitmap_cache) lv_cache_destroy(stream->bitmap_cache, NULL);
+        if(stream->glyf_mapped) lv_fs_munmap(&stream->file, stream->glyf_mapped, stream->glyf_length);
+        lv_fs_close(&stream->file);
+        lv_free(stream->glyph_offset);
+    }
+
     if(dsc->kern_classes == 0) {
         const lv_font_fmt_txt_kern_pair_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
@@ -172,10 +256,11 @@ void lv_binfont_destroy(lv_font_t * font)
  *   STATIC FUNCTIONS
  **********************/
 
-static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp)
+static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp, const uint8_t * data)
 {
     bit_iterator_t it;
     it.fp = fp;
+    it.data = data;
     it.bit_pos = -1;
     it.byte_value = 0;
     return it;
@@ -190,9 +275,15 @@ static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res
 
         if(it->bit_pos < 0) {
             it->bit_pos = 7;
-            *res = lv_fs_read(it->fp, &(it->byte_value), 1, NULL);
-            if(*res != LV_FS_RES_OK) {
-                return 0;
+            if(it->data) {
+                it->byte_value = *it->data;
+                it->data++;
+            }
+            else {
+                *res = lv_fs_read(it->fp, &(it->byte_value), 1, NULL);
+                if(*res != LV_FS_RES_OK) {
+                    return 0;
+                }
             }
         }
         int8_t bit = (it->byte_value & 0x80) ? 1 : 0;
@@ -325,14 +416,29 @@ static int32_t load_cmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, u
     return success ? cmaps_length : -1;
 }
 
-static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
-                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header)
+/**
+ * Copy the bitmap of a glyph. The bitmaps follow the glyph headers which are not necessarily
+ * byte aligned, so the bytes might need to be shifted. `dst` can be the same as `src`.
+ */
+static void copy_glyph_bitmap(uint8_t * dst, const uint8_t * src, uint32_t size, uint32_t shift)
 {
-    int32_t glyph_length = read_label(fp, start, "glyf");
-    if(glyph_length < 0) {
-        return -1;
+    if(shift == 0) {
+        if(dst != src) lv_memcpy(dst, src, size);
+        return;
+    }
+
+    for(uint32_t k = 0; k < size - 1; ++k) {
+        dst[k] = (uint8_t)((src[k] << shift) | (src[k + 1] >> (8 - shift)));
     }
 
+    /*The last fragment should be on the MSB*/
+    dst[size - 1] = (uint8_t)(src[size - 1] << shift);
+}
+
+static bool load_glyph_dsc(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint32_t start,
+                           const uint8_t * glyf_mapped, uint32_t * glyph_offset, uint32_t loca_count,
+                           uint32_t glyph_length, font_header_bin_t * header)
+{
     lv_font_fmt_txt_glyph_dsc_t * glyph_dsc = (lv_font_fmt_txt_glyph_dsc_t *)
                                               lv_malloc(loca_count * sizeof(lv_font_fmt_txt_glyph_dsc_t));
 
@@ -345,12 +451,18 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
     for(unsigned int i = 0; i < loca_count; ++i) {
         lv_font_fmt_txt_glyph_dsc_t * gdsc = &glyph_dsc[i];
 
-        lv_fs_res_t res = lv_fs_seek(fp, start + glyph_offset[i], LV_FS_SEEK_SET);
-        if(res != LV_FS_RES_OK) {
-            return -1;
+        lv_fs_res_t res = LV_FS_RES_OK;
+        bit_iterator_t bit_it;
+        if(glyf_mapped) {
+            bit_it = init_bit_iterator(NULL, glyf_mapped + glyph_offset[i]);
+        }
+        else {
+            res = lv_fs_seek(fp, start + glyph_offset[i], LV_FS_SEEK_SET);
+            if(res != LV_FS_RES_OK) {
+                return false;
+            }
+            bit_it = init_bit_iterator(fp, NULL);
         }
-
-        bit_iterator_t bit_it = init_bit_iterator(fp);
 
         if(header->advance_width_bits == 0) {
             gdsc->adv_w = header->default_advance_width;
@@ -358,7 +470,7 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
         else {
             gdsc->adv_w = read_bits(&bit_it, header->advance_width_bits, &res);
             if(res != LV_FS_RES_OK) {
-                return -1;
+                return false;
             }
         }
 
@@ -368,26 +480,26 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
 
         gdsc->ofs_x = read_bits_signed(&bit_it, header->xy_bits, &res);
         if(res != LV_FS_RES_OK) {
-            return -1;
+            return false;
         }
 
         gdsc->ofs_y = read_bits_signed(&bit_it, header->xy_bits, &res);
         if(res != LV_FS_RES_OK) {
-            return -1;
+            return false;
         }
 
         gdsc->box_w = read_bits(&bit_it, header->wh_bits, &res);
         if(res != LV_FS_RES_OK) {
-            return -1;
+            return false;
         }
 
         gdsc->box_h = read_bits(&bit_it, header->wh_bits, &res);
         if(res != LV_FS_RES_OK) {
-            return -1;
+            return false;
         }
 
         int nbits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
-        int next_offset = (i < loca_count - 1) ? glyph_offset[i + 1] : (uint32_t)glyph_length;
+        int next_offset = (i < loca_count - 1) ? glyph_offset[i + 1] : glyph_length;
         int bmp_size = next_offset - glyph_offset[i] - nbits / 8;
 
         if(i == 0) {
@@ -404,49 +516,71 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
         }
     }
 
-    uint8_t * glyph_bmp = (uint8_t *)lv_malloc(sizeof(uint8_t) * cur_bmp_size);
+    return true;
+}
+
+static bool load_glyph_bitmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint32_t start,
+                               const uint8_t * glyf_mapped, uint32_t * glyph_offset, uint32_t loca_count,
+                               uint32_t glyph_length, font_header_bin_t * header)
+{
+    const lv_font_fmt_txt_glyph_dsc_t * glyph_dsc = font_dsc->glyph_dsc;
+    int nbits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
+
+    /*Sum the size of the non-empty bitmaps*/
+    int total_bmp_size = 0;
+    for(unsigned int i = 1; i < loca_count; ++i) {
+        if(glyph_dsc[i].box_w * glyph_dsc[i].box_h == 0) continue;
+        int next_offset = (i < loca_count - 1) ? glyph_offset[i + 1] : glyph_length;
+        total_bmp_size += next_offset - glyph_offset[i] - nbits / 8;
+    }
+
+    uint8_t * glyph_bmp = (uint8_t *)lv_malloc(sizeof(uint8_t) * total_bmp_size);
     LV_ASSERT_MALLOC(glyph_bmp);
 
     font_dsc->glyph_bitmap = glyph_bmp;
 
-    cur_bmp_size = 0;
+    int cur_bmp_size = 0;
 
     for(unsigned int i = 1; i < loca_count; ++i) {
-        lv_fs_res_t res = lv_fs_seek(fp, start + glyph_offset[i], LV_FS_SEEK_SET);
-        if(res != LV_FS_RES_OK) {
-            return -1;
+        if(glyph_dsc[i].box_w * glyph_dsc[i].box_h == 0) {
+            continue;
         }
-        bit_iterator_t bit_it = init_bit_iterator(fp);
 
-        int nbits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
+        int next_offset = (i < loca_count - 1) ? glyph_offset[i + 1] : glyph_length;
+        int bmp_size = next_offset - glyph_offset[i] - nbits / 8;
 
-        read_bits(&bit_it, nbits, &res);
-        if(res != LV_FS_RES_OK) {
-            return -1;
+        if(glyf_mapped) {
+            copy_glyph_bitmap(&glyph_bmp[cur_bmp_size], glyf_mapped + glyph_offset[i] + nbits / 8, bmp_size, nbits % 8);
+            cur_bmp_size += bmp_size;
+            continue;
         }
 
-        if(glyph_dsc[i].box_w * glyph_dsc[i].box_h == 0) {
-            continue;
+        lv_fs_res_t res = lv_fs_seek(fp, start + glyph_offset[i], LV_FS_SEEK_SET);
+        if(res != LV_FS_RES_OK) {
+            return false;
         }
+        bit_iterator_t bit_it = init_bit_iterator(fp, NULL);
 
-        int next_offset = (i < loca_count - 1) ? glyph_offset[i + 1] : (uint32_t)glyph_length;
-        int bmp_size = next_offset - glyph_offset[i] - nbits / 8;
+        read_bits(&bit_it, nbits, &res);
+        if(res != LV_FS_RES_OK) {
+            return false;
+        }
 
         if(nbits % 8 == 0) {  /*Fast path*/
             if(lv_fs_read(fp, &glyph_bmp[cur_bmp_size], bmp_size, NULL) != LV_FS_RES_OK) {
-                return -1;
+                return false;
             }
         }
         else {
             for(int k = 0; k < bmp_size - 1; ++k) {
                 glyph_bmp[cur_bmp_size + k] = read_bits(&bit_it, 8, &res);
                 if(res != LV_FS_RES_OK) {
-                    return -1;
+                    return false;
                 }
             }
             glyph_bmp[cur_bmp_size + bmp_size - 1] = read_bits(&bit_it, 8 - nbits % 8, &res);
             if(res != LV_FS_RES_OK) {
-                return -1;
+                return false;
             }
 
             /*The last fragment should be on the MSB but read_bits() will place it to the LSB*/
@@ -456,7 +590,44 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
 
         cur_bmp_size += bmp_size;
     }
-    return glyph_length;
+    return true;
+}
+
+/*
+ * Load the glyph descriptors and, if `stream` is NULL, the bitmaps of all glyphs.
+ * In streaming mode the glyph table's position and mapping are saved in `stream`
+ * to load the bitmaps on demand.
+ */
+static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
+                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header,
+                          binfont_stream_dsc_t * stream)
+{
+    int32_t glyph_length = read_label(fp, start, "glyf");
+    if(glyph_length < 0) {
+        return -1;
+    }
+
+    /*Parse the glyph table directly from the memory if the driver can map it*/
+    const void * glyf_mapped = NULL;
+    lv_fs_mmap(fp, start, glyph_length, &glyf_mapped);
+
+    bool success = load_glyph_dsc(fp, font_dsc, start, glyf_mapped, glyph_offset, loca_count, glyph_length, header);
+
+    if(stream) {
+        stream->glyf_mapped = glyf_mapped;
+        stream->glyf_start = start;
+        stream->glyf_length = glyph_length;
+        stream->header_bits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
+        glyph_offset[loca_count] = glyph_length;
+    }
+    else {
+        if(success) {
+            success = load_glyph_bitmaps(fp, font_dsc, start, glyf_mapped, glyph_offset, loca_count, glyph_length, header);
+        }
+        if(glyf_mapped) lv_fs_munmap(fp, glyf_mapped, glyph_length);
+    }
+
+    return success ? glyph_length : -1;
 }
 
 static void release_glyph_cb(const lv_font_t * font, lv_font_glyph_dsc_t * glyph_dsc)
@@ -477,13 +648,20 @@ static void release_glyph_cb(const lv_font_t * font, lv_font_glyph_dsc_t * glyph
  *
  * `lv_binfont_destroy` will assume that all non-null pointers are allocated and
  * should be freed.
+ *
+ * If `stream` is not NULL the bitmaps are not loaded, `stream` is used as
+ * the font's descriptor and it stores what is required to load the bitmaps later.
  */
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, binfont_stream_dsc_t * stream)
 {
-    lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)
-                                       lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
-
-    lv_memset(font_dsc, 0, sizeof(lv_font_fmt_txt_dsc_t));
+    lv_font_fmt_txt_dsc_t * font_dsc;
+    if(stream) {
+        font_dsc = &stream->fmt_txt;
+    }
+    else {
+        font_dsc = (lv_font_fmt_txt_dsc_t *)lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
+        lv_memset(font_dsc, 0, sizeof(lv_font_fmt_txt_dsc_t));
+    }
 
     font->dsc = font_dsc;
 
@@ -501,8 +679,8 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     font->base_line = -font_header.descent;
     font->line_height = font_header.ascent - font_header.descent;
     font->get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
-    font->get_glyph_bitmap = lv_font_get_bitmap_fmt_txt;
-    font->release_glyph = release_glyph_cb;
+    font->get_glyph_bitmap = stream ? stream_get_bitmap_cb : lv_font_get_bitmap_fmt_txt;
+    font->release_glyph = stream ? stream_release_glyph_cb : release_glyph_cb;
     font->subpx = font_header.subpixels_mode;
     font->underline_position = (int8_t) font_header.underline_position;
     font->underline_thickness = (int8_t) font_header.underline_thickness;
@@ -561,9 +739,11 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     /*glyph*/
     uint32_t glyph_start = loca_start + loca_length;
     int32_t glyph_length = load_glyph(
-                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header);
+                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header, stream);
 
-    lv_free(glyph_offset);
+    /*The streaming font needs the offsets to find the bitmaps later*/
+    if(stream) stream->glyph_offset = glyph_offset;
+    else lv_free(glyph_offset);
 
     if(glyph_length < 0) {
         return false;
@@ -686,6 +866,9 @@ static lv_font_t * binfont_font_create_cb(const lv_font_info_t * info, const voi
 
     if(info->size == font_src->font_size) {
         if(font_src->path) {
+            if(font_src->glyph_cache_cnt) {
+                return lv_binfont_create_streaming(font_src->path, font_src->glyph_cache_cnt);
+            }
             return lv_binfont_create(font_src->path);
         }
 #if LV_USE_FS_MEMFS
@@ -729,3 +912,104 @@ static void binfont_font_free_src_cb(void * src)
 
     lv_free(font_src);
 }
+
+static const void * stream_get_bitmap_cb(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf)
+{
+    const lv_font_t * font = g_dsc->resolved_font;
+    binfont_stream_dsc_t * stream = (binfont_stream_dsc_t *)font->dsc;
+    uint32_t gid = g_dsc->gid.index;
+    if(!gid) return NULL;
+
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &stream->fmt_txt.glyph_dsc[gid];
+    if(gdsc->box_w * gdsc->box_h == 0) return NULL;
+
+    /*If the bitmaps are byte aligned in the mapped file they can be used directly*/
+    if(stream->glyf_mapped && stream->header_bits % 8 == 0) {
+        const uint8_t * bitmap = stream->glyf_mapped + stream->glyph_offset[gid] + stream->header_bits / 8;
+        if(g_dsc->req_raw_bitmap) return bitmap;
+        return lv_font_fmt_txt_decode_bitmap(g_dsc, bitmap, draw_buf);
+    }
+
+    binfont_glyph_cache_data_t search_key = {
+        .gid = gid,
+    };
+
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(stream->bitmap_cache, &search_key, stream);
+    if(entry == NULL) {
+        LV_LOG_WARN("Couldn't load the bitmap of glyph %" LV_PRIu32, gid);
+        return NULL;
+    }
+
+    binfont_glyph_cache_data_t * data = lv_cache_entry_get_data(entry);
+
+    /*The raw bitmap is used directly so keep the entry until `release_glyph`*/
+    if(g_dsc->req_raw_bitmap) {
+        g_dsc->entry = entry;
+        return data->bitmap;
+    }
+
+    const void * res = lv_font_fmt_txt_decode_bitmap(g_dsc, data->bitmap, draw_buf);
+    lv_cache_release(stream->bitmap_cache, entry, NULL);
+    return res;
+}
+
+static void stream_release_glyph_cb(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc)
+{
+    if(g_dsc->entry == NULL) return;
+
+    binfont_stream_dsc_t * stream = (binfont_stream_dsc_t *)font->dsc;
+    lv_cache_release(stream->bitmap_cache, g_dsc->entry, NULL);
+    g_dsc->entry = NULL;
+}
+
+static bool glyph_cache_create_cb(binfont_glyph_cache_data_t * data, void * user_data)
+{
+    binfont_stream_dsc_t * stream = user_data;
+    uint32_t gid = data->gid;
+    uint32_t header_bytes = stream->header_bits / 8;
+    uint32_t bmp_size = stream->glyph_offset[gid + 1] - stream->glyph_offset[gid] - header_bytes;
+
+    uint8_t * bitmap = lv_malloc(bmp_size);
+    LV_ASSERT_MALLOC(bitmap);
+    if(bitmap == NULL) return false;
+
+    if(stream->glyf_mapped) {
+        copy_glyph_bitmap(bitmap, stream->glyf_mapped + stream->glyph_offset[gid] + header_bytes, bmp_size,
+                          stream->header_bits % 8);
+    }
+    else {
+        /*Read the bitmap with the last bits of the header and shift it in place*/
+        uint32_t pos = stream->glyf_start + stream->glyph_offset[gid] + header_bytes;
+        uint32_t rn = 0;
+        if(lv_fs_seek(&stream->file, pos, LV_FS_SEEK_SET) != LV_FS_RES_OK ||
+           lv_fs_read(&stream->file, bitmap, bmp_size, &rn) != LV_FS_RES_OK || rn != bmp_size) {
+            lv_free(bitmap);
+            return false;
+        }
+        copy_glyph_bitmap(bitmap, bitmap, bmp_size, stream->header_bits % 8);
+    }
+
+    data->bitmap = bitmap;
+    return true;
+}
+
+static void glyph_cache_free_cb(binfont_glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(data->bitmap);
+    data->bitmap = NULL;
+}
+
+static lv_cache_compare_res_t glyph_cache_compare_cb(const binfont_glyph_cache_data_t * lhs,
+                                                     const binfont_glyph_cache_data_t * rhs)
+{
+    if(lhs->gid != rhs->gid) {
+        return lhs->gid > rhs->gid ? 1 : -1;
+    }
+    return 0;
+}
+
+static uint32_t glyph_cache_hash_cb(const binfont_glyph_cache_data_t * data)
+{
+    return lv_cache_hash_data(&data->gid, sizeof(data->gid), LV_CACHE_HASH_SEED);
+}
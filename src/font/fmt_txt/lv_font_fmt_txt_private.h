@@ -41,15 +41,27 @@ typedef struct {
     lv_font_fmt_rle_state_t state;
 } lv_font_fmt_rle_t;
 
+#endif /*LV_USE_FONT_COMPRESSED*/
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Convert the raw bitmap of a glyph of an `lv_font_fmt_txt_dsc_t` font to A8.
+ * Useful for fonts which store the raw bitmaps elsewhere than in `glyph_bitmap`.
+ * @param g_dsc         the glyph descriptor
+ * @param bitmap_in     the raw bitmap of the glyph as it would be in `glyph_bitmap`
+ * @param draw_buf      draw buffer to store the A8 bitmap in
+ * @return              `draw_buf` or NULL on error
+ */
+const void * lv_font_fmt_txt_decode_bitmap(lv_font_glyph_dsc_t * g_dsc, const uint8_t * bitmap_in,
+                                           lv_draw_buf_t * draw_buf);
+
 /**********************
  *      MACROS
  **********************/
 
-#endif
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -0,0 +1,225 @@
+/**
+ * @file lv_freetype_atlas.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_freetype_private.h"
+
+#if LV_USE_FREETYPE
+
+#include "../lv_font_private.h"
+#include "../../misc/cache/lv_cache_entry.h"
+#include FT_TRUETYPE_TABLES_H
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void atlas_header_init(const lv_freetype_font_dsc_t * dsc, lv_font_atlas_header_t * header);
+static void add_glyph(lv_freetype_font_dsc_t * dsc, const lv_font_atlas_glyph_t * glyph, lv_draw_buf_t * draw_buf);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_freetype_font_save_atlas(const lv_font_t * font, const char * path)
+{
+    LV_ASSERT_NULL(font);
+    LV_ASSERT_NULL(path);
+    const lv_freetype_font_dsc_t * dsc = (const lv_freetype_font_dsc_t *)font->dsc;
+    LV_ASSERT_FREETYPE_FONT_DSC(dsc);
+
+    if(dsc->render_mode != LV_FREETYPE_FONT_RENDER_MODE_BITMAP) {
+        LV_LOG_WARN("only bitmap fonts can be saved to an atlas");
+        return LV_RESULT_INVALID;
+    }
+
+    lv_fs_file_t file;
+    if(lv_fs_open(&file, path, LV_FS_MODE_WR) != LV_FS_RES_OK) {
+        LV_LOG_WARN("unable to open %s", path);
+        return LV_RESULT_INVALID;
+    }
+
+    LV_PROFILER_FONT_BEGIN;
+
+    lv_cache_t * glyph_cache = dsc->cache_node->glyph_cache;
+    lv_cache_t * image_cache = dsc->cache_node->draw_data_cache;
+
+    lv_font_atlas_header_t header;
+    atlas_header_init(dsc, &header);
+    lv_result_t res = lv_font_atlas_write_header(&file, &header);
+
+    /*The iterator returns the glyph cache nodes with their cache entry*/
+    lv_freetype_glyph_cache_data_t * data = lv_malloc(lv_cache_entry_get_size(sizeof(lv_freetype_glyph_cache_data_t)));
+    LV_ASSERT_MALLOC(data);
+    lv_iter_t * iter = lv_cache_iter_create(glyph_cache);
+    if(data == NULL || iter == NULL) res = LV_RESULT_INVALID;
+
+    while(res == LV_RESULT_OK && lv_iter_next(iter, data) == LV_RESULT_OK) {
+        /*The cache is shared by all sizes of the face*/
+        if(data->size != dsc->size) continue;
+
+        lv_freetype_image_cache_data_t search_key = {
+            .glyph_index = (FT_UInt)data->glyph_dsc.gid.index,
+            .size = dsc->size,
+        };
+        lv_cache_entry_t * entry = lv_cache_acquire(image_cache, &search_key, NULL);
+        const lv_draw_buf_t * draw_buf = NULL;
+        if(entry) draw_buf = ((lv_freetype_image_cache_data_t *)lv_cache_entry_get_data(entry))->draw_buf;
+
+        lv_font_atlas_glyph_t glyph;
+        lv_font_atlas_glyph_init(&glyph, &data->glyph_dsc, data->unicode);
+        res = lv_font_atlas_write_glyph(&file, &glyph, draw_buf);
+        header.glyph_cnt++;
+
+        if(entry) lv_cache_release(image_cache, entry, NULL);
+    }
+
+    if(iter) lv_iter_destroy(iter);
+    lv_free(data);
+
+    /*Store the final number of glyphs*/
+    if(res == LV_RESULT_OK) {
+        if(lv_fs_seek(&file, 0, LV_FS_SEEK_SET) != LV_FS_RES_OK) res = LV_RESULT_INVALID;
+        else res = lv_font_atlas_write_header(&file, &header);
+    }
+
+    lv_fs_close(&file);
+
+    if(res != LV_RESULT_OK) LV_LOG_WARN("couldn't write %s", path);
+
+    LV_PROFILER_FONT_END;
+    return res;
+}
+
+lv_result_t lv_freetype_font_load_atlas(lv_font_t * font, const char * path)
+{
+    LV_ASSERT_NULL(font);
+    LV_ASSERT_NULL(path);
+    lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)font->dsc;
+    LV_ASSERT_FREETYPE_FONT_DSC(dsc);
+
+    if(dsc->render_mode != LV_FREETYPE_FONT_RENDER_MODE_BITMAP) {
+        LV_LOG_WARN("only bitmap fonts can be loaded from an atlas");
+        return LV_RESULT_INVALID;
+    }
+
+    lv_fs_file_t file;
+    if(lv_fs_open(&file, path, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+        LV_LOG_INFO("unable to open %s", path);
+        return LV_RESULT_INVALID;
+    }
+
+    LV_PROFILER_FONT_BEGIN;
+
+    lv_font_atlas_header_t header;
+    atlas_header_init(dsc, &header);
+    lv_result_t res = lv_font_atlas_read_header(&file, &header);
+
+    for(uint32_t i = 0; res == LV_RESULT_OK && i < header.glyph_cnt; i++) {
+        lv_font_atlas_glyph_t glyph;
+        lv_draw_buf_t * draw_buf;
+        res = lv_font_atlas_read_glyph(&file, &glyph, &draw_buf);
+        if(res == LV_RESULT_OK) add_glyph(dsc, &glyph, draw_buf);
+    }
+
+    lv_fs_close(&file);
+
+    LV_PROFILER_FONT_END;
+    return res;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void atlas_header_init(const lv_freetype_font_dsc_t * dsc, lv_font_atlas_header_t * header)
+{
+    lv_freetype_cache_node_t * cache_node = dsc->cache_node;
+    FT_Face face = cache_node->face;
+
+    lv_memzero(header, sizeof(*header));
+
+    lv_mutex_lock(&cache_node->face_lock);
+
+    /*The revision, checksum adjustment and modification date in the 'head' table identify the font*/
+    const TT_Header * head = FT_Get_Sfnt_Table(face, FT_SFNT_HEAD);
+    if(head) {
+        uint32_t font_id[5] = {
+            (uint32_t)head->Font_Revision,
+            (uint32_t)head->CheckSum_Adjust,
+            (uint32_t)head->Modified[0],
+            (uint32_t)head->Modified[1],
+            (uint32_t)face->num_glyphs,
+        };
+        header->font_hash = lv_cache_hash_data(font_id, sizeof(font_id), LV_CACHE_HASH_SEED);
+    }
+    else {
+        uint32_t num_glyphs = (uint32_t)face->num_glyphs;
+        header->font_hash = lv_cache_hash_data(&num_glyphs, sizeof(num_glyphs), LV_CACHE_HASH_SEED);
+        if(face->family_name) header->font_hash = lv_cache_hash_str(face->family_name, header->font_hash);
+        if(face->style_name) header->font_hash = lv_cache_hash_str(face->style_name, header->font_hash);
+    }
+
+    lv_mutex_unlock(&cache_node->face_lock);
+
+    header->size = dsc->size;
+    header->params = (uint32_t)dsc->style | ((uint32_t)cache_node->weight << 16);
+}
+
+static void add_glyph(lv_freetype_font_dsc_t * dsc, const lv_font_atlas_glyph_t * glyph, lv_draw_buf_t * draw_buf)
+{
+    lv_cache_t * glyph_cache = dsc->cache_node->glyph_cache;
+    lv_cache_t * image_cache = dsc->cache_node->draw_data_cache;
+
+    lv_freetype_glyph_cache_data_t glyph_data = {
+        .unicode = glyph->unicode,
+        .size = dsc->size,
+    };
+    lv_font_atlas_glyph_to_dsc(glyph, &glyph_data.glyph_dsc);
+
+    /*Don't overwrite the glyphs which are already cached*/
+    lv_cache_entry_t * entry = lv_cache_acquire(glyph_cache, &glyph_data, NULL);
+    if(entry == NULL) entry = lv_cache_add(glyph_cache, &glyph_data, NULL);
+    if(entry) lv_cache_release(glyph_cache, entry, NULL);
+
+    if(draw_buf == NULL) return;
+
+    lv_freetype_image_cache_data_t image_data = {
+        .glyph_index = (FT_UInt)glyph->gid,
+        .size = dsc->size,
+        .draw_buf = draw_buf,
+    };
+
+    entry = lv_cache_acquire(image_cache, &image_data, NULL);
+    if(entry) {
+        lv_draw_buf_destroy(draw_buf);
+    }
+    else {
+        entry = lv_cache_add(image_cache, &image_data, NULL);
+        if(entry == NULL) lv_draw_buf_destroy(draw_buf);
+    }
+    if(entry) lv_cache_release(image_cache, entry, NULL);
+}
+
+#endif /*LV_USE_FREETYPE*/
@@ -55,13 +55,6 @@ typedef struct {
 
 #endif /* LV_FREETYPE_CACHE_FT_GLYPH_L1 */
 
-typedef struct _lv_freetype_glyph_cache_data_t {
-    uint32_t unicode;
-    uint32_t size;
-
-    lv_font_glyph_dsc_t glyph_dsc;
-} lv_freetype_glyph_cache_data_t;
-
 /**********************
  *  STATIC PROTOTYPES
  **********************/
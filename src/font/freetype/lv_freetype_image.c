@@ -28,13 +28,6 @@
  *      TYPEDEFS
  **********************/
 
-typedef struct _lv_freetype_image_cache_data_t {
-    FT_UInt glyph_index;
-    uint32_t size;
-
-    lv_draw_buf_t * draw_buf;
-} lv_freetype_image_cache_data_t;
-
 /**********************
  *  STATIC PROTOTYPES
  **********************/
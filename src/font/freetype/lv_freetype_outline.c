@@ -34,8 +34,8 @@ typedef struct _lv_freetype_outline_node_t {
  *  STATIC PROTOTYPES
  **********************/
 
-static lv_freetype_outline_t outline_create(lv_freetype_context_t * ctx, FT_Face face, FT_UInt glyph_index,
-                                            uint32_t size, uint32_t strength);
+static lv_freetype_outline_t outline_create(lv_freetype_context_t * ctx, lv_freetype_cache_node_t * cache_node,
+                                            FT_UInt glyph_index, uint32_t strength);
 static lv_result_t outline_delete(lv_freetype_context_t * ctx, lv_freetype_outline_t outline);
 static const void * freetype_get_glyph_bitmap_cb(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf);
 static void freetype_release_glyph_cb(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc);
@@ -112,6 +112,39 @@ bool lv_freetype_is_outline_font(const lv_font_t * font)
     return dsc->render_mode == LV_FREETYPE_FONT_RENDER_MODE_OUTLINE;
 }
 
+bool lv_freetype_outline_is_cached(const lv_font_t * font, uint32_t glyph_index)
+{
+    LV_ASSERT_NULL(font);
+    lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)font->dsc;
+    LV_ASSERT_FREETYPE_FONT_DSC(dsc);
+
+    lv_freetype_outline_node_t tmp_node;
+    tmp_node.glyph_index = (FT_UInt)glyph_index;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(dsc->cache_node->draw_data_cache, &tmp_node, dsc);
+    if(entry == NULL) {
+        return false;
+    }
+
+    lv_cache_release(dsc->cache_node->draw_data_cache, entry, NULL);
+    return true;
+}
+
+bool lv_freetype_outline_prefetch(const lv_font_t * font, uint32_t glyph_index)
+{
+    LV_ASSERT_NULL(font);
+    lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)font->dsc;
+    LV_ASSERT_FREETYPE_FONT_DSC(dsc);
+
+    lv_cache_entry_t * entry = lv_freetype_outline_lookup(dsc, (FT_UInt)glyph_index);
+    if(entry == NULL) {
+        return false;
+    }
+
+    lv_cache_release(dsc->cache_node->draw_data_cache, entry, NULL);
+    return true;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -122,27 +155,11 @@ bool lv_freetype_is_outline_font(const lv_font_t * font)
 
 static bool freetype_glyph_outline_create_cb(lv_freetype_outline_node_t * node, lv_freetype_font_dsc_t * dsc)
 {
-    LV_PROFILER_FONT_BEGIN;
-    lv_freetype_outline_t outline;
-
-    lv_mutex_lock(&dsc->cache_node->face_lock);
-    outline = outline_create(dsc->context,
-                             dsc->cache_node->face,
-                             node->glyph_index,
-                             dsc->cache_node->ref_size,
-                             (dsc->style & LV_FREETYPE_FONT_STYLE_BOLD) && !FT_HAS_MULTIPLE_MASTERS(dsc->cache_node->face) ? 1 : 0);
-    lv_mutex_unlock(&dsc->cache_node->face_lock);
-
-    if(!outline) {
-        LV_PROFILER_FONT_END;
-        return false;
-    }
-
-    LV_LOG_INFO("glyph_index = 0x%" LV_PRIx32, (uint32_t)node->glyph_index);
+    LV_UNUSED(dsc);
 
-    node->outline = outline;
-    LV_PROFILER_FONT_END;
-    return true;
+    /*The outline is built by `lv_freetype_outline_lookup` before adding it to the cache
+     *so that the cache is not locked while the glyph is loaded and decomposed*/
+    return node->outline != NULL;
 }
 
 static void freetype_glyph_outline_free_cb(lv_freetype_outline_node_t * node, lv_freetype_font_dsc_t * dsc)
@@ -205,13 +222,42 @@ static lv_cache_entry_t * lv_freetype_outline_lookup(lv_freetype_font_dsc_t * ds
 
     lv_freetype_outline_node_t tmp_node;
     tmp_node.glyph_index = glyph_index;
+    tmp_node.outline = NULL;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(cache_node->draw_data_cache, &tmp_node, dsc);
+    if(entry) {
+        LV_PROFILER_FONT_END;
+        return entry;
+    }
+
+    /*Build the outline without holding the cache's lock. Only the face is locked while
+     *the glyph is loaded so the other draw threads can still get the cached outlines
+     *or decompose other glyphs in the meantime.*/
+    tmp_node.outline = outline_create(dsc->context, cache_node, glyph_index,
+                                      (dsc->style & LV_FREETYPE_FONT_STYLE_BOLD) &&
+                                      !FT_HAS_MULTIPLE_MASTERS(cache_node->face) ? 1 : 0);
+    if(tmp_node.outline == NULL) {
+        LV_LOG_ERROR("glyph outline create failed for glyph_index = 0x%" LV_PRIx32, (uint32_t)glyph_index);
+        LV_PROFILER_FONT_END;
+        return NULL;
+    }
+
+    LV_LOG_INFO("glyph_index = 0x%" LV_PRIx32, (uint32_t)glyph_index);
 
-    lv_cache_entry_t * entry = lv_cache_acquire_or_create(cache_node->draw_data_cache, &tmp_node, dsc);
+    entry = lv_cache_acquire_or_create(cache_node->draw_data_cache, &tmp_node, dsc);
     if(!entry) {
         LV_LOG_ERROR("glyph outline lookup failed for glyph_index = 0x%" LV_PRIx32, (uint32_t)glyph_index);
+        outline_delete(dsc->context, tmp_node.outline);
         LV_PROFILER_FONT_END;
         return NULL;
     }
+
+    /*Another thread might have added the same glyph while this one was building it*/
+    lv_freetype_outline_node_t * node = lv_cache_entry_get_data(entry);
+    if(node->outline != tmp_node.outline) {
+        outline_delete(dsc->context, tmp_node.outline);
+    }
+
     LV_PROFILER_FONT_END;
     return entry;
 }
@@ -304,18 +350,21 @@ static int outline_cubic_to_cb(
 
 static lv_freetype_outline_t outline_create(
     lv_freetype_context_t * ctx,
-    FT_Face face,
+    lv_freetype_cache_node_t * cache_node,
     FT_UInt glyph_index,
-    uint32_t size,
     uint32_t strength)
 {
     LV_PROFILER_FONT_BEGIN;
     LV_ASSERT_NULL(ctx);
     FT_Error error;
+    FT_Face face = cache_node->face;
 
-    error = FT_Set_Pixel_Sizes(face, 0, size);
+    lv_mutex_lock(&cache_node->face_lock);
+
+    error = FT_Set_Pixel_Sizes(face, 0, cache_node->ref_size);
     if(error) {
         FT_ERROR_MSG("FT_Set_Char_Size", error);
+        lv_mutex_unlock(&cache_node->face_lock);
         LV_PROFILER_FONT_END;
         return NULL;
     }
@@ -328,6 +377,7 @@ static lv_freetype_outline_t outline_create(
     error = FT_Load_Glyph(face, glyph_index, FT_LOAD_DEFAULT | FT_LOAD_NO_BITMAP | FT_LOAD_NO_AUTOHINT);
     if(error) {
         FT_ERROR_MSG("FT_Load_Glyph", error);
+        lv_mutex_unlock(&cache_node->face_lock);
         LV_PROFILER_FONT_END;
         return NULL;
     }
@@ -339,6 +389,24 @@ static lv_freetype_outline_t outline_create(
         }
     }
 
+    /*Copy the outline out of the face's glyph slot so that it can be decomposed
+     *while the other threads are already using the face*/
+    FT_Glyph glyph;
+    error = FT_Get_Glyph(face->glyph, &glyph);
+    lv_mutex_unlock(&cache_node->face_lock);
+    if(error) {
+        FT_ERROR_MSG("FT_Get_Glyph", error);
+        LV_PROFILER_FONT_END;
+        return NULL;
+    }
+
+    if(glyph->format != FT_GLYPH_FORMAT_OUTLINE) {
+        LV_LOG_ERROR("glyph_index = 0x%" LV_PRIx32 " has no outline", (uint32_t)glyph_index);
+        FT_Done_Glyph(glyph);
+        LV_PROFILER_FONT_END;
+        return NULL;
+    }
+
 
     FT_Outline_Funcs outline_funcs = {
         .move_to = outline_move_to_cb,
@@ -355,7 +423,7 @@ static lv_freetype_outline_t outline_create(
 
     FT_Outline glyph_outline;
     /* decompose glyph */
-    glyph_outline = face->glyph->outline;
+    glyph_outline = ((FT_OutlineGlyph)glyph)->outline;
 
     /*Calculate Total Segments Before decompose */
     int32_t tag_size = glyph_outline.n_points;
@@ -400,12 +468,14 @@ static lv_freetype_outline_t outline_create(
 
     if(res != LV_RESULT_OK || !outline) {
         LV_LOG_ERROR("Outline object create failed");
+        FT_Done_Glyph(glyph);
         LV_PROFILER_FONT_END;
         return NULL;
     }
 
     /* Run outline decompose again to fill outline data */
     error = FT_Outline_Decompose(&glyph_outline, &outline_funcs, outline);
+    FT_Done_Glyph(glyph);
     if(error) {
         FT_ERROR_MSG("FT_Outline_Decompose", error);
         outline_delete(ctx, outline);
@@ -111,6 +111,20 @@ struct _lv_freetype_cache_node_t {
 #endif
 };
 
+typedef struct _lv_freetype_glyph_cache_data_t {
+    uint32_t unicode;
+    uint32_t size;
+
+    lv_font_glyph_dsc_t glyph_dsc;
+} lv_freetype_glyph_cache_data_t;
+
+typedef struct _lv_freetype_image_cache_data_t {
+    FT_UInt glyph_index;
+    uint32_t size;
+
+    lv_draw_buf_t * draw_buf;
+} lv_freetype_image_cache_data_t;
+
 typedef struct _lv_freetype_context_t {
     FT_Library library;
     lv_ll_t face_id_ll;
@@ -162,6 +176,23 @@ void lv_freetype_set_cbs_image_font(lv_freetype_font_dsc_t * dsc);
 lv_cache_t * lv_freetype_create_draw_data_outline(uint32_t cache_size);
 void lv_freetype_set_cbs_outline_font(lv_freetype_font_dsc_t * dsc);
 
+/**
+ * Check if the outline of a glyph is in the outline cache of an outline font
+ * @param font          an outline font created by `lv_freetype_font_create`
+ * @param glyph_index   index of the glyph in the face (`lv_font_glyph_dsc_t::gid.index`)
+ * @return              true: the outline is cached
+ */
+bool lv_freetype_outline_is_cached(const lv_font_t * font, uint32_t glyph_index);
+
+/**
+ * Load and decompose the outline of a glyph into the outline cache of an outline font.
+ * Can be called from any thread, only the face of the font is locked while the glyph is loaded.
+ * @param font          an outline font created by `lv_freetype_font_create`
+ * @param glyph_index   index of the glyph in the face (`lv_font_glyph_dsc_t::gid.index`)
+ * @return              true: the outline is in the cache
+ */
+bool lv_freetype_outline_prefetch(const lv_font_t * font, uint32_t glyph_index);
+
 /**********************
  *      MACROS
  **********************/
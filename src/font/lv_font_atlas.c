@@ -0,0 +1,186 @@
+/**
+ * @file lv_font_atlas.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_font_private.h"
+#include "../core/lv_global.h"
+
+#if LV_USE_FREETYPE || LV_USE_TINY_TTF
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_result_t write_all(lv_fs_file_t * file, const void * buf, uint32_t len);
+static lv_result_t read_all(lv_fs_file_t * file, void * buf, uint32_t len);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_font_atlas_write_header(lv_fs_file_t * file, lv_font_atlas_header_t * header)
+{
+    LV_ASSERT_NULL(file);
+    LV_ASSERT_NULL(header);
+
+    header->magic = LV_FONT_ATLAS_MAGIC;
+    header->version = LV_FONT_ATLAS_VERSION;
+    return write_all(file, header, sizeof(*header));
+}
+
+lv_result_t lv_font_atlas_read_header(lv_fs_file_t * file, lv_font_atlas_header_t * expected)
+{
+    LV_ASSERT_NULL(file);
+    LV_ASSERT_NULL(expected);
+
+    lv_font_atlas_header_t header;
+    if(read_all(file, &header, sizeof(header)) != LV_RESULT_OK) return LV_RESULT_INVALID;
+
+    if(header.magic != LV_FONT_ATLAS_MAGIC || header.version != LV_FONT_ATLAS_VERSION) {
+        LV_LOG_WARN("Not a glyph atlas file or unsupported version");
+        return LV_RESULT_INVALID;
+    }
+
+    if(header.font_hash != expected->font_hash || header.size != expected->size ||
+       header.params != expected->params) {
+        LV_LOG_WARN("The glyph atlas was created for a different font");
+        return LV_RESULT_INVALID;
+    }
+
+    expected->glyph_cnt = header.glyph_cnt;
+    return LV_RESULT_OK;
+}
+
+void lv_font_atlas_glyph_init(lv_font_atlas_glyph_t * glyph, const lv_font_glyph_dsc_t * g_dsc, uint32_t unicode)
+{
+    LV_ASSERT_NULL(glyph);
+    LV_ASSERT_NULL(g_dsc);
+
+    lv_memzero(glyph, sizeof(*glyph));
+    glyph->unicode = unicode;
+    glyph->gid = g_dsc->gid.index;
+    glyph->adv_w = g_dsc->adv_w;
+    glyph->box_w = g_dsc->box_w;
+    glyph->box_h = g_dsc->box_h;
+    glyph->ofs_x = g_dsc->ofs_x;
+    glyph->ofs_y = g_dsc->ofs_y;
+    glyph->format = (uint8_t)g_dsc->format;
+    glyph->is_placeholder = g_dsc->is_placeholder;
+}
+
+void lv_font_atlas_glyph_to_dsc(const lv_font_atlas_glyph_t * glyph, lv_font_glyph_dsc_t * g_dsc)
+{
+    LV_ASSERT_NULL(glyph);
+    LV_ASSERT_NULL(g_dsc);
+
+    lv_memzero(g_dsc, sizeof(*g_dsc));
+    g_dsc->gid.index = glyph->gid;
+    g_dsc->adv_w = glyph->adv_w;
+    g_dsc->box_w = glyph->box_w;
+    g_dsc->box_h = glyph->box_h;
+    g_dsc->ofs_x = glyph->ofs_x;
+    g_dsc->ofs_y = glyph->ofs_y;
+    g_dsc->format = (lv_font_glyph_format_t)glyph->format;
+    g_dsc->is_placeholder = glyph->is_placeholder;
+}
+
+lv_result_t lv_font_atlas_write_glyph(lv_fs_file_t * file, lv_font_atlas_glyph_t * glyph,
+                                      const lv_draw_buf_t * draw_buf)
+{
+    LV_ASSERT_NULL(file);
+    LV_ASSERT_NULL(glyph);
+
+    glyph->cf = draw_buf ? draw_buf->header.cf : LV_COLOR_FORMAT_UNKNOWN;
+    if(write_all(file, glyph, sizeof(*glyph)) != LV_RESULT_OK) return LV_RESULT_INVALID;
+    if(draw_buf == NULL) return LV_RESULT_OK;
+
+    /*Write the lines without the stride padding*/
+    uint32_t line_len = lv_color_format_get_size(draw_buf->header.cf) * draw_buf->header.w;
+    const uint8_t * line = draw_buf->data;
+    for(uint32_t y = 0; y < draw_buf->header.h; y++) {
+        if(write_all(file, line, line_len) != LV_RESULT_OK) return LV_RESULT_INVALID;
+        line += draw_buf->header.stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_font_atlas_read_glyph(lv_fs_file_t * file, lv_font_atlas_glyph_t * glyph, lv_draw_buf_t ** draw_buf)
+{
+    LV_ASSERT_NULL(file);
+    LV_ASSERT_NULL(glyph);
+    LV_ASSERT_NULL(draw_buf);
+
+    *draw_buf = NULL;
+    if(read_all(file, glyph, sizeof(*glyph)) != LV_RESULT_OK) return LV_RESULT_INVALID;
+    if(glyph->cf == LV_COLOR_FORMAT_UNKNOWN) return LV_RESULT_OK;
+
+    if(glyph->cf != LV_COLOR_FORMAT_A8 && glyph->cf != LV_COLOR_FORMAT_ARGB8888) {
+        LV_LOG_WARN("Unsupported glyph color format: %d", glyph->cf);
+        return LV_RESULT_INVALID;
+    }
+
+    lv_draw_buf_t * buf = lv_draw_buf_create_ex(font_draw_buf_handlers, glyph->box_w, glyph->box_h, glyph->cf,
+                                                LV_STRIDE_AUTO);
+    if(buf == NULL) {
+        LV_LOG_WARN("Could not create draw buffer");
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t line_len = lv_color_format_get_size(buf->header.cf) * buf->header.w;
+    uint8_t * line = buf->data;
+    for(uint32_t y = 0; y < buf->header.h; y++) {
+        if(read_all(file, line, line_len) != LV_RESULT_OK) {
+            lv_draw_buf_destroy(buf);
+            return LV_RESULT_INVALID;
+        }
+        line += buf->header.stride;
+    }
+
+    lv_draw_buf_flush_cache(buf, NULL);
+    *draw_buf = buf;
+    return LV_RESULT_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_result_t write_all(lv_fs_file_t * file, const void * buf, uint32_t len)
+{
+    uint32_t bw = 0;
+    lv_fs_res_t res = lv_fs_write(file, buf, len, &bw);
+    return res == LV_FS_RES_OK && bw == len ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+static lv_result_t read_all(lv_fs_file_t * file, void * buf, uint32_t len)
+{
+    uint32_t br = 0;
+    lv_fs_res_t res = lv_fs_read(file, buf, len, &br);
+    return res == LV_FS_RES_OK && br == len ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+#endif /*LV_USE_FREETYPE || LV_USE_TINY_TTF*/
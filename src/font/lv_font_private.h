@@ -19,16 +19,102 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#define LV_FONT_ATLAS_MAGIC     0x4C564741 /* 'LVGA' */
+#define LV_FONT_ATLAS_VERSION   1
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Header of the glyph atlas files written by the font engines
+ * to skip the rasterization of the glyphs after restart.
+ */
+typedef struct {
+    uint32_t magic;         /**< LV_FONT_ATLAS_MAGIC*/
+    uint32_t version;       /**< LV_FONT_ATLAS_VERSION*/
+    uint32_t font_hash;     /**< Identifies the font file*/
+    uint32_t size;          /**< Size of the font in the font engine's representation*/
+    uint32_t params;        /**< Other font engine specific properties affecting the glyphs (e.g. style)*/
+    uint32_t glyph_cnt;     /**< Number of glyphs following the header*/
+} lv_font_atlas_header_t;
+
+/**
+ * A glyph in the atlas file. It's followed by the pixels of the bitmap
+ * without padding if `cf` is not `LV_COLOR_FORMAT_UNKNOWN`.
+ */
+typedef struct {
+    uint32_t unicode;
+    uint32_t gid;
+    int32_t aux;            /**< Font engine specific value*/
+    uint16_t adv_w;
+    uint16_t box_w;
+    uint16_t box_h;
+    int16_t ofs_x;
+    int16_t ofs_y;
+    uint8_t format;         /**< lv_font_glyph_format_t*/
+    uint8_t is_placeholder;
+    uint8_t cf;             /**< Color format of the bitmap*/
+    uint8_t reserved[3];
+} lv_font_atlas_glyph_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
 int32_t lv_font_glyph_dsc_compare(const lv_font_glyph_dsc_t * lhs, const lv_font_glyph_dsc_t * rhs);
 
+/**
+ * Write the header of a glyph atlas file.
+ * @param file      file opened for writing
+ * @param header    the header to write. `magic` and `version` are set by this function.
+ * @return          LV_RESULT_OK: success; LV_RESULT_INVALID: write error
+ */
+lv_result_t lv_font_atlas_write_header(lv_fs_file_t * file, lv_font_atlas_header_t * header);
+
+/**
+ * Read the header of a glyph atlas file and check if it was written for the given font.
+ * @param file      file opened for reading
+ * @param expected  the header describing the font. Its `glyph_cnt` is set from the file.
+ * @return          LV_RESULT_OK: the atlas belongs to the font; LV_RESULT_INVALID: read error or mismatch
+ */
+lv_result_t lv_font_atlas_read_header(lv_fs_file_t * file, lv_font_atlas_header_t * expected);
+
+/**
+ * Initialize an atlas glyph from a glyph descriptor.
+ * @param glyph     the atlas glyph to initialize
+ * @param g_dsc     the glyph descriptor from the font engine's cache
+ * @param unicode   the character of the glyph
+ */
+void lv_font_atlas_glyph_init(lv_font_atlas_glyph_t * glyph, const lv_font_glyph_dsc_t * g_dsc, uint32_t unicode);
+
+/**
+ * Convert an atlas glyph back to a glyph descriptor.
+ * @param glyph     the atlas glyph read from the file
+ * @param g_dsc     the glyph descriptor to initialize
+ */
+void lv_font_atlas_glyph_to_dsc(const lv_font_atlas_glyph_t * glyph, lv_font_glyph_dsc_t * g_dsc);
+
+/**
+ * Write a glyph and its bitmap to a glyph atlas file.
+ * @param file      file opened for writing
+ * @param glyph     the glyph. `cf` is set by this function.
+ * @param draw_buf  the bitmap of the glyph or NULL if it's not cached
+ * @return          LV_RESULT_OK: success; LV_RESULT_INVALID: write error
+ */
+lv_result_t lv_font_atlas_write_glyph(lv_fs_file_t * file, lv_font_atlas_glyph_t * glyph,
+                                      const lv_draw_buf_t * draw_buf);
+
+/**
+ * Read a glyph and its bitmap from a glyph atlas file.
+ * @param file      file opened for reading
+ * @param glyph     store the glyph here
+ * @param draw_buf  store the bitmap here, allocated with the font draw buffer handlers.
+ *                  NULL if the glyph has no bitmap.
+ * @return          LV_RESULT_OK: success; LV_RESULT_INVALID: read error
+ */
+lv_result_t lv_font_atlas_read_glyph(lv_fs_file_t * file, lv_font_atlas_glyph_t * glyph, lv_draw_buf_t ** draw_buf);
+
 /**********************
  *      MACROS
  **********************/
@@ -12,6 +12,7 @@
 #include "../../core/lv_global.h"
 
 #include "../../misc/cache/lv_cache_entry.h"
+#include "../lv_font_private.h"
 
 #define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
 
@@ -125,6 +126,7 @@ static lv_cache_compare_res_t tiny_ttf_kerning_cache_compare_cb(const tiny_ttf_k
                                                                 const tiny_ttf_kerning_cache_data_t * rhs);
 
 static void lv_tiny_ttf_cache_create(ttf_font_desc_t * dsc);
+static void ttf_atlas_header_init(const lv_font_t * font, lv_font_atlas_header_t * header);
 
 static lv_font_t * tiny_ttf_font_create_cb(const lv_font_info_t * info, const void * src);
 static void tiny_ttf_font_delete_cb(lv_font_t * font);
@@ -210,6 +212,126 @@ void lv_tiny_ttf_destroy(lv_font_t * font)
     lv_free(font);
 }
 
+lv_result_t lv_tiny_ttf_save_atlas(const lv_font_t * font, const char * path)
+{
+    LV_ASSERT_NULL(font);
+    LV_ASSERT_NULL(path);
+
+    const ttf_font_desc_t * dsc = (const ttf_font_desc_t *)font->dsc;
+    if(!dsc->cache_size) {
+        LV_LOG_WARN("tiny_ttf: the font has no cache to save");
+        return LV_RESULT_INVALID;
+    }
+
+    lv_fs_file_t file;
+    if(LV_FS_RES_OK != lv_fs_open(&file, path, LV_FS_MODE_WR)) {
+        LV_LOG_WARN("tiny_ttf: unable to open %s", path);
+        return LV_RESULT_INVALID;
+    }
+
+    lv_font_atlas_header_t header;
+    ttf_atlas_header_init(font, &header);
+    lv_result_t res = lv_font_atlas_write_header(&file, &header);
+
+    /*The iterator returns the glyph cache nodes with their cache entry*/
+    tiny_ttf_glyph_cache_data_t * data = lv_malloc(lv_cache_entry_get_size(sizeof(tiny_ttf_glyph_cache_data_t)));
+    LV_ASSERT_MALLOC(data);
+    lv_iter_t * iter = lv_cache_iter_create(dsc->glyph_cache);
+    if(data == NULL || iter == NULL) res = LV_RESULT_INVALID;
+
+    while(res == LV_RESULT_OK && lv_iter_next(iter, data) == LV_RESULT_OK) {
+        tiny_ttf_cache_data_t search_key = {
+            .glyph_index = data->glyph_dsc.gid.index,
+            .size = font->line_height,
+        };
+        lv_cache_entry_t * entry = lv_cache_acquire(dsc->draw_data_cache, &search_key, NULL);
+        const lv_draw_buf_t * draw_buf = NULL;
+        if(entry) draw_buf = ((tiny_ttf_cache_data_t *)lv_cache_entry_get_data(entry))->draw_buf;
+
+        lv_font_atlas_glyph_t glyph;
+        lv_font_atlas_glyph_init(&glyph, &data->glyph_dsc, data->unicode);
+        glyph.aux = data->adv_w;
+        res = lv_font_atlas_write_glyph(&file, &glyph, draw_buf);
+        header.glyph_cnt++;
+
+        if(entry) lv_cache_release(dsc->draw_data_cache, entry, NULL);
+    }
+
+    if(iter) lv_iter_destroy(iter);
+    lv_free(data);
+
+    /*Store the final number of glyphs*/
+    if(res == LV_RESULT_OK) {
+        if(LV_FS_RES_OK != lv_fs_seek(&file, 0, LV_FS_SEEK_SET)) res = LV_RESULT_INVALID;
+        else res = lv_font_atlas_write_header(&file, &header);
+    }
+
+    lv_fs_close(&file);
+
+    if(res != LV_RESULT_OK) LV_LOG_WARN("tiny_ttf: couldn't write %s", path);
+    return res;
+}
+
+lv_result_t lv_tiny_ttf_load_atlas(lv_font_t * font, const char * path)
+{
+    LV_ASSERT_NULL(font);
+    LV_ASSERT_NULL(path);
+
+    ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
+    if(!dsc->cache_size) {
+        LV_LOG_WARN("tiny_ttf: the font has no cache to load the atlas into");
+        return LV_RESULT_INVALID;
+    }
+
+    lv_fs_file_t file;
+    if(LV_FS_RES_OK != lv_fs_open(&file, path, LV_FS_MODE_RD)) {
+        LV_LOG_INFO("tiny_ttf: unable to open %s", path);
+        return LV_RESULT_INVALID;
+    }
+
+    lv_font_atlas_header_t header;
+    ttf_atlas_header_init(font, &header);
+    lv_result_t res = lv_font_atlas_read_header(&file, &header);
+
+    for(uint32_t i = 0; res == LV_RESULT_OK && i < header.glyph_cnt; i++) {
+        lv_font_atlas_glyph_t glyph;
+        lv_draw_buf_t * draw_buf;
+        res = lv_font_atlas_read_glyph(&file, &glyph, &draw_buf);
+        if(res != LV_RESULT_OK) break;
+
+        tiny_ttf_glyph_cache_data_t glyph_data;
+        lv_font_atlas_glyph_to_dsc(&glyph, &glyph_data.glyph_dsc);
+        glyph_data.unicode = glyph.unicode;
+        glyph_data.adv_w = glyph.aux;
+
+        /*Don't overwrite the glyphs which are already cached*/
+        lv_cache_entry_t * entry = lv_cache_acquire(dsc->glyph_cache, &glyph_data, NULL);
+        if(entry == NULL) entry = lv_cache_add(dsc->glyph_cache, &glyph_data, NULL);
+        if(entry) lv_cache_release(dsc->glyph_cache, entry, NULL);
+
+        if(draw_buf == NULL) continue;
+
+        tiny_ttf_cache_data_t draw_data = {
+            .draw_buf = draw_buf,
+            .glyph_index = glyph.gid,
+            .size = font->line_height,
+        };
+
+        entry = lv_cache_acquire(dsc->draw_data_cache, &draw_data, NULL);
+        if(entry) {
+            lv_draw_buf_destroy(draw_buf);
+        }
+        else {
+            entry = lv_cache_add(dsc->draw_data_cache, &draw_data, NULL);
+            if(entry == NULL) lv_draw_buf_destroy(draw_buf);
+        }
+        if(entry) lv_cache_release(dsc->draw_data_cache, entry, NULL);
+    }
+
+    lv_fs_close(&file);
+    return res;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -454,6 +576,24 @@ static void lv_tiny_ttf_cache_create(ttf_font_desc_t * dsc)
     lv_cache_set_name(dsc->kerning_cache, "TINY_TTF_KERNING_DATA");
 }
 
+static void ttf_atlas_header_init(const lv_font_t * font, lv_font_atlas_header_t * header)
+{
+    const ttf_font_desc_t * dsc = (const ttf_font_desc_t *)font->dsc;
+
+    /*The revision, checksum adjustment and modification date in the 'head' table identify the font*/
+    uint32_t font_id[5];
+    font_id[0] = ttULONG(dsc->info.data, dsc->info.head + 4);
+    font_id[1] = ttULONG(dsc->info.data, dsc->info.head + 8);
+    font_id[2] = ttULONG(dsc->info.data, dsc->info.head + 28);
+    font_id[3] = ttULONG(dsc->info.data, dsc->info.head + 32);
+    font_id[4] = (uint32_t)dsc->info.numGlyphs;
+
+    lv_memzero(header, sizeof(*header));
+    header->font_hash = lv_cache_hash_data(font_id, sizeof(font_id), LV_CACHE_HASH_SEED);
+    lv_memcpy(&header->size, &dsc->scale, sizeof(header->size));
+    header->params = dsc->kerning;
+}
+
 static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size_t data_size, int32_t font_size,
                                       lv_font_kerning_t kerning, size_t cache_size)
 {
@@ -337,6 +337,47 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
     return res;
 }
 
+lv_fs_res_t lv_fs_mmap(lv_fs_file_t * file_p, uint32_t offset, uint32_t len, const void ** buf)
+{
+    LV_ASSERT_NULL(buf);
+    *buf = NULL;
+
+    if(file_p->drv == NULL) {
+        return LV_FS_RES_INV_PARAM;
+    }
+
+    if(file_p->drv->mmap_cb == NULL || file_p->drv->munmap_cb == NULL) {
+        return LV_FS_RES_NOT_IMP;
+    }
+
+    LV_PROFILER_FS_BEGIN;
+
+    *buf = file_p->drv->mmap_cb(file_p->drv, file_p->file_d, offset, len);
+
+    LV_PROFILER_FS_END;
+
+    return *buf ? LV_FS_RES_OK : LV_FS_RES_UNKNOWN;
+}
+
+lv_fs_res_t lv_fs_munmap(lv_fs_file_t * file_p, const void * buf, uint32_t len)
+{
+    if(file_p->drv == NULL || buf == NULL) {
+        return LV_FS_RES_INV_PARAM;
+    }
+
+    if(file_p->drv->munmap_cb == NULL) {
+        return LV_FS_RES_NOT_IMP;
+    }
+
+    LV_PROFILER_FS_BEGIN;
+
+    lv_fs_res_t res = file_p->drv->munmap_cb(file_p->drv, file_p->file_d, buf, len);
+
+    LV_PROFILER_FS_END;
+
+    return res;
+}
+
 lv_fs_res_t lv_fs_get_size(lv_fs_file_t * file_p, uint32_t * size_res)
 {
     uint32_t original_pos;
@@ -64,6 +64,8 @@ static lv_fs_res_t fs_close(lv_fs_drv_t * drv, void * file_p);
 static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br);
 static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
 static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
+static const void * fs_mmap(lv_fs_drv_t * drv, void * file_p, uint32_t offset, uint32_t len);
+static lv_fs_res_t fs_munmap(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t len);
 
 /**********************
  *  STATIC VARIABLES
@@ -100,6 +102,8 @@ void lv_fs_memfs_init(void)
     fs_drv.write_cb = NULL;
     fs_drv.seek_cb = fs_seek;
     fs_drv.tell_cb = fs_tell;
+    fs_drv.mmap_cb = fs_mmap;
+    fs_drv.munmap_cb = fs_munmap;
 
     fs_drv.dir_close_cb = NULL;
     fs_drv.dir_open_cb = NULL;
@@ -209,6 +213,39 @@ static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
     return LV_FS_RES_OK;
 }
 
+/**
+ * "Map" a part of the file. The file is already in the memory so just return its address.
+ * @param drv       pointer to a driver where this function belongs
+ * @param file_p    pointer to a FILE variable
+ * @param offset    offset of the first byte to map
+ * @param len       number of bytes to map
+ * @return pointer to the data or NULL if it's out of the buffer
+ */
+static const void * fs_mmap(lv_fs_drv_t * drv, void * file_p, uint32_t offset, uint32_t len)
+{
+    LV_UNUSED(drv);
+    lv_fs_file_t * fp = (lv_fs_file_t *)file_p;
+    if((uint64_t)offset + len > fp->cache->end) return NULL;
+    return (const uint8_t *)fp->cache->buffer + offset;
+}
+
+/**
+ * Nothing to do as `fs_mmap` doesn't create a new mapping
+ * @param drv       pointer to a driver where this function belongs
+ * @param file_p    pointer to a FILE variable
+ * @param buf       the address returned by `fs_mmap`
+ * @param len       number of bytes mapped
+ * @return LV_FS_RES_OK
+ */
+static lv_fs_res_t fs_munmap(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t len)
+{
+    LV_UNUSED(drv);
+    LV_UNUSED(file_p);
+    LV_UNUSED(buf);
+    LV_UNUSED(len);
+    return LV_FS_RES_OK;
+}
+
 #else /*LV_USE_FS_MEMFS == 0*/
 
 #if defined(LV_FS_MEMFS_LETTER) && LV_FS_MEMFS_LETTER != '\0'
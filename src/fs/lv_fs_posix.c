@@ -18,6 +18,14 @@
 #include <unistd.h>
 #include <errno.h>
 
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #define FS_POSIX_MMAP   1
+#else
+    #define FS_POSIX_MMAP   0
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -45,6 +53,10 @@ static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_
 static lv_fs_res_t fs_write(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t btw, uint32_t * bw);
 static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
 static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
+#if FS_POSIX_MMAP
+    static const void * fs_mmap(lv_fs_drv_t * drv, void * file_p, uint32_t offset, uint32_t len);
+    static lv_fs_res_t fs_munmap(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t len);
+#endif
 static void * fs_dir_open(lv_fs_drv_t * drv, const char * path);
 static lv_fs_res_t fs_dir_read(lv_fs_drv_t * drv, void * dir_p, char * fn, uint32_t fn_len);
 static lv_fs_res_t fs_dir_close(lv_fs_drv_t * drv, void * dir_p);
@@ -84,6 +96,10 @@ void lv_fs_posix_init(void)
     fs_drv_p->write_cb = fs_write;
     fs_drv_p->seek_cb = fs_seek;
     fs_drv_p->tell_cb = fs_tell;
+#if FS_POSIX_MMAP
+    fs_drv_p->mmap_cb = fs_mmap;
+    fs_drv_p->munmap_cb = fs_munmap;
+#endif
 
     fs_drv_p->dir_close_cb = fs_dir_close;
     fs_drv_p->dir_open_cb = fs_dir_open;
@@ -254,6 +270,62 @@ static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
     return LV_FS_RES_OK;
 }
 
+#if FS_POSIX_MMAP
+/**
+ * Map a part of a file into the memory for reading
+ * @param drv       pointer to a driver where this function belongs
+ * @param file_p    a file handle variable
+ * @param offset    offset of the first byte to map
+ * @param len       number of bytes to map
+ * @return pointer to the mapped data or NULL on error
+ */
+static const void * fs_mmap(lv_fs_drv_t * drv, void * file_p, uint32_t offset, uint32_t len)
+{
+    LV_UNUSED(drv);
+
+    int fd = FILEP2FD(file_p);
+
+    /*Accessing a mapping beyond the end of the file would raise SIGBUS*/
+    struct stat st;
+    if(fstat(fd, &st) != 0 || len == 0 || (uint64_t)offset + len > (uint64_t)st.st_size) {
+        LV_LOG_WARN("Could not map %" LV_PRIu32 " bytes at %" LV_PRIu32 " of file: %d", len, offset, fd);
+        return NULL;
+    }
+
+    /*The offset of the mapping needs to be page aligned*/
+    uint32_t page_offset = offset % (uint32_t)sysconf(_SC_PAGESIZE);
+    uint8_t * map = mmap(NULL, len + page_offset, PROT_READ, MAP_SHARED, fd, offset - page_offset);
+    if(map == MAP_FAILED) {
+        LV_LOG_WARN("Could not map file: %d, errno: %d", fd, errno);
+        return NULL;
+    }
+
+    return map + page_offset;
+}
+
+/**
+ * Unmap a part of a file mapped by `fs_mmap`
+ * @param drv       pointer to a driver where this function belongs
+ * @param file_p    a file handle variable
+ * @param buf       the address returned by `fs_mmap`
+ * @param len       number of bytes mapped
+ * @return LV_FS_RES_OK: no error or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_munmap(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t len)
+{
+    LV_UNUSED(drv);
+    LV_UNUSED(file_p);
+
+    uint32_t page_offset = (lv_uintptr_t)buf % (uint32_t)sysconf(_SC_PAGESIZE);
+    if(munmap((uint8_t *)buf - page_offset, len + page_offset) != 0) {
+        LV_LOG_WARN("Could not unmap file, errno: %d", errno);
+        return fs_errno_to_res(errno);
+    }
+
+    return LV_FS_RES_OK;
+}
+#endif /*FS_POSIX_MMAP*/
+
 /**
  * Initialize a 'fs_read_dir_t' variable for directory reading
  * @param drv   pointer to a driver where this function belongs
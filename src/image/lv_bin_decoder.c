@@ -52,6 +52,8 @@ typedef struct {
     lv_draw_buf_t * decompressed;       /*Decompressed data could be used directly, thus must also be draw buf*/
     lv_draw_buf_t c_array;              /*An C-array image that need to be converted to a draw buf*/
     lv_draw_buf_t * decoded_partial;    /*A draw buf for decoded image via get_area_cb*/
+    const void * mapped;                /*Pixel data memory-mapped from the file*/
+    uint32_t mapped_size;
 } decoder_data_t;
 
 /**********************
@@ -68,6 +70,7 @@ static lv_result_t decode_alpha_only(lv_image_decoder_t * decoder, lv_image_deco
 static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_color32_t * palette, int32_t x,
                                        int32_t w_px, const uint8_t * in, lv_color32_t * out);
 static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static lv_result_t map_file(lv_image_decoder_dsc_t * dsc);
 
 static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, void * buff, uint32_t btr, uint32_t * br);
 
@@ -219,6 +222,10 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
         if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
             res = decode_compressed(decoder, dsc);
         }
+        else if(map_file(dsc) == LV_RESULT_OK) {
+            res = LV_RESULT_OK;
+            use_directly = true; /*The mapping is released when the decoder closes*/
+        }
         else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
             if(dsc->args.use_indexed) {
                 /*Palette for indexed image and whole image of A8 image are always loaded to RAM for simplicity*/
@@ -552,6 +559,10 @@ static void free_decoder_data(lv_image_decoder_dsc_t * dsc)
     decoder_data_t * decoder_data = dsc->user_data;
     if(decoder_data == NULL) return;
 
+    if(decoder_data->mapped) {
+        lv_fs_munmap(decoder_data->f, decoder_data->mapped, decoder_data->mapped_size);
+    }
+
     if(decoder_data->f) {
         lv_fs_close(decoder_data->f);
         lv_free(decoder_data->f);
@@ -782,6 +793,68 @@ static lv_result_t load_indexed(lv_image_decoder_t * decoder, lv_image_decoder_d
 #endif
 }
 
+/**
+ * Use the pixels of an uncompressed image directly from the file if the file system can map it.
+ * @param dsc   pointer to the decoder descriptor with an opened file
+ * @return      LV_RESULT_OK: `dsc->decoded` points to the mapped pixels;
+ *              LV_RESULT_INVALID: the image needs to be read from the file
+ */
+static lv_result_t map_file(lv_image_decoder_dsc_t * dsc)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    lv_color_format_t cf = dsc->header.cf;
+
+    /*Only the formats which can be drawn as they are stored*/
+    if(cf != LV_COLOR_FORMAT_ARGB8888
+       && cf != LV_COLOR_FORMAT_XRGB8888
+       && cf != LV_COLOR_FORMAT_RGB888
+       && cf != LV_COLOR_FORMAT_RGB565
+       && cf != LV_COLOR_FORMAT_RGB565_SWAPPED
+       && cf != LV_COLOR_FORMAT_RGB565A8
+       && cf != LV_COLOR_FORMAT_ARGB8565
+       && cf != LV_COLOR_FORMAT_A8) {
+        return LV_RESULT_INVALID;
+    }
+
+    /*Post processing would copy the image anyway, so read it as usual*/
+    if(dsc->args.stride_align && cf != LV_COLOR_FORMAT_RGB565A8
+       && dsc->header.stride != lv_draw_buf_width_to_stride(dsc->header.w, cf)) {
+        return LV_RESULT_INVALID;
+    }
+
+    if(dsc->args.premultiply && lv_color_format_has_alpha(cf) && !LV_COLOR_FORMAT_IS_ALPHA_ONLY(cf)
+       && !(dsc->header.flags & LV_IMAGE_FLAGS_PREMULTIPLIED)) {
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t len = dsc->header.stride * dsc->header.h;
+    if(cf == LV_COLOR_FORMAT_RGB565A8) {
+        len += (dsc->header.stride / 2) * dsc->header.h; /*A8 mask*/
+    }
+
+    const void * mapped;
+    if(lv_fs_mmap(decoder_data->f, sizeof(lv_image_header_t), len, &mapped) != LV_FS_RES_OK) {
+        return LV_RESULT_INVALID;
+    }
+
+    /*The mapping is read only, so the draw buffer must not be marked as modifiable or allocated*/
+    lv_image_dsc_t image;
+    lv_memzero(&image, sizeof(image));
+    image.header = dsc->header;
+    image.header.flags &= ~(LV_IMAGE_FLAGS_MODIFIABLE | LV_IMAGE_FLAGS_ALLOCATED);
+    image.data = mapped;
+    image.data_size = len;
+    if(lv_draw_buf_from_image(&decoder_data->c_array, &image) != LV_RESULT_OK) {
+        lv_fs_munmap(decoder_data->f, mapped, len);
+        return LV_RESULT_INVALID;
+    }
+
+    decoder_data->mapped = mapped;
+    decoder_data->mapped_size = len;
+    dsc->decoded = &decoder_data->c_array;
+    return LV_RESULT_OK;
+}
+
 #if LV_BIN_DECODER_RAM_LOAD
 static lv_result_t decode_rgb(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
 {
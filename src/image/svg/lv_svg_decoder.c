@@ -14,7 +14,11 @@
 #include "lv_svg_decoder.h"
 #include "lv_svg_render.h"
 #include "../../draw/lv_draw_buf_private.h"
+#include "../../draw/lv_draw_private.h"
+#include "../../misc/lv_area_private.h"
 #include "../../display/lv_display_private.h"
+#include "../../core/lv_refr_private.h"
+#include "../../misc/cache/lv_cache.h"
 
 /*********************
  *      DEFINES
@@ -26,6 +30,21 @@
  *      TYPEDEFS
  **********************/
 
+#if LV_SVG_RASTER_CACHE_CNT
+typedef struct {
+    const lv_svg_render_obj_t * list;
+    lv_matrix_t matrix;             /*Transformation of the image without the translation to its coordinates*/
+    lv_area_t area;                 /*Area of the raster relative to the coordinates of the image*/
+    lv_draw_buf_t * draw_buf;
+} svg_raster_cache_data_t;
+
+typedef struct {
+    lv_cache_t * raster_cache;
+    lv_array_t drawn_entries;       /*Raster cache entries used in the current refresh*/
+    lv_display_t * drawn_disp;      /*The entries are released when this display is refreshed or deleted*/
+} svg_decoder_data_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -34,10 +53,23 @@ static lv_result_t svg_decoder_info(lv_image_decoder_t * decoder, lv_image_decod
 static lv_result_t svg_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 static void svg_decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 static uint8_t * alloc_file(const char * filename, uint32_t * size);
+static lv_svg_node_t * load_mapped_file(const char * filename);
 static void svg_draw_buf_free(void * svg_buf);
 
 static void svg_draw(lv_layer_t * layer, const lv_image_decoder_dsc_t * dsc, const lv_area_t * coords,
                      const lv_draw_image_dsc_t * draw_dsc, const lv_area_t * clip_area);
+
+#if LV_SVG_RASTER_CACHE_CNT
+    static lv_image_decoder_t * get_svg_decoder(void);
+    static bool raster_draw(lv_layer_t * layer, lv_image_decoder_t * decoder, const lv_svg_render_obj_t * list,
+                            const lv_matrix_t * matrix, const lv_area_t * coords, const lv_draw_image_dsc_t * image_dsc,
+                            const lv_area_t * clip_area);
+    static void raster_drop_list(lv_image_decoder_t * decoder, const lv_svg_render_obj_t * list);
+    static void raster_release_drawn(lv_image_decoder_t * decoder);
+    static lv_cache_compare_res_t raster_cache_compare_cb(const svg_raster_cache_data_t * lhs,
+                                                          const svg_raster_cache_data_t * rhs);
+    static void raster_cache_free_cb(svg_raster_cache_data_t * data, void * user_data);
+#endif
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -64,6 +96,22 @@ void lv_svg_decoder_init(void)
     lv_image_decoder_set_close_cb(dec, svg_decoder_close);
 
     dec->name = DECODER_NAME;
+
+#if LV_SVG_RASTER_CACHE_CNT
+    svg_decoder_data_t * data = lv_zalloc(sizeof(svg_decoder_data_t));
+    LV_ASSERT_MALLOC(data);
+    if(data == NULL) return;
+
+    data->raster_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(svg_raster_cache_data_t),
+    LV_SVG_RASTER_CACHE_CNT, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) raster_cache_compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t) raster_cache_free_cb,
+    });
+    lv_cache_set_name(data->raster_cache, "SVG_RASTER");
+    lv_array_init(&data->drawn_entries, 8, sizeof(lv_cache_entry_t *));
+    dec->user_data = data;
+#endif
 }
 
 void lv_svg_decoder_deinit(void)
@@ -71,6 +119,16 @@ void lv_svg_decoder_deinit(void)
     lv_image_decoder_t * dec = NULL;
     while((dec = lv_image_decoder_get_next(dec)) != NULL) {
         if(dec->info_cb == svg_decoder_info) {
+#if LV_SVG_RASTER_CACHE_CNT
+            svg_decoder_data_t * data = dec->user_data;
+            if(data) {
+                raster_release_drawn(dec);
+                lv_array_deinit(&data->drawn_entries);
+                lv_cache_destroy(data->raster_cache, NULL);
+                lv_free(data);
+                dec->user_data = NULL;
+            }
+#endif
             lv_image_decoder_delete(dec);
             break;
         }
@@ -203,13 +261,16 @@ static lv_result_t svg_decoder_open(lv_image_decoder_t * decoder, lv_image_decod
 
     uint8_t * svg_data = NULL;
     uint32_t svg_data_size = 0;
+    lv_svg_node_t * svg_doc = NULL;
 
     if(dsc->src_type == LV_IMAGE_SRC_FILE) {
         const char * fn = dsc->src;
         if(lv_strcmp(lv_fs_get_ext(fn), "svg") == 0) {              /*Check the extension*/
 
-            svg_data = alloc_file(fn, &svg_data_size);
-            if(svg_data == NULL) {
+            /*Parse the file directly from the mapping if possible to avoid reading it to a buffer*/
+            svg_doc = load_mapped_file(fn);
+            if(svg_doc == NULL) svg_data = alloc_file(fn, &svg_data_size);
+            if(svg_doc == NULL && svg_data == NULL) {
                 LV_LOG_WARN("can't load file: %s", (const char *)dsc->src);
                 LV_PROFILER_DECODER_END_TAG("lv_svg_decoder_open");
                 return LV_RESULT_INVALID;
@@ -231,7 +292,7 @@ static lv_result_t svg_decoder_open(lv_image_decoder_t * decoder, lv_image_decod
         return LV_RESULT_INVALID;
     }
 
-    lv_svg_node_t * svg_doc = lv_svg_load_data((char *)svg_data, svg_data_size);
+    if(svg_doc == NULL) svg_doc = lv_svg_load_data((char *)svg_data, svg_data_size);
     lv_svg_render_obj_t * draw_list = lv_svg_render_create(svg_doc);
 
     if(dsc->src_type == LV_IMAGE_SRC_FILE) {
@@ -338,9 +399,45 @@ failed:
     return data;
 }
 
+static lv_svg_node_t * load_mapped_file(const char * filename)
+{
+    lv_fs_file_t f;
+    uint32_t data_size;
+    const void * data;
+    lv_svg_node_t * svg_doc = NULL;
+
+    if(lv_fs_open(&f, filename, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+        return NULL;
+    }
+
+    if(lv_fs_seek(&f, 0, LV_FS_SEEK_END) != LV_FS_RES_OK
+       || lv_fs_tell(&f, &data_size) != LV_FS_RES_OK
+       || data_size == 0) {
+        goto failed;
+    }
+
+    if(lv_fs_mmap(&f, 0, data_size, &data) != LV_FS_RES_OK) {
+        goto failed;
+    }
+
+    svg_doc = lv_svg_load_data(data, data_size);
+    lv_fs_munmap(&f, data, data_size);
+
+failed:
+    lv_fs_close(&f);
+    return svg_doc;
+}
+
 static void svg_draw_buf_free(void * svg_buf)
 {
     lv_svg_render_obj_t * draw_list = (lv_svg_render_obj_t *)svg_buf;
+
+#if LV_SVG_RASTER_CACHE_CNT
+    /*A new list can be allocated to the same address so drop the rasters of this one*/
+    lv_image_decoder_t * decoder = get_svg_decoder();
+    if(decoder) raster_drop_list(decoder, draw_list);
+#endif
+
     lv_svg_render_delete(draw_list);
 }
 
@@ -352,6 +449,30 @@ static void svg_draw(lv_layer_t * layer, const lv_image_decoder_dsc_t * decoder_
 
     LV_PROFILER_DRAW_BEGIN;
 
+    /*The transformation of the image relative to its coordinates*/
+    lv_matrix_t local_matrix;
+    lv_matrix_identity(&local_matrix);
+    if(image_dsc) {
+        int32_t off_x = (lv_area_get_width(coords) - (int32_t)image_dsc->header.w - 1) / 2;
+        int32_t off_y = (lv_area_get_height(coords) - (int32_t)image_dsc->header.h - 1) / 2;
+
+        if(image_dsc->pivot.x != 0 || image_dsc->pivot.y != 0) {
+            lv_matrix_translate(&local_matrix, off_x, off_y);
+        }
+        lv_matrix_translate(&local_matrix, image_dsc->pivot.x, image_dsc->pivot.y);
+        lv_matrix_rotate(&local_matrix, image_dsc->rotation / 10.0f);
+        lv_matrix_scale(&local_matrix, image_dsc->scale_x / 256.0f, image_dsc->scale_y / 256.0f);
+        lv_matrix_translate(&local_matrix, -image_dsc->pivot.x, -image_dsc->pivot.y);
+    }
+
+#if LV_SVG_RASTER_CACHE_CNT
+    /*Static images are drawn from a bitmap rendered once with the same transformation*/
+    if(image_dsc && raster_draw(layer, decoder_dsc->decoder, list, &local_matrix, coords, image_dsc, clip_area)) {
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+#endif
+
     lv_draw_vector_dsc_t * dsc = lv_draw_vector_dsc_create(layer);
 
     /*Save the widget so that `LV_EVENT_DRAW_TASK_ADDED` can be sent to it in `lv_draw_vector`*/
@@ -360,25 +481,229 @@ static void svg_draw(lv_layer_t * layer, const lv_image_decoder_dsc_t * decoder_
     lv_matrix_t matrix;
     lv_matrix_identity(&matrix);
     lv_matrix_translate(&matrix, coords->x1, coords->y1);
+    lv_matrix_multiply(&matrix, &local_matrix);
     dsc->ctx->scissor_area = *clip_area;
-    if(image_dsc) {
-        int32_t off_x = (lv_area_get_width(coords) - (int32_t)image_dsc->header.w - 1) / 2;
-        int32_t off_y = (lv_area_get_height(coords) - (int32_t)image_dsc->header.h - 1) / 2;
+    lv_draw_vector_dsc_set_transform(dsc, &matrix);
+    lv_draw_svg_render(dsc, list);
+    lv_draw_vector(dsc);
+    lv_draw_vector_dsc_delete(dsc);
 
-        if(image_dsc->pivot.x != 0 || image_dsc->pivot.y != 0) {
-            lv_matrix_translate(&matrix, off_x, off_y);
+    LV_PROFILER_DRAW_END;
+}
+
+#if LV_SVG_RASTER_CACHE_CNT
+
+static lv_image_decoder_t * get_svg_decoder(void)
+{
+    lv_image_decoder_t * dec = NULL;
+    while((dec = lv_image_decoder_get_next(dec)) != NULL) {
+        if(dec->info_cb == svg_decoder_info) return dec;
+    }
+    return NULL;
+}
+
+static void raster_get_area(const lv_matrix_t * matrix, int32_t w, int32_t h, lv_area_t * area)
+{
+    lv_fpoint_t points[4] = {{0, 0}, {(float)w, 0}, {0, (float)h}, {(float)w, (float)h}};
+    lv_fpoint_t min;
+    lv_fpoint_t max;
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_matrix_transform_point(matrix, &points[i]);
+        if(i == 0) {
+            min = points[0];
+            max = points[0];
+            continue;
         }
-        lv_matrix_translate(&matrix, image_dsc->pivot.x, image_dsc->pivot.y);
-        lv_matrix_rotate(&matrix, image_dsc->rotation / 10.0f);
-        lv_matrix_scale(&matrix, image_dsc->scale_x / 256.0f, image_dsc->scale_y / 256.0f);
-        lv_matrix_translate(&matrix, -image_dsc->pivot.x, -image_dsc->pivot.y);
+        min.x = LV_MIN(min.x, points[i].x);
+        min.y = LV_MIN(min.y, points[i].y);
+        max.x = LV_MAX(max.x, points[i].x);
+        max.y = LV_MAX(max.y, points[i].y);
     }
-    lv_draw_vector_dsc_set_transform(dsc, &matrix);
+
+    /*Add 1 px for the anti-aliasing and 1 px as the casts round towards zero*/
+    area->x1 = (int32_t)min.x - 2;
+    area->y1 = (int32_t)min.y - 2;
+    area->x2 = (int32_t)max.x + 2;
+    area->y2 = (int32_t)max.y + 2;
+}
+
+static lv_draw_buf_t * raster_create(lv_display_t * disp, const lv_svg_render_obj_t * list,
+                                     const lv_matrix_t * matrix, const lv_area_t * area)
+{
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(lv_area_get_width(area), lv_area_get_height(area),
+                                                  LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    if(draw_buf == NULL) return NULL;
+    lv_draw_buf_clear(draw_buf, NULL);
+
+    lv_layer_t layer;
+    lv_layer_init(&layer);
+    layer.draw_buf = draw_buf;
+    layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+    layer.buf_area = *area;
+    layer._clip_area = *area;
+    layer.phy_clip_area = *area;
+
+    lv_draw_unit_send_event(NULL, LV_EVENT_CHILD_CREATED, &layer);
+
+    lv_draw_vector_dsc_t * dsc = lv_draw_vector_dsc_create(&layer);
+    dsc->ctx->scissor_area = *area;
+    lv_draw_vector_dsc_set_transform(dsc, matrix);
     lv_draw_svg_render(dsc, list);
     lv_draw_vector(dsc);
     lv_draw_vector_dsc_delete(dsc);
 
-    LV_PROFILER_DRAW_END;
+    /*Render it now as the display's layer is still being created*/
+    layer.all_tasks_added = true;
+    lv_draw_dispatch_request();
+    while(layer.draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        if(!lv_draw_dispatch_layer(disp, &layer)) {
+            lv_draw_wait_for_finish();
+            lv_draw_dispatch_request();
+        }
+    }
+
+    lv_draw_unit_send_event(NULL, LV_EVENT_SCREEN_LOAD_START, &layer);
+    lv_draw_unit_send_event(NULL, LV_EVENT_CHILD_DELETED, &layer);
+
+    return draw_buf;
+}
+
+static void raster_disp_event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    if(code != LV_EVENT_REFR_READY && code != LV_EVENT_DELETE) return;
+
+    raster_release_drawn(lv_event_get_user_data(e));
+}
+
+static bool raster_draw(lv_layer_t * layer, lv_image_decoder_t * decoder, const lv_svg_render_obj_t * list,
+                        const lv_matrix_t * matrix, const lv_area_t * coords, const lv_draw_image_dsc_t * image_dsc,
+                        const lv_area_t * clip_area)
+{
+    svg_decoder_data_t * data = decoder ? decoder->user_data : NULL;
+    if(data == NULL) return false;
+
+    /*The rasters can be released only when the draw tasks using them are done,
+     *i.e. at the end of the refresh. Outside of a refresh (e.g. on a canvas) draw the vectors.*/
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+    if(disp == NULL) return false;
+    if(data->drawn_disp && data->drawn_disp != disp) return false;
+
+    svg_raster_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.list = list;
+    search_key.matrix = *matrix;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(data->raster_cache, &search_key, NULL);
+    if(entry == NULL) {
+        raster_get_area(matrix, image_dsc->header.w, image_dsc->header.h, &search_key.area);
+
+        /*Don't keep bitmaps larger than the screen*/
+        uint32_t raster_size = lv_area_get_size(&search_key.area);
+        uint32_t disp_size = (uint32_t)lv_display_get_horizontal_resolution(disp) *
+                             lv_display_get_vertical_resolution(disp);
+        if(raster_size > disp_size) return false;
+
+        search_key.draw_buf = raster_create(disp, list, matrix, &search_key.area);
+        if(search_key.draw_buf == NULL) return false;
+
+        entry = lv_cache_add(data->raster_cache, &search_key, NULL);
+        if(entry == NULL) {
+            /*All the entries are in use*/
+            lv_draw_buf_destroy(search_key.draw_buf);
+            return false;
+        }
+    }
+
+    if(data->drawn_disp == NULL) {
+        data->drawn_disp = disp;
+        lv_display_add_event_cb(disp, raster_disp_event_cb, LV_EVENT_ALL, decoder);
+    }
+    lv_array_push_back(&data->drawn_entries, &entry);
+
+    svg_raster_cache_data_t * raster = lv_cache_entry_get_data(entry);
+
+    lv_draw_image_dsc_t raster_dsc;
+    lv_draw_image_dsc_init(&raster_dsc);
+    raster_dsc.src = raster->draw_buf;
+    raster_dsc.base.obj = image_dsc->base.obj;
+
+    lv_area_t raster_area = raster->area;
+    lv_area_move(&raster_area, coords->x1, coords->y1);
+
+    lv_area_t clip_ori = layer->_clip_area;
+    if(lv_area_intersect(&layer->_clip_area, &layer->_clip_area, clip_area)) {
+        lv_draw_image(layer, &raster_dsc, &raster_area);
+    }
+    layer->_clip_area = clip_ori;
+
+    return true;
+}
+
+static void raster_release_drawn(lv_image_decoder_t * decoder)
+{
+    svg_decoder_data_t * data = decoder->user_data;
+    uint32_t i;
+    uint32_t cnt = lv_array_size(&data->drawn_entries);
+    for(i = 0; i < cnt; i++) {
+        lv_cache_entry_t ** entry = lv_array_at(&data->drawn_entries, i);
+        lv_cache_release(data->raster_cache, *entry, NULL);
+    }
+    lv_array_clear(&data->drawn_entries);
+
+    if(data->drawn_disp) {
+        lv_display_remove_event_cb_with_user_data(data->drawn_disp, raster_disp_event_cb, decoder);
+        data->drawn_disp = NULL;
+    }
 }
 
+static void raster_drop_list(lv_image_decoder_t * decoder, const lv_svg_render_obj_t * list)
+{
+    svg_decoder_data_t * data = decoder->user_data;
+    if(data == NULL) return;
+
+    svg_raster_cache_data_t * node = lv_malloc(lv_cache_entry_get_size(sizeof(svg_raster_cache_data_t)));
+    LV_ASSERT_MALLOC(node);
+    lv_array_t keys;
+    lv_array_init(&keys, 4, sizeof(svg_raster_cache_data_t));
+
+    /*Collect the keys first as dropping them would invalidate the iterator*/
+    lv_iter_t * iter = lv_cache_iter_create(data->raster_cache);
+    if(node && iter) {
+        while(lv_iter_next(iter, node) == LV_RESULT_OK) {
+            if(node->list == list) lv_array_push_back(&keys, node);
+        }
+    }
+    if(iter) lv_iter_destroy(iter);
+    lv_free(node);
+
+    uint32_t i;
+    for(i = 0; i < lv_array_size(&keys); i++) {
+        lv_cache_drop(data->raster_cache, lv_array_at(&keys, i), NULL);
+    }
+    lv_array_deinit(&keys);
+}
+
+static lv_cache_compare_res_t raster_cache_compare_cb(const svg_raster_cache_data_t * lhs,
+                                                      const svg_raster_cache_data_t * rhs)
+{
+    if(lhs->list != rhs->list) return lhs->list > rhs->list ? 1 : -1;
+
+    int32_t cmp_res = lv_memcmp(&lhs->matrix, &rhs->matrix, sizeof(lv_matrix_t));
+    if(cmp_res != 0) return cmp_res > 0 ? 1 : -1;
+
+    return 0;
+}
+
+static void raster_cache_free_cb(svg_raster_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_draw_buf_destroy(data->draw_buf);
+    data->draw_buf = NULL;
+}
+
+#endif /*LV_SVG_RASTER_CACHE_CNT*/
+
 #endif /*LV_USE_SVG*/
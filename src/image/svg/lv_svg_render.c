@@ -73,8 +73,15 @@ static void _special_render(const lv_svg_render_obj_t * obj, lv_draw_vector_dsc_
     static void _freetype_outline_cb(lv_event_t * e);
 #endif
 
+/* the common part of the basic shapes whose path is built when the list is compiled */
 typedef struct {
     lv_svg_render_obj_t base;
+    lv_vector_path_t * path;
+} lv_svg_render_shape_t;
+
+typedef struct {
+    lv_svg_render_obj_t base;
+    lv_vector_path_t * path;
     float width;
     float height;
     bool viewport_fill;
@@ -90,6 +97,7 @@ typedef struct {
     float x;
     float y;
     char * xlink;
+    lv_svg_render_obj_t * target;
 } lv_svg_render_use_t;
 
 typedef struct {
@@ -106,6 +114,7 @@ typedef struct {
 
 typedef struct {
     lv_svg_render_obj_t base;
+    lv_vector_path_t * path;
     float x;
     float y;
     float width;
@@ -116,6 +125,7 @@ typedef struct {
 
 typedef struct {
     lv_svg_render_obj_t base;
+    lv_vector_path_t * path;
     float cx;
     float cy;
     float r;
@@ -123,6 +133,7 @@ typedef struct {
 
 typedef struct {
     lv_svg_render_obj_t base;
+    lv_vector_path_t * path;
     float cx;
     float cy;
     float rx;
@@ -131,6 +142,7 @@ typedef struct {
 
 typedef struct {
     lv_svg_render_obj_t base;
+    lv_vector_path_t * path;
     float x1;
     float y1;
     float x2;
@@ -1026,30 +1038,12 @@ static void _copy_draw_dsc(lv_vector_path_ctx_t * dst, const lv_vector_path_ctx_
 static void _copy_draw_dsc_from_ref(lv_draw_vector_dsc_t * dsc, const lv_svg_render_obj_t * obj)
 {
     lv_vector_path_ctx_t * dst = dsc->ctx;
-    if(obj->fill_ref) {
-        lv_svg_render_obj_t * list = obj->head;
-        while(list) {
-            if(list->id) {
-                if(strcmp(obj->fill_ref, list->id) == 0) {
-                    list->clz->set_paint_ref(list, dst, obj, true);
-                    break;
-                }
-            }
-            list = list->next;
-        }
+    if(obj->fill_ref_obj) {
+        obj->fill_ref_obj->clz->set_paint_ref(obj->fill_ref_obj, dst, obj, true);
     }
 
-    if(obj->stroke_ref) {
-        lv_svg_render_obj_t * list = obj->head;
-        while(list) {
-            if(list->id) {
-                if(strcmp(obj->stroke_ref, list->id) == 0) {
-                    list->clz->set_paint_ref(list, dst, obj, false);
-                    break;
-                }
-            }
-            list = list->next;
-        }
+    if(obj->stroke_ref_obj) {
+        obj->stroke_ref_obj->clz->set_paint_ref(obj->stroke_ref_obj, dst, obj, false);
     }
 }
 
@@ -1300,90 +1294,107 @@ static void _special_render(const lv_svg_render_obj_t * obj, lv_draw_vector_dsc_
     }
 }
 
-/* render functions */
-static void _render_viewport(const lv_svg_render_obj_t * obj, lv_draw_vector_dsc_t * dsc, const lv_matrix_t * matrix)
+/* compile functions */
+static lv_svg_render_obj_t * _find_obj(const lv_svg_render_obj_t * list, const char * id)
 {
-    LV_UNUSED(matrix);
+    if(!id) {
+        return NULL;
+    }
 
-    lv_svg_render_viewport_t * view = (lv_svg_render_viewport_t *)obj;
-    lv_matrix_multiply(&dsc->ctx->matrix, &obj->matrix);
-    if(view->viewport_fill) {
-        lv_area_t rc = {0, 0, (int32_t)view->width, (int32_t)view->height};
-        lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
-        lv_vector_path_append_rect(path, &rc, 0, 0);
-        lv_draw_vector_dsc_add_path(dsc, path);
-        lv_vector_path_delete(path);
+    while(list) {
+        if(list->id && strcmp(id, list->id) == 0) {
+            return (lv_svg_render_obj_t *)list;
+        }
+        list = list->next;
     }
+    return NULL;
 }
 
-static void _render_rect(const lv_svg_render_obj_t * obj, lv_draw_vector_dsc_t * dsc, const lv_matrix_t * matrix)
+static void _compile_obj(lv_svg_render_obj_t * obj, const lv_svg_render_obj_t * list)
 {
-    lv_matrix_t mtx;
-    _setup_matrix(&mtx, dsc, obj);
+    lv_svg_render_obj_t * ref = _find_obj(list, obj->fill_ref);
+    obj->fill_ref_obj = (ref && ref->clz->set_paint_ref) ? ref : NULL;
 
-    if(matrix) {
-        lv_matrix_multiply(&dsc->ctx->matrix, matrix);
+    ref = _find_obj(list, obj->stroke_ref);
+    obj->stroke_ref_obj = (ref && ref->clz->set_paint_ref) ? ref : NULL;
+
+    if(obj->clz->compile) {
+        obj->clz->compile(obj, list);
     }
+}
 
+static void _compile_viewport(lv_svg_render_obj_t * obj, const lv_svg_render_obj_t * list)
+{
+    LV_UNUSED(list);
+    lv_svg_render_viewport_t * view = (lv_svg_render_viewport_t *)obj;
+    if(view->viewport_fill) {
+        lv_area_t rc = {0, 0, (int32_t)view->width, (int32_t)view->height};
+        view->path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+        lv_vector_path_append_rect(view->path, &rc, 0, 0);
+    }
+}
+
+static void _compile_rect(lv_svg_render_obj_t * obj, const lv_svg_render_obj_t * list)
+{
+    LV_UNUSED(list);
     lv_svg_render_rect_t * rect = (lv_svg_render_rect_t *)obj;
 
     if(rect->rx > 0 && rect->ry == 0) rect->ry = rect->rx;
     else if(rect->ry > 0 && rect->rx == 0) rect->rx = rect->ry;
 
-    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+    rect->path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
     lv_area_t rc = {(int32_t)rect->x, (int32_t)rect->y, (int32_t)(rect->x + rect->width - 1), (int32_t)(rect->y + rect->height - 1)};
-    lv_vector_path_append_rect(path, &rc, rect->rx, rect->ry);
-
-    _copy_draw_dsc_from_ref(dsc, obj);
-    lv_draw_vector_dsc_add_path(dsc, path);
-    lv_vector_path_delete(path);
-
-    _restore_matrix(&mtx, dsc);
+    lv_vector_path_append_rect(rect->path, &rc, rect->rx, rect->ry);
 }
 
-static void _render_circle(const lv_svg_render_obj_t * obj, lv_draw_vector_dsc_t * dsc, const lv_matrix_t * matrix)
+static void _compile_circle(lv_svg_render_obj_t * obj, const lv_svg_render_obj_t * list)
 {
-    lv_matrix_t mtx;
-    _setup_matrix(&mtx, dsc, obj);
-
-    if(matrix) {
-        lv_matrix_multiply(&dsc->ctx->matrix, matrix);
-    }
-
+    LV_UNUSED(list);
     lv_svg_render_circle_t * circle = (lv_svg_render_circle_t *)obj;
-    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+    circle->path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
     lv_fpoint_t cp = {circle->cx, circle->cy};
-    lv_vector_path_append_circle(path, &cp, circle->r, circle->r);
-
-    _copy_draw_dsc_from_ref(dsc, obj);
-    lv_draw_vector_dsc_add_path(dsc, path);
-    lv_vector_path_delete(path);
-
-    _restore_matrix(&mtx, dsc);
+    lv_vector_path_append_circle(circle->path, &cp, circle->r, circle->r);
 }
 
-static void _render_ellipse(const lv_svg_render_obj_t * obj, lv_draw_vector_dsc_t * dsc, const lv_matrix_t * matrix)
+static void _compile_ellipse(lv_svg_render_obj_t * obj, const lv_svg_render_obj_t * list)
 {
-    lv_matrix_t mtx;
-    _setup_matrix(&mtx, dsc, obj);
-
-    if(matrix) {
-        lv_matrix_multiply(&dsc->ctx->matrix, matrix);
-    }
-
+    LV_UNUSED(list);
     lv_svg_render_ellipse_t * ellipse = (lv_svg_render_ellipse_t *)obj;
-    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+    ellipse->path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
     lv_fpoint_t cp = {ellipse->cx, ellipse->cy};
-    lv_vector_path_append_circle(path, &cp, ellipse->rx, ellipse->ry);
+    lv_vector_path_append_circle(ellipse->path, &cp, ellipse->rx, ellipse->ry);
+}
 
-    _copy_draw_dsc_from_ref(dsc, obj);
-    lv_draw_vector_dsc_add_path(dsc, path);
-    lv_vector_path_delete(path);
+static void _compile_line(lv_svg_render_obj_t * obj, const lv_svg_render_obj_t * list)
+{
+    LV_UNUSED(list);
+    lv_svg_render_line_t * line = (lv_svg_render_line_t *)obj;
+    line->path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+    lv_fpoint_t sp = {line->x1, line->y1};
+    lv_vector_path_move_to(line->path, &sp);
+    lv_fpoint_t ep = {line->x2, line->y2};
+    lv_vector_path_line_to(line->path, &ep);
+}
 
-    _restore_matrix(&mtx, dsc);
+static void _compile_use(lv_svg_render_obj_t * obj, const lv_svg_render_obj_t * list)
+{
+    lv_svg_render_use_t * use = (lv_svg_render_use_t *)obj;
+    use->target = _find_obj(list, use->xlink);
 }
 
-static void _render_line(const lv_svg_render_obj_t * obj, lv_draw_vector_dsc_t * dsc, const lv_matrix_t * matrix)
+/* render functions */
+static void _render_viewport(const lv_svg_render_obj_t * obj, lv_draw_vector_dsc_t * dsc, const lv_matrix_t * matrix)
+{
+    LV_UNUSED(matrix);
+
+    lv_svg_render_viewport_t * view = (lv_svg_render_viewport_t *)obj;
+    lv_matrix_multiply(&dsc->ctx->matrix, &obj->matrix);
+    if(view->path) {
+        lv_draw_vector_dsc_add_path(dsc, view->path);
+    }
+}
+
+static void _render_shape(const lv_svg_render_obj_t * obj, lv_draw_vector_dsc_t * dsc, const lv_matrix_t * matrix)
 {
     lv_matrix_t mtx;
     _setup_matrix(&mtx, dsc, obj);
@@ -1392,16 +1403,10 @@ static void _render_line(const lv_svg_render_obj_t * obj, lv_draw_vector_dsc_t *
         lv_matrix_multiply(&dsc->ctx->matrix, matrix);
     }
 
-    lv_svg_render_line_t * line = (lv_svg_render_line_t *)obj;
-    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
-    lv_fpoint_t sp = {line->x1, line->y1};
-    lv_vector_path_move_to(path, &sp);
-    lv_fpoint_t ep = {line->x2, line->y2};
-    lv_vector_path_line_to(path, &ep);
+    lv_svg_render_shape_t * shape = (lv_svg_render_shape_t *)obj;
 
     _copy_draw_dsc_from_ref(dsc, obj);
-    lv_draw_vector_dsc_add_path(dsc, path);
-    lv_vector_path_delete(path);
+    lv_draw_vector_dsc_add_path(dsc, shape->path);
 
     _restore_matrix(&mtx, dsc);
 }
@@ -1565,20 +1570,12 @@ static void _render_use(const lv_svg_render_obj_t * obj, lv_draw_vector_dsc_t *
     lv_matrix_identity(&mtx);
     lv_matrix_translate(&mtx, use->x, use->y);
 
-    lv_svg_render_obj_t * list = obj->head;
-    while(list) {
-        if(list->id) {
-            if(strcmp(use->xlink, list->id) == 0) {
-                if(list->clz->render) {
-                    _prepare_render(list, dsc);
-                    _special_render(obj, dsc);
-                    _copy_draw_dsc_from_ref(dsc, obj);
-                    list->clz->render(list, dsc, &mtx);
-                }
-                break;
-            }
-        }
-        list = list->next;
+    lv_svg_render_obj_t * target = use->target;
+    if(target && target->clz->render) {
+        _prepare_render(target, dsc);
+        _special_render(obj, dsc);
+        _copy_draw_dsc_from_ref(dsc, obj);
+        target->clz->render(target, dsc, &mtx);
     }
 
     _restore_matrix(&imtx, dsc);
@@ -1824,16 +1821,8 @@ static void _get_group_bounds(const lv_svg_render_obj_t * obj, lv_area_t * area)
 static void _get_use_bounds(const lv_svg_render_obj_t * obj, lv_area_t * area)
 {
     lv_svg_render_use_t * use = (lv_svg_render_use_t *)obj;
-
-    lv_svg_render_obj_t * list = obj->head;
-    while(list) {
-        if(list->id && strcmp(use->xlink, list->id) == 0) {
-            if(list->clz->get_bounds) {
-                list->clz->get_bounds(list, area);
-            }
-            break;
-        }
-        list = list->next;
+    if(use->target && use->target->clz->get_bounds) {
+        use->target->clz->get_bounds(use->target, area);
     }
 }
 
@@ -1875,9 +1864,20 @@ static void _get_obj_size(const struct _lv_svg_render_obj * obj, uint32_t * size
     }
 }
 
+static void _get_shape_path_size(const struct _lv_svg_render_obj * obj, uint32_t * size)
+{
+    lv_svg_render_shape_t * shape = (lv_svg_render_shape_t *)obj;
+    *size += sizeof(void *);
+    if(shape->path) {
+        *size += _calc_path_data_size(shape->path);
+        *size += sizeof(lv_vector_path_t);
+    }
+}
+
 static void _get_viewport_size(const struct _lv_svg_render_obj * obj, uint32_t * size)
 {
     _get_obj_size(obj, size);
+    _get_shape_path_size(obj, size);
     *size += sizeof(float) * 2;
     *size += sizeof(bool);
 }
@@ -1885,24 +1885,28 @@ static void _get_viewport_size(const struct _lv_svg_render_obj * obj, uint32_t *
 static void _get_rect_size(const struct _lv_svg_render_obj * obj, uint32_t * size)
 {
     _get_obj_size(obj, size);
+    _get_shape_path_size(obj, size);
     *size += sizeof(float) * 6;
 }
 
 static void _get_circle_size(const struct _lv_svg_render_obj * obj, uint32_t * size)
 {
     _get_obj_size(obj, size);
+    _get_shape_path_size(obj, size);
     *size += sizeof(float) * 3;
 }
 
 static void _get_ellipse_size(const struct _lv_svg_render_obj * obj, uint32_t * size)
 {
     _get_obj_size(obj, size);
+    _get_shape_path_size(obj, size);
     *size += sizeof(float) * 4;
 }
 
 static void _get_line_size(const struct _lv_svg_render_obj * obj, uint32_t * size)
 {
     _get_obj_size(obj, size);
+    _get_shape_path_size(obj, size);
     *size += sizeof(float) * 4;
 }
 
@@ -1926,7 +1930,7 @@ static void _get_use_size(const struct _lv_svg_render_obj * obj, uint32_t * size
         *size += lv_strlen(use->xlink);
     }
     *size += sizeof(float) * 2;
-    *size += sizeof(void *);
+    *size += sizeof(void *) * 2;
 
 }
 
@@ -2002,6 +2006,14 @@ static void _get_group_size(const struct _lv_svg_render_obj * obj, uint32_t * si
 }
 
 /* destroy functions */
+static void _destroy_shape(lv_svg_render_obj_t * obj)
+{
+    lv_svg_render_shape_t * shape = (lv_svg_render_shape_t *)obj;
+    if(shape->path) {
+        lv_vector_path_delete(shape->path);
+    }
+}
+
 static void _destroy_poly(lv_svg_render_obj_t * obj)
 {
     lv_svg_render_poly_t * poly = (lv_svg_render_poly_t *)obj;
@@ -2063,7 +2075,9 @@ static void _destroy_tspan(lv_svg_render_obj_t * obj)
 
 static lv_svg_render_class svg_viewport_class = {
     .init = _init_viewport,
+    .compile = _compile_viewport,
     .render = _render_viewport,
+    .destroy = _destroy_shape,
     .set_attr = _set_viewport_attr,
     .get_bounds = _get_viewport_bounds,
     .get_size = _get_viewport_size,
@@ -2071,7 +2085,9 @@ static lv_svg_render_class svg_viewport_class = {
 
 static lv_svg_render_class svg_rect_class = {
     .init = _init_obj,
-    .render = _render_rect,
+    .compile = _compile_rect,
+    .render = _render_shape,
+    .destroy = _destroy_shape,
     .set_attr = _set_rect_attr,
     .get_bounds = _get_rect_bounds,
     .get_size = _get_rect_size,
@@ -2079,7 +2095,9 @@ static lv_svg_render_class svg_rect_class = {
 
 static lv_svg_render_class svg_circle_class = {
     .init = _init_obj,
-    .render = _render_circle,
+    .compile = _compile_circle,
+    .render = _render_shape,
+    .destroy = _destroy_shape,
     .set_attr = _set_circle_attr,
     .get_bounds = _get_circle_bounds,
     .get_size = _get_circle_size,
@@ -2087,7 +2105,9 @@ static lv_svg_render_class svg_circle_class = {
 
 static lv_svg_render_class svg_ellipse_class = {
     .init = _init_obj,
-    .render = _render_ellipse,
+    .compile = _compile_ellipse,
+    .render = _render_shape,
+    .destroy = _destroy_shape,
     .set_attr = _set_ellipse_attr,
     .get_bounds = _get_ellipse_bounds,
     .get_size = _get_ellipse_size,
@@ -2095,7 +2115,9 @@ static lv_svg_render_class svg_ellipse_class = {
 
 static lv_svg_render_class svg_line_class = {
     .init = _init_obj,
-    .render = _render_line,
+    .compile = _compile_line,
+    .render = _render_shape,
+    .destroy = _destroy_shape,
     .set_attr = _set_line_attr,
     .get_bounds = _get_line_bounds,
     .get_size = _get_line_size,
@@ -2162,6 +2184,7 @@ static lv_svg_render_class svg_image_class = {
 
 static lv_svg_render_class svg_use_class = {
     .init = _init_obj,
+    .compile = _compile_use,
     .set_attr = _set_use_attr,
     .render = _render_use,
     .destroy = _destroy_use,
@@ -2497,6 +2520,13 @@ lv_svg_render_obj_t * lv_svg_render_create(const lv_svg_node_t * svg_doc)
     lv_tree_walk(LV_TREE_NODE(svg_doc), LV_TREE_WALK_PRE_ORDER, _lv_svg_doc_walk_cb, _lv_svg_doc_walk_before_cb,
                  _lv_svg_doc_walk_after_cb, &state);
     _lv_svg_draw_dsc_delete(dsc);
+
+    /*Resolve the references and build the paths once so that rendering only emits them*/
+    lv_svg_render_obj_t * cur = state.list;
+    while(cur) {
+        _compile_obj(cur, state.list);
+        cur = cur->next;
+    }
     return state.list;
 }
 
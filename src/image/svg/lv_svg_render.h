@@ -41,6 +41,9 @@ typedef struct _lv_svg_render_obj {
     struct _lv_svg_render_obj * head;
     char * fill_ref;
     char * stroke_ref;
+    /* the resolved targets of `fill_ref` and `stroke_ref` */
+    struct _lv_svg_render_obj * fill_ref_obj;
+    struct _lv_svg_render_obj * stroke_ref_obj;
     struct _lv_svg_render_class * clz;
 } lv_svg_render_obj_t;
 
@@ -49,6 +52,8 @@ typedef struct _lv_svg_render_class {
                           const struct _lv_svg_render_obj * target_obj, bool fill);
 
     void (*init)(struct _lv_svg_render_obj * obj, const lv_svg_node_t * node);
+    /* called once when the whole list is created to build everything the rendering needs */
+    void (*compile)(struct _lv_svg_render_obj * obj, const struct _lv_svg_render_obj * list);
     void (*render)(const struct _lv_svg_render_obj * obj, lv_draw_vector_dsc_t * dsc, const lv_matrix_t * matrix);
     void (*set_attr)(struct _lv_svg_render_obj * obj, lv_vector_path_ctx_t * dsc, const lv_svg_attr_t * attr);
     void (*get_bounds)(const struct _lv_svg_render_obj * obj, lv_area_t * area);
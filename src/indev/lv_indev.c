@@ -48,6 +48,9 @@
 /**< Rotary diff count will be multiplied by this and divided by 256 */
 #define LV_INDEV_DEF_ROTARY_SENSITIVITY         256
 
+/*Only the movements in this time window [ms] are used to estimate the velocity*/
+#define LV_INDEV_VELOCITY_WINDOW          100
+
 #if LV_INDEV_DEF_SCROLL_THROW <= 0
     #warning "LV_INDEV_DEF_SCROLL_THROW must be greater than 0"
 #endif
@@ -77,6 +80,11 @@ static void indev_click_focus(lv_indev_t * indev);
 static void indev_gesture(lv_indev_t * indev);
 static bool indev_reset_check(lv_indev_t * indev);
 static void indev_read_core(lv_indev_t * indev, lv_indev_data_t * data);
+static void indev_proc_data(lv_indev_t * indev, lv_indev_data_t * data);
+static void indev_proc_samples(lv_indev_t * indev);
+static bool indev_sample_mergeable(const lv_indev_t * indev, const lv_indev_data_t * sample,
+                                   const lv_indev_data_t * next);
+static void indev_vect_hist_add(lv_indev_t * indev, const lv_point_t * vect, uint32_t timestamp);
 static void indev_reset_core(lv_indev_t * indev, lv_obj_t * obj);
 static lv_result_t send_event(lv_event_code_t code, void * param);
 
@@ -162,6 +170,10 @@ void lv_indev_delete(lv_indev_t * indev)
 
     /*Clean up the read timer first*/
     if(indev->read_timer) lv_timer_delete(indev->read_timer);
+    if(indev->sample_buf) lv_circle_buf_destroy(indev->sample_buf);
+
+    /*The scroll throw animation's callbacks would write into the freed indev*/
+    if(indev->scroll_throw_anim) lv_anim_delete(indev, indev_scroll_throw_anim_cb);
 
     /*Remove the input device from the list*/
     lv_ll_remove(indev_ll_head, indev);
@@ -250,35 +262,13 @@ void lv_indev_read(lv_indev_t * indev)
         indev_read_core(indev, &data);
         continue_reading = indev->mode != LV_INDEV_MODE_EVENT && data.continue_reading;
 
-        /*The active object might be deleted even in the read function*/
-        indev_proc_reset_query_handler(indev);
-        indev_obj_act = NULL;
-
-        indev->state = data.state;
-
-        /*Save the last activity time*/
-        indev->timestamp = data.timestamp;
-        if(indev->state == LV_INDEV_STATE_PRESSED) {
-            indev->disp->last_activity_time = data.timestamp;
-        }
-        else if(indev->type == LV_INDEV_TYPE_ENCODER && data.enc_diff) {
-            indev->disp->last_activity_time = data.timestamp;
+        /*If the driver pushed samples they replace the read data*/
+        if(indev->sample_buf && !lv_circle_buf_is_empty(indev->sample_buf)) {
+            indev_proc_samples(indev);
         }
-
-        if(indev->type == LV_INDEV_TYPE_POINTER) {
-            indev_pointer_proc(indev, &data);
-        }
-        else if(indev->type == LV_INDEV_TYPE_KEYPAD) {
-            indev_keypad_proc(indev, &data);
-        }
-        else if(indev->type == LV_INDEV_TYPE_ENCODER) {
-            indev_encoder_proc(indev, &data);
-        }
-        else if(indev->type == LV_INDEV_TYPE_BUTTON) {
-            indev_button_proc(indev, &data);
+        else {
+            indev_proc_data(indev, &data);
         }
-        /*Handle reset query if it happened in during processing*/
-        indev_proc_reset_query_handler(indev);
     } while(continue_reading);
 
     /*End of indev processing, so no act indev*/
@@ -289,6 +279,41 @@ void lv_indev_read(lv_indev_t * indev)
     LV_PROFILER_INDEV_END;
 }
 
+lv_result_t lv_indev_set_sample_buffer_size(lv_indev_t * indev, uint32_t cnt)
+{
+    LV_ASSERT_NULL(indev);
+
+    if(indev->sample_buf) {
+        lv_circle_buf_destroy(indev->sample_buf);
+        indev->sample_buf = NULL;
+    }
+
+    if(cnt == 0) return LV_RESULT_OK;
+
+    indev->sample_buf = lv_circle_buf_create(cnt, sizeof(lv_indev_data_t));
+    LV_ASSERT_MALLOC(indev->sample_buf);
+    return indev->sample_buf ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+lv_result_t lv_indev_push_sample(lv_indev_t * indev, const lv_indev_data_t * data)
+{
+    LV_ASSERT_NULL(indev);
+    LV_ASSERT_NULL(data);
+
+    if(indev->sample_buf == NULL) return LV_RESULT_INVALID;
+
+    lv_indev_data_t sample = *data;
+    if(sample.timestamp == 0) sample.timestamp = lv_tick_get();
+    sample.continue_reading = false;
+
+    if(lv_circle_buf_is_full(indev->sample_buf)) {
+        LV_LOG_WARN("sample buffer is full, dropping the oldest sample");
+        lv_circle_buf_skip(indev->sample_buf);
+    }
+
+    return lv_circle_buf_write(indev->sample_buf, &sample);
+}
+
 void lv_indev_enable(lv_indev_t * indev, bool enable)
 {
     if(indev) {
@@ -567,6 +592,40 @@ void lv_indev_get_vect(const lv_indev_t * indev, lv_point_t * point)
     }
 }
 
+void lv_indev_get_velocity(const lv_indev_t * indev, lv_point_t * velocity)
+{
+    velocity->x = 0;
+    velocity->y = 0;
+
+    if(indev == NULL) return;
+    if(indev->type != LV_INDEV_TYPE_POINTER && indev->type != LV_INDEV_TYPE_BUTTON) return;
+
+    /*Sum the latest movements in the time window. They started at the time of the movement preceding them.*/
+    const uint32_t * ts = indev->pointer.vect_hist_timestamp;
+    uint32_t newest = (indev->pointer.vect_hist_index + LV_INDEV_VECT_HIST_SIZE - 1) % LV_INDEV_VECT_HIST_SIZE;
+    uint32_t end = ts[newest];
+    if(lv_tick_elaps(end) > LV_INDEV_VELOCITY_WINDOW) return;   /*Not moved recently*/
+
+    uint32_t start = end;
+    int32_t sum_x = 0;
+    int32_t sum_y = 0;
+    for(uint32_t k = 0; k < LV_INDEV_VECT_HIST_SIZE - 1; k++) {
+        uint32_t i = (newest + LV_INDEV_VECT_HIST_SIZE - k) % LV_INDEV_VECT_HIST_SIZE;
+        uint32_t prev = (i + LV_INDEV_VECT_HIST_SIZE - 1) % LV_INDEV_VECT_HIST_SIZE;
+        if(lv_tick_diff(end, ts[prev]) > LV_INDEV_VELOCITY_WINDOW) break;
+
+        sum_x += indev->pointer.vect_hist[i].x;
+        sum_y += indev->pointer.vect_hist[i].y;
+        start = ts[prev];
+    }
+
+    uint32_t elaps = lv_tick_diff(end, start);
+    if(elaps == 0) return;
+
+    velocity->x = sum_x * 1000 / (int32_t)elaps;
+    velocity->y = sum_y * 1000 / (int32_t)elaps;
+}
+
 lv_obj_t * lv_indev_get_cursor(lv_indev_t * indev)
 {
     if(indev == NULL) return NULL;
@@ -1239,6 +1298,141 @@ static void indev_button_proc(lv_indev_t * i, lv_indev_data_t * data)
     i->pointer.last_point.y = i->pointer.act_point.y;
 }
 
+/**
+ * Process the data of a read or of a sample
+ * @param indev pointer to an input device
+ * @param data  the data to process
+ */
+static void indev_proc_data(lv_indev_t * indev, lv_indev_data_t * data)
+{
+    /*The active object might be deleted even in the read function*/
+    indev_proc_reset_query_handler(indev);
+    indev_obj_act = NULL;
+
+    indev->state = data->state;
+
+    /*Save the last activity time*/
+    indev->timestamp = data->timestamp;
+    if(indev->state == LV_INDEV_STATE_PRESSED) {
+        indev->disp->last_activity_time = data->timestamp;
+    }
+    else if(indev->type == LV_INDEV_TYPE_ENCODER && data->enc_diff) {
+        indev->disp->last_activity_time = data->timestamp;
+    }
+
+    if(indev->type == LV_INDEV_TYPE_POINTER) {
+        indev_pointer_proc(indev, data);
+    }
+    else if(indev->type == LV_INDEV_TYPE_KEYPAD) {
+        indev_keypad_proc(indev, data);
+    }
+    else if(indev->type == LV_INDEV_TYPE_ENCODER) {
+        indev_encoder_proc(indev, data);
+    }
+    else if(indev->type == LV_INDEV_TYPE_BUTTON) {
+        indev_button_proc(indev, data);
+    }
+    /*Handle reset query if it happened in during processing*/
+    indev_proc_reset_query_handler(indev);
+}
+
+/**
+ * Process the buffered samples. Samples which only move the pointer (or add encoder steps)
+ * are merged into the next sample, so only state changes and the last position are processed.
+ * The movements of the merged samples are added to the vector history for the velocity.
+ * @param indev pointer to an input device with buffered samples
+ */
+static void indev_proc_samples(lv_indev_t * indev)
+{
+    lv_circle_buf_t * buf = indev->sample_buf;
+    lv_indev_data_t sample;
+    lv_indev_data_t next;
+    lv_point_t prev_point = indev->pointer.last_point;
+    lv_point_t coalesced = {0, 0};
+    int32_t enc_diff = 0;
+
+    while(lv_circle_buf_read(buf, &sample) == LV_RESULT_OK) {
+        enc_diff += sample.enc_diff;
+
+        if(!lv_circle_buf_is_empty(buf) && lv_circle_buf_peek(buf, &next) == LV_RESULT_OK &&
+           indev_sample_mergeable(indev, &sample, &next)) {
+            if(indev->type == LV_INDEV_TYPE_POINTER && sample.state == LV_INDEV_STATE_PRESSED) {
+                lv_point_t p = sample.point;
+                lv_display_rotate_point(indev->disp, &p);
+                lv_point_t v = {p.x - prev_point.x, p.y - prev_point.y};
+                indev_vect_hist_add(indev, &v, sample.timestamp);
+                coalesced.x += v.x;
+                coalesced.y += v.y;
+                prev_point = p;
+            }
+            continue;
+        }
+
+        sample.enc_diff = (int16_t)LV_CLAMP(INT16_MIN, enc_diff, INT16_MAX);
+        enc_diff = 0;
+
+        indev->pointer.coalesced_vect = coalesced;
+        indev_proc_data(indev, &sample);
+        indev->pointer.coalesced_vect.x = 0;
+        indev->pointer.coalesced_vect.y = 0;
+
+        coalesced.x = 0;
+        coalesced.y = 0;
+        prev_point = indev->pointer.last_point;
+
+        /*The indev might be disabled or reset while processing*/
+        if(indev->enabled == 0) {
+            lv_circle_buf_reset(buf);
+            break;
+        }
+    }
+}
+
+/**
+ * Check if a sample can be merged into the next one without losing a state change
+ * @param indev     pointer to an input device
+ * @param sample    the sample to merge
+ * @param next      the sample following it
+ * @return          true: only the movement of `sample` needs to be kept
+ */
+static bool indev_sample_mergeable(const lv_indev_t * indev, const lv_indev_data_t * sample,
+                                   const lv_indev_data_t * next)
+{
+    /*The first sample of a new state is always processed, e.g. where a press started*/
+    if(sample->state != indev->state || next->state != sample->state) return false;
+
+    switch(indev->type) {
+        case LV_INDEV_TYPE_KEYPAD:
+            /*Every key event is processed*/
+            return false;
+        case LV_INDEV_TYPE_BUTTON:
+            return sample->btn_id == next->btn_id;
+        case LV_INDEV_TYPE_ENCODER:
+            return sample->key == next->key;
+        default:
+            break;
+    }
+
+#if LV_USE_GESTURE_RECOGNITION
+    if(lv_memcmp(sample->gesture_type, next->gesture_type, sizeof(sample->gesture_type)) != 0) return false;
+#endif
+
+    return true;
+}
+
+/**
+ * Add a movement to the vector history used for scroll throw and velocity
+ * @param indev     pointer to an input device
+ * @param vect      the movement
+ * @param timestamp time of the movement
+ */
+static void indev_vect_hist_add(lv_indev_t * indev, const lv_point_t * vect, uint32_t timestamp)
+{
+    indev->pointer.vect_hist[indev->pointer.vect_hist_index] = *vect;
+    indev->pointer.vect_hist_timestamp[indev->pointer.vect_hist_index] = timestamp;
+    indev->pointer.vect_hist_index = (indev->pointer.vect_hist_index + 1) % LV_INDEV_VECT_HIST_SIZE;
+}
+
 /**
  * Apply time decay to a scroll throw vector, such that there is no decay
  * initially and full decay after a short period of time.
@@ -1298,6 +1492,8 @@ static void indev_proc_press(lv_indev_t * indev)
         if(indev->pointer.act_obj == NULL) {
             indev->pointer.last_point.x = indev->pointer.act_point.x;
             indev->pointer.last_point.y = indev->pointer.act_point.y;
+            indev->pointer.coalesced_vect.x = 0;
+            indev->pointer.coalesced_vect.y = 0;
         }
         indev->pointer.pressed = indev->prev_state == LV_INDEV_STATE_RELEASED;
 
@@ -1367,9 +1563,13 @@ static void indev_proc_press(lv_indev_t * indev)
     indev->pointer.vect.x = indev->pointer.act_point.x - indev->pointer.last_point.x;
     indev->pointer.vect.y = indev->pointer.act_point.y - indev->pointer.last_point.y;
 
-    indev->pointer.vect_hist[indev->pointer.vect_hist_index] = indev->pointer.vect;
-    indev->pointer.vect_hist_timestamp[indev->pointer.vect_hist_index] = indev->timestamp;
-    indev->pointer.vect_hist_index = (indev->pointer.vect_hist_index + 1) % LV_INDEV_VECT_HIST_SIZE;
+    /*The coalesced samples are already in the history with their own timestamps*/
+    lv_point_t hist_vect;
+    hist_vect.x = indev->pointer.vect.x - indev->pointer.coalesced_vect.x;
+    hist_vect.y = indev->pointer.vect.y - indev->pointer.coalesced_vect.y;
+    indev->pointer.coalesced_vect.x = 0;
+    indev->pointer.coalesced_vect.y = 0;
+    indev_vect_hist_add(indev, &hist_vect, indev->timestamp);
 
     indev->pointer.scroll_throw_vect.x = 0;
     indev->pointer.scroll_throw_vect.y = 0;
@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 #include "../lvgl_public.h"
 #include "lv_indev_scroll.h"
+#include "../misc/lv_circle_buf_private.h"
 
 /*********************
  *      DEFINES
@@ -95,6 +96,7 @@ struct _lv_indev_t {
         lv_point_t scroll_sum; /*Count the dragged pixels to check LV_INDEV_DEF_SCROLL_LIMIT*/
         lv_point_t scroll_throw_vect;
         lv_point_t scroll_throw_vect_ori;
+        lv_point_t coalesced_vect; /**< Part of `vect` already added to `vect_hist` from coalesced samples*/
         lv_obj_t * act_obj;      /*The object being pressed*/
         lv_obj_t * scroll_obj;   /*The object being scrolled*/
         lv_obj_t * last_pressed; /*The lastly pressed object*/
@@ -129,6 +131,9 @@ struct _lv_indev_t {
     /**< Key remapping callback */
     lv_indev_key_remap_cb_t key_remap_cb;
 
+    /**< Samples pushed with `lv_indev_push_sample()`, processed in the next read*/
+    lv_circle_buf_t * sample_buf;
+
 #if LV_USE_GESTURE_RECOGNITION
     lv_indev_gesture_recognizer_t recognizers[LV_INDEV_GESTURE_CNT];
     lv_indev_gesture_type_t cur_gesture;
@@ -91,6 +91,7 @@
 #include "draw/sw/lv_draw_sw_mask.h"
 #include "draw/sw/lv_draw_sw_mask_private.h"
 #include "draw/sw/lv_draw_sw_private.h"
+#include "draw/sw/lv_draw_sw_raster_private.h"
 #include "draw/vg_lite/lv_draw_vg_lite.h"
 #include "draw/vg_lite/lv_draw_vg_lite_type.h"
 #include "draw/vg_lite/lv_vg_lite_bitmap_font_cache.h"
@@ -146,8 +147,10 @@
 #include "image/svg/lv_svg_render.h"
 #include "image/svg/lv_svg_token.h"
 #include "misc/cache/class/lv_cache_class.h"
+#include "misc/cache/class/lv_cache_lru_ht.h"
 #include "misc/cache/class/lv_cache_lru_ll.h"
 #include "misc/cache/class/lv_cache_lru_rb.h"
+#include "misc/cache/class/lv_cache_lru_shard.h"
 #include "misc/cache/class/lv_cache_sc_da.h"
 #include "misc/cache/instance/lv_cache_instance.h"
 #include "misc/cache/instance/lv_image_cache.h"
@@ -158,6 +161,7 @@
 #include "misc/lv_anim_private.h"
 #include "misc/lv_anim_timeline_private.h"
 #include "misc/lv_area_private.h"
+#include "misc/lv_async_private.h"
 #include "misc/lv_bidi_private.h"
 #include "misc/lv_circle_buf_private.h"
 #include "misc/lv_event_private.h"
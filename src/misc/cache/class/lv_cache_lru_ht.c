@@ -0,0 +1,534 @@
+/**
+* @file lv_cache_lru_ht.c
+*
+*/
+
+/*****************************************************\
+*                                                     *
+*  ┏ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ┓    *
+*        hash_cb(key) & (slot_cnt - 1)                *
+*  ┃            │                               ┃    *
+*               ▼   linear probing                    *
+*  ┃   ┌──────┬──────┬──────┬──────┬──────┐     ┃    *
+*      │      │hash B│hash E│      │hash A│          *
+*  ┃   │      │  ──┐ │  ──┐ │      │  ──┐ │     ┃    *
+*      └──────┴────┼─┴────┼─┴──────┴────┼─┘          *
+*  ┃               │      │             │       ┃    *
+*                  ▼      ▼             ▼            *
+*  ┃   head ──▶ ┌─────┐┌─────┐       ┌─────┐   ┃    *
+*               │  B  ├┤  E  ├─ ... ─┤  A  │ tail    *
+*  ┃            └─────┘└─────┘       └─────┘   ┃    *
+*                 LRU ordered linked list            *
+*  ┃                                            ┃    *
+*   ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━      *
+*                                                     *
+\*****************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_cache_lru_ht.h"
+#include "../lv_cache_entry.h"
+#include "../../../lvgl_public.h"
+#include "../../lv_iter_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define SLOT_CNT_MIN    16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef uint32_t (get_data_size_cb_t)(const void * data);
+
+typedef struct {
+    uint32_t hash;
+    void * node;        /**< NULL if the slot is empty*/
+} lv_cache_lru_ht_slot_t;
+
+struct _lv_cache_lru_ht_t {
+    lv_cache_t cache;
+
+    lv_ll_t ll;
+
+    lv_cache_lru_ht_slot_t * slots;
+    uint32_t slot_cnt;  /**< Always 0 or a power of 2*/
+    uint32_t used_cnt;
+
+    get_data_size_cb_t * get_data_size_cb;
+};
+
+typedef struct _lv_cache_lru_ht_t lv_cache_lru_ht_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void * alloc_cb(void);
+static bool init_cnt_cb(lv_cache_t * cache);
+static bool init_size_cb(lv_cache_t * cache);
+static void  destroy_cb(lv_cache_t * cache, void * user_data);
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data);
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data);
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void drop_all_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data);
+
+static bool init_common(lv_cache_lru_ht_t * lru);
+static inline uint32_t * get_node_hash(lv_cache_lru_ht_t * lru, void * node);
+static void * find_node(lv_cache_lru_ht_t * lru, const void * key, uint32_t hash);
+static bool reserve_slot(lv_cache_lru_ht_t * lru);
+static void insert_slot(lv_cache_lru_ht_t * lru, void * node, uint32_t hash);
+static void remove_slot(lv_cache_lru_ht_t * lru, void * node);
+
+static uint32_t cnt_get_data_size_cb(const void * data);
+static uint32_t size_get_data_size_cb(const void * data);
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache);
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+const lv_cache_class_t lv_cache_class_lru_ht_count = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_cnt_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb,
+    .iter_create_cb = cache_iter_create_cb,
+};
+
+const lv_cache_class_t lv_cache_class_lru_ht_size = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_size_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb,
+    .iter_create_cb = cache_iter_create_cb,
+};
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void * alloc_cb(void)
+{
+    void * res = lv_malloc(sizeof(lv_cache_lru_ht_t));
+    LV_ASSERT_MALLOC(res);
+    if(res == NULL) {
+        LV_LOG_ERROR("malloc failed");
+        return NULL;
+    }
+
+    lv_memzero(res, sizeof(lv_cache_lru_ht_t));
+    return res;
+}
+
+static bool init_cnt_cb(lv_cache_t * cache)
+{
+    lv_cache_lru_ht_t * lru = (lv_cache_lru_ht_t *)cache;
+
+    if(!init_common(lru)) {
+        return false;
+    }
+
+    lru->get_data_size_cb = cnt_get_data_size_cb;
+
+    return true;
+}
+
+static bool init_size_cb(lv_cache_t * cache)
+{
+    lv_cache_lru_ht_t * lru = (lv_cache_lru_ht_t *)cache;
+
+    if(!init_common(lru)) {
+        return false;
+    }
+
+    lru->get_data_size_cb = size_get_data_size_cb;
+
+    return true;
+}
+
+static void destroy_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_cache_lru_ht_t * lru = (lv_cache_lru_ht_t *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    if(lru == NULL) {
+        return;
+    }
+
+    cache->clz->drop_all_cb(cache, user_data);
+
+    lv_free(lru->slots);
+    lru->slots = NULL;
+    lru->slot_cnt = 0;
+}
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_lru_ht_t * lru = (lv_cache_lru_ht_t *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(key);
+
+    if(lru == NULL || key == NULL) {
+        return NULL;
+    }
+
+    void * node = find_node(lru, key, cache->ops.hash_cb(key));
+
+    /*cache hit*/
+    if(node) {
+        void * head = lv_ll_get_head(&lru->ll);
+        if(node != head) lv_ll_move_before(&lru->ll, node, head);
+
+        return lv_cache_entry_get_entry(node, cache->node_size);
+    }
+    return NULL;
+}
+
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_lru_ht_t * lru = (lv_cache_lru_ht_t *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(key);
+
+    if(lru == NULL || key == NULL) {
+        return NULL;
+    }
+
+    /*Make room in the table first, so a failed allocation leaves the cache untouched*/
+    if(!reserve_slot(lru)) {
+        return NULL;
+    }
+
+    void * node = lv_ll_ins_head(&lru->ll);
+    if(node == NULL) {
+        return NULL;
+    }
+
+    lv_memcpy(node, key, cache->node_size);
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(node, cache->node_size);
+    lv_cache_entry_init(entry, cache, cache->node_size);
+
+    uint32_t hash = cache->ops.hash_cb(key);
+    *get_node_hash(lru, node) = hash;
+    insert_slot(lru, node, hash);
+
+    cache->size += lru->get_data_size_cb(key);
+
+    return entry;
+}
+
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_lru_ht_t * lru = (lv_cache_lru_ht_t *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(entry);
+
+    if(lru == NULL || entry == NULL) {
+        return;
+    }
+
+    void * node = lv_cache_entry_get_data(entry);
+
+    remove_slot(lru, node);
+    lv_ll_remove(&lru->ll, node);
+
+    cache->size -= lru->get_data_size_cb(node);
+}
+
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    lv_cache_lru_ht_t * lru = (lv_cache_lru_ht_t *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(key);
+
+    if(lru == NULL || key == NULL) {
+        return;
+    }
+
+    void * node = find_node(lru, key, cache->ops.hash_cb(key));
+    if(node == NULL) {
+        return;
+    }
+
+    remove_slot(lru, node);
+    lv_ll_remove(&lru->ll, node);
+
+    cache->ops.free_cb(node, user_data);
+    cache->size -= lru->get_data_size_cb(node);
+
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(node, cache->node_size);
+    lv_cache_entry_delete(entry);
+}
+
+static void drop_all_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_cache_lru_ht_t * lru = (lv_cache_lru_ht_t *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    if(lru == NULL) {
+        return;
+    }
+
+    uint32_t used_cnt = 0;
+    void * node;
+    LV_LL_READ(&lru->ll, node) {
+        /*free user handled data and do other clean up*/
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(node, cache->node_size);
+        if(lv_cache_entry_get_ref(entry) == 0) {
+            cache->ops.free_cb(node, user_data);
+        }
+        else {
+            LV_LOG_WARN("entry (%p) is still referenced (%" LV_PRId32 ")", (void *)entry, lv_cache_entry_get_ref(entry));
+            used_cnt++;
+        }
+    }
+    if(used_cnt > 0) {
+        LV_LOG_WARN("%" LV_PRId32 " entries are still referenced", used_cnt);
+    }
+
+    lv_ll_clear(&lru->ll);
+
+    if(lru->slots) lv_memzero(lru->slots, lru->slot_cnt * sizeof(lv_cache_lru_ht_slot_t));
+    lru->used_cnt = 0;
+
+    cache->size = 0;
+}
+
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_lru_ht_t * lru = (lv_cache_lru_ht_t *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    void * tail;
+    LV_LL_READ_BACK(&lru->ll, tail) {
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(tail, cache->node_size);
+        if(lv_cache_entry_get_ref(entry) == 0) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_lru_ht_t * lru = (lv_cache_lru_ht_t *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    if(lru == NULL) {
+        return LV_CACHE_RESERVE_COND_ERROR;
+    }
+
+    uint32_t data_size = key ? lru->get_data_size_cb(key) : 0;
+    if(data_size > cache->max_size) {
+        LV_LOG_ERROR("data size (%" LV_PRIu32 ") is larger than max size (%" LV_PRIu32 ")", data_size, cache->max_size);
+        return LV_CACHE_RESERVE_COND_TOO_LARGE;
+    }
+
+    return cache->size + reserved_size + data_size > cache->max_size
+           ? LV_CACHE_RESERVE_COND_NEED_VICTIM
+           : LV_CACHE_RESERVE_COND_OK;
+}
+
+static bool init_common(lv_cache_lru_ht_t * lru)
+{
+    LV_ASSERT_NULL(lru->cache.ops.compare_cb);
+    LV_ASSERT_NULL(lru->cache.ops.hash_cb);
+    LV_ASSERT_NULL(lru->cache.ops.free_cb);
+    LV_ASSERT(lru->cache.node_size > 0);
+
+    if(lru->cache.node_size <= 0 || lru->cache.ops.compare_cb == NULL || lru->cache.ops.hash_cb == NULL ||
+       lru->cache.ops.free_cb == NULL) {
+        return false;
+    }
+
+    /*The precomputed hash is stored right after the entry so it's not calculated again on removal*/
+    lv_ll_init(&lru->ll, lv_cache_entry_get_size(lru->cache.node_size) + sizeof(uint32_t));
+
+    return true;
+}
+
+static inline uint32_t * get_node_hash(lv_cache_lru_ht_t * lru, void * node)
+{
+    return (uint32_t *)((uint8_t *)node + lv_cache_entry_get_size(lru->cache.node_size));
+}
+
+static void * find_node(lv_cache_lru_ht_t * lru, const void * key, uint32_t hash)
+{
+    if(lru->used_cnt == 0) {
+        return NULL;
+    }
+
+    uint32_t mask = lru->slot_cnt - 1;
+    for(uint32_t i = hash & mask; lru->slots[i].node != NULL; i = (i + 1) & mask) {
+        /*Call the compare callback only if the hashes match*/
+        if(lru->slots[i].hash == hash && lru->cache.ops.compare_cb(lru->slots[i].node, key) == 0) {
+            return lru->slots[i].node;
+        }
+    }
+
+    return NULL;
+}
+
+static bool reserve_slot(lv_cache_lru_ht_t * lru)
+{
+    /*Keep the load factor below 3/4 so that the probe sequences stay short*/
+    if((lru->used_cnt + 1) * 4 <= lru->slot_cnt * 3) {
+        return true;
+    }
+
+    uint32_t new_slot_cnt = lru->slot_cnt ? lru->slot_cnt * 2 : SLOT_CNT_MIN;
+    lv_cache_lru_ht_slot_t * new_slots = lv_malloc_zeroed(new_slot_cnt * sizeof(lv_cache_lru_ht_slot_t));
+    LV_ASSERT_MALLOC(new_slots);
+    if(new_slots == NULL) {
+        LV_LOG_ERROR("malloc failed");
+        return false;
+    }
+
+    lv_cache_lru_ht_slot_t * old_slots = lru->slots;
+    uint32_t old_slot_cnt = lru->slot_cnt;
+
+    lru->slots = new_slots;
+    lru->slot_cnt = new_slot_cnt;
+    lru->used_cnt = 0;
+
+    for(uint32_t i = 0; i < old_slot_cnt; i++) {
+        if(old_slots[i].node) insert_slot(lru, old_slots[i].node, old_slots[i].hash);
+    }
+
+    lv_free(old_slots);
+
+    return true;
+}
+
+static void insert_slot(lv_cache_lru_ht_t * lru, void * node, uint32_t hash)
+{
+    uint32_t mask = lru->slot_cnt - 1;
+    uint32_t i = hash & mask;
+    while(lru->slots[i].node != NULL) i = (i + 1) & mask;
+
+    lru->slots[i].hash = hash;
+    lru->slots[i].node = node;
+    lru->used_cnt++;
+}
+
+static void remove_slot(lv_cache_lru_ht_t * lru, void * node)
+{
+    uint32_t mask = lru->slot_cnt - 1;
+    uint32_t i = *get_node_hash(lru, node) & mask;
+    while(lru->slots[i].node != node) {
+        LV_ASSERT_NULL(lru->slots[i].node);
+        i = (i + 1) & mask;
+    }
+
+    /*Backward shift deletion: move the following slots of the probe sequence
+     *into the hole so lookups never need tombstones*/
+    uint32_t j = i;
+    while(1) {
+        j = (j + 1) & mask;
+        if(lru->slots[j].node == NULL) break;
+
+        uint32_t home = lru->slots[j].hash & mask;
+        /*Move the slot only if its home position is not between the hole and itself (cyclically)*/
+        bool movable = i <= j ? (home <= i || home > j) : (home <= i && home > j);
+        if(movable) {
+            lru->slots[i] = lru->slots[j];
+            i = j;
+        }
+    }
+
+    lru->slots[i].node = NULL;
+    lru->used_cnt--;
+}
+
+static uint32_t cnt_get_data_size_cb(const void * data)
+{
+    LV_UNUSED(data);
+    return 1;
+}
+
+static uint32_t size_get_data_size_cb(const void * data)
+{
+    lv_cache_slot_size_t * slot = (lv_cache_slot_size_t *)data;
+    return slot->size;
+}
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache)
+{
+    return lv_iter_create(cache, lv_cache_entry_get_size(cache->node_size), sizeof(void *), cache_iter_next_cb);
+}
+
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem)
+{
+    lv_cache_lru_ht_t * lru = (lv_cache_lru_ht_t *)instance;
+    void ** ll_node = context;
+
+    LV_ASSERT_NULL(ll_node);
+
+    if(*ll_node == NULL) *ll_node = lv_ll_get_head(&lru->ll);
+    else *ll_node = lv_ll_get_next(&lru->ll, *ll_node);
+
+    void * node = *ll_node;
+
+    if(node == NULL) return LV_RESULT_INVALID;
+
+    lv_memcpy(elem, node, lv_cache_entry_get_size(lru->cache.node_size));
+
+    return LV_RESULT_OK;
+}
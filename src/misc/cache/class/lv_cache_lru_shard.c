@@ -0,0 +1,256 @@
+/**
+* @file lv_cache_lru_shard.c
+*
+*/
+
+/*************************************************\
+*                                                 *
+*  ┏ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ┓    *
+*         hash_cb(key) % LV_CACHE_SHARD_CNT       *
+*  ┃        │          │          │         ┃    *
+*           ▼          ▼          ▼               *
+*  ┃   ┌─────────┐┌─────────┐┌─────────┐    ┃    *
+*      │ lock 0  ││ lock 1  ││ lock N  │         *
+*  ┃   ├─────────┤├─────────┤├─────────┤    ┃    *
+*      │ LRU RB  ││ LRU RB  ││ LRU RB  │         *
+*  ┃   │ shard 0 ││ shard 1 ││ shard N │    ┃    *
+*      └─────────┘└─────────┘└─────────┘         *
+*  ┃                                        ┃    *
+*   ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━      *
+*                                                 *
+\*************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_cache_lru_shard.h"
+#include "lv_cache_lru_rb.h"
+#include "../lv_cache_entry.h"
+#include "../../../lvgl_public.h"
+#include "../../lv_iter_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_cache_t cache;
+
+    lv_cache_t ** shards;
+    uint32_t shard_cnt;
+} lv_cache_lru_shard_t;
+
+typedef struct {
+    uint32_t shard_index;
+    lv_iter_t * shard_iter;
+} shard_iter_context_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void * alloc_cb(void);
+static bool init_cnt_cb(lv_cache_t * cache);
+static bool init_size_cb(lv_cache_t * cache);
+static void destroy_cb(lv_cache_t * cache, void * user_data);
+static void drop_all_cb(lv_cache_t * cache, void * user_data);
+
+static lv_cache_t * get_shard_cb(lv_cache_t * cache, const void * key);
+static lv_cache_t * get_shard_at_cb(lv_cache_t * cache, uint32_t index);
+
+static bool init_shards(lv_cache_lru_shard_t * sh, const lv_cache_class_t * shard_class);
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache);
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+/*The keyed operations are forwarded by lv_cache.c to the shard owning the key,
+ *so only the callbacks affecting the whole cache are needed here*/
+const lv_cache_class_t lv_cache_class_lru_shard_count = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_cnt_cb,
+    .destroy_cb = destroy_cb,
+
+    .drop_all_cb = drop_all_cb,
+    .iter_create_cb = cache_iter_create_cb,
+
+    .get_shard_cb = get_shard_cb,
+    .get_shard_at_cb = get_shard_at_cb,
+};
+
+const lv_cache_class_t lv_cache_class_lru_shard_size = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_size_cb,
+    .destroy_cb = destroy_cb,
+
+    .drop_all_cb = drop_all_cb,
+    .iter_create_cb = cache_iter_create_cb,
+
+    .get_shard_cb = get_shard_cb,
+    .get_shard_at_cb = get_shard_at_cb,
+};
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void * alloc_cb(void)
+{
+    void * res = lv_malloc_zeroed(sizeof(lv_cache_lru_shard_t));
+    LV_ASSERT_MALLOC(res);
+    if(res == NULL) {
+        LV_LOG_ERROR("malloc failed");
+        return NULL;
+    }
+
+    return res;
+}
+
+static bool init_cnt_cb(lv_cache_t * cache)
+{
+    return init_shards((lv_cache_lru_shard_t *)cache, &lv_cache_class_lru_rb_count);
+}
+
+static bool init_size_cb(lv_cache_t * cache)
+{
+    return init_shards((lv_cache_lru_shard_t *)cache, &lv_cache_class_lru_rb_size);
+}
+
+static bool init_shards(lv_cache_lru_shard_t * sh, const lv_cache_class_t * shard_class)
+{
+    LV_ASSERT_NULL(sh->cache.ops.compare_cb);
+    LV_ASSERT_NULL(sh->cache.ops.free_cb);
+    LV_ASSERT(sh->cache.node_size > 0);
+
+    if(sh->cache.node_size <= 0 || sh->cache.ops.compare_cb == NULL || sh->cache.ops.free_cb == NULL) {
+        return false;
+    }
+
+    sh->shard_cnt = LV_CACHE_SHARD_CNT;
+    if(sh->cache.ops.hash_cb == NULL) {
+        LV_LOG_WARN("No hash_cb is set, using a single shard");
+        sh->shard_cnt = 1;
+    }
+
+    sh->shards = lv_malloc_zeroed(sizeof(lv_cache_t *) * sh->shard_cnt);
+    LV_ASSERT_MALLOC(sh->shards);
+    if(sh->shards == NULL) {
+        return false;
+    }
+
+    /*The maximum size is split among the shards by lv_cache_create()*/
+    for(uint32_t i = 0; i < sh->shard_cnt; i++) {
+        sh->shards[i] = lv_cache_create(shard_class, sh->cache.node_size, 0, sh->cache.ops);
+        if(sh->shards[i] == NULL) {
+            for(uint32_t j = 0; j < i; j++) {
+                lv_cache_destroy(sh->shards[j], NULL);
+            }
+            lv_free(sh->shards);
+            sh->shards = NULL;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void destroy_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_cache_lru_shard_t * sh = (lv_cache_lru_shard_t *)cache;
+
+    LV_ASSERT_NULL(sh);
+
+    if(sh == NULL || sh->shards == NULL) {
+        return;
+    }
+
+    for(uint32_t i = 0; i < sh->shard_cnt; i++) {
+        lv_cache_destroy(sh->shards[i], user_data);
+    }
+
+    lv_free(sh->shards);
+    sh->shards = NULL;
+    sh->shard_cnt = 0;
+}
+
+static void drop_all_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_cache_lru_shard_t * sh = (lv_cache_lru_shard_t *)cache;
+
+    LV_ASSERT_NULL(sh);
+
+    for(uint32_t i = 0; i < sh->shard_cnt; i++) {
+        lv_cache_drop_all(sh->shards[i], user_data);
+    }
+}
+
+static lv_cache_t * get_shard_cb(lv_cache_t * cache, const void * key)
+{
+    lv_cache_lru_shard_t * sh = (lv_cache_lru_shard_t *)cache;
+
+    if(sh->shard_cnt == 1) {
+        return sh->shards[0];
+    }
+
+    return sh->shards[cache->ops.hash_cb(key) % sh->shard_cnt];
+}
+
+static lv_cache_t * get_shard_at_cb(lv_cache_t * cache, uint32_t index)
+{
+    lv_cache_lru_shard_t * sh = (lv_cache_lru_shard_t *)cache;
+
+    return index < sh->shard_cnt ? sh->shards[index] : NULL;
+}
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache)
+{
+    return lv_iter_create(cache, lv_cache_entry_get_size(cache->node_size), sizeof(shard_iter_context_t),
+                          cache_iter_next_cb);
+}
+
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem)
+{
+    lv_cache_lru_shard_t * sh = (lv_cache_lru_shard_t *)instance;
+    shard_iter_context_t * ctx = context;
+
+    LV_ASSERT_NULL(ctx);
+
+    /*Walk the shards one after the other. The iterator of a shard is released as soon as it's exhausted,
+     *so the cache has to be iterated until the end (e.g. with lv_iter_inspect())*/
+    while(ctx->shard_index < sh->shard_cnt) {
+        if(ctx->shard_iter == NULL) {
+            ctx->shard_iter = lv_cache_iter_create(sh->shards[ctx->shard_index]);
+            if(ctx->shard_iter == NULL) return LV_RESULT_INVALID;
+        }
+
+        if(lv_iter_next(ctx->shard_iter, elem) == LV_RESULT_OK) {
+            return LV_RESULT_OK;
+        }
+
+        lv_iter_destroy(ctx->shard_iter);
+        ctx->shard_iter = NULL;
+        ctx->shard_index++;
+    }
+
+    return LV_RESULT_INVALID;
+}
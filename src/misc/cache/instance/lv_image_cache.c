@@ -19,6 +19,12 @@
  *      DEFINES
  *********************/
 
+#if LV_IMAGE_CACHE_USE_HASH_TABLE
+    #define IMAGE_CACHE_CLASS lv_cache_class_lru_ht_size
+#else
+    #define IMAGE_CACHE_CLASS lv_cache_class_lru_rb_size
+#endif
+
 #define CACHE_NAME  "IMAGE"
 
 #define img_cache_p (LV_GLOBAL_DEFAULT()->img_cache)
@@ -34,6 +40,7 @@
 
 static lv_cache_compare_res_t image_cache_compare_cb(const lv_image_cache_data_t * lhs,
                                                      const lv_image_cache_data_t * rhs);
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * data);
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data);
 static void iter_inspect_cb(void * elem);
 
@@ -59,9 +66,10 @@ lv_result_t lv_image_cache_init(uint32_t size)
         return LV_RESULT_OK;
     }
 
-    img_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    img_cache_p = lv_cache_create(&IMAGE_CACHE_CLASS,
     sizeof(lv_image_cache_data_t), size, (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t) image_cache_compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t) image_cache_hash_cb,
         .create_cb = NULL,
         .free_cb = (lv_cache_free_cb_t) image_cache_free_cb,
     });
@@ -144,6 +152,19 @@ inline static lv_cache_compare_res_t image_cache_common_compare(const void * lhs
     return lhs_src_type > rhs_src_type ? 1 : -1;
 }
 
+inline static uint32_t image_cache_common_hash(const void * src, lv_image_src_t src_type)
+{
+    /*Must be consistent with `image_cache_common_compare`*/
+    uint32_t hash = lv_cache_hash_data(&src_type, sizeof(src_type), LV_CACHE_HASH_SEED);
+    if(src_type == LV_IMAGE_SRC_FILE) {
+        hash = lv_cache_hash_str(src, hash);
+    }
+    else if(src_type == LV_IMAGE_SRC_VARIABLE) {
+        hash = lv_cache_hash_data(&src, sizeof(src), hash);
+    }
+    return hash;
+}
+
 static lv_cache_compare_res_t image_cache_compare_cb(
     const lv_image_cache_data_t * lhs,
     const lv_image_cache_data_t * rhs)
@@ -151,6 +172,11 @@ static lv_cache_compare_res_t image_cache_compare_cb(
     return image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
 }
 
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * data)
+{
+    return image_cache_common_hash(data->src, data->src_type);
+}
+
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data)
 {
     LV_UNUSED(user_data);
@@ -18,6 +18,12 @@
  *      DEFINES
  *********************/
 
+#if LV_IMAGE_CACHE_USE_HASH_TABLE
+    #define IMAGE_HEADER_CACHE_CLASS lv_cache_class_lru_ht_count
+#else
+    #define IMAGE_HEADER_CACHE_CLASS lv_cache_class_lru_rb_count
+#endif
+
 #define CACHE_NAME  "IMAGE_HEADER"
 
 #define img_header_cache_p (LV_GLOBAL_DEFAULT()->img_header_cache)
@@ -32,6 +38,7 @@
 
 static lv_cache_compare_res_t image_header_cache_compare_cb(const lv_image_header_cache_data_t * lhs,
                                                             const lv_image_header_cache_data_t * rhs);
+static uint32_t image_header_cache_hash_cb(const lv_image_header_cache_data_t * data);
 static void image_header_cache_free_cb(lv_image_header_cache_data_t * entry, void * user_data);
 static void iter_inspect_cb(void * elem);
 
@@ -57,9 +64,10 @@ lv_result_t lv_image_header_cache_init(uint32_t count)
         return LV_RESULT_OK;
     }
 
-    img_header_cache_p = lv_cache_create(&lv_cache_class_lru_rb_count,
+    img_header_cache_p = lv_cache_create(&IMAGE_HEADER_CACHE_CLASS,
     sizeof(lv_image_header_cache_data_t), count, (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t) image_header_cache_compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t) image_header_cache_hash_cb,
         .create_cb = NULL,
         .free_cb = (lv_cache_free_cb_t) image_header_cache_free_cb
     });
@@ -136,6 +144,19 @@ inline static lv_cache_compare_res_t image_cache_common_compare(const void * lhs
     return lhs_src_type > rhs_src_type ? 1 : -1;
 }
 
+inline static uint32_t image_cache_common_hash(const void * src, lv_image_src_t src_type)
+{
+    /*Must be consistent with `image_cache_common_compare`*/
+    uint32_t hash = lv_cache_hash_data(&src_type, sizeof(src_type), LV_CACHE_HASH_SEED);
+    if(src_type == LV_IMAGE_SRC_FILE) {
+        hash = lv_cache_hash_str(src, hash);
+    }
+    else if(src_type == LV_IMAGE_SRC_VARIABLE) {
+        hash = lv_cache_hash_data(&src, sizeof(src), hash);
+    }
+    return hash;
+}
+
 static lv_cache_compare_res_t image_header_cache_compare_cb(
     const lv_image_header_cache_data_t * lhs,
     const lv_image_header_cache_data_t * rhs)
@@ -143,6 +164,11 @@ static lv_cache_compare_res_t image_header_cache_compare_cb(
     return image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
 }
 
+static uint32_t image_header_cache_hash_cb(const lv_image_header_cache_data_t * data)
+{
+    return image_cache_common_hash(data->src, data->src_type);
+}
+
 static void image_header_cache_free_cb(lv_image_header_cache_data_t * entry, void * user_data)
 {
     LV_UNUSED(user_data); /*Unused*/
@@ -23,6 +23,7 @@
 static void cache_drop_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
 static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_data);
 static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
+static uint32_t cache_get_shard_cnt(lv_cache_t * cache);
 
 /**********************
  *  GLOBAL VARIABLES
@@ -61,6 +62,11 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
 
     lv_mutex_init(&cache->lock);
 
+    if(cache->clz->get_shard_at_cb) {
+        /*Let the sub-caches share the maximum size*/
+        lv_cache_set_max_size(cache, max_size, NULL);
+    }
+
     return cache;
 }
 
@@ -80,6 +86,10 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    if(cache->clz->get_shard_cb) {
+        return lv_cache_acquire(cache->clz->get_shard_cb(cache, key), key, user_data);
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -104,6 +114,12 @@ void lv_cache_release(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_
 {
     LV_ASSERT_NULL(entry);
 
+    if(cache->clz->get_shard_cb) {
+        /*The entry belongs to the sub-cache which has created it*/
+        lv_cache_release((lv_cache_t *)lv_cache_entry_get_cache(entry), entry, user_data);
+        return;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -122,6 +138,10 @@ lv_cache_entry_t * lv_cache_add(lv_cache_t * cache, const void * key, void * use
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    if(cache->clz->get_shard_cb) {
+        return lv_cache_add(cache->clz->get_shard_cb(cache, key), key, user_data);
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -146,6 +166,10 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    if(cache->clz->get_shard_cb) {
+        return lv_cache_acquire_or_create(cache->clz->get_shard_cb(cache, key), key, user_data);
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -195,6 +219,15 @@ void lv_cache_reserve(lv_cache_t * cache, uint32_t reserved_size, void * user_da
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->clz->get_shard_at_cb) {
+        uint32_t shard_cnt = cache_get_shard_cnt(cache);
+        uint32_t shard_reserved_size = (reserved_size + shard_cnt - 1) / shard_cnt;
+        for(uint32_t i = 0; i < shard_cnt; i++) {
+            lv_cache_reserve(cache->clz->get_shard_at_cb(cache, i), shard_reserved_size, user_data);
+        }
+        return;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     for(lv_cache_reserve_cond_res_t reserve_cond_res = cache->clz->reserve_cond_cb(cache, NULL, reserved_size, user_data);
@@ -209,6 +242,11 @@ void lv_cache_drop(lv_cache_t * cache, const void * key, void * user_data)
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    if(cache->clz->get_shard_cb) {
+        lv_cache_drop(cache->clz->get_shard_cb(cache, key), key, user_data);
+        return;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -221,6 +259,17 @@ bool lv_cache_evict_one(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->clz->get_shard_at_cb) {
+        /*Evict from the fullest sub-cache*/
+        lv_cache_t * victim_shard = NULL;
+        lv_cache_t * shard;
+        for(uint32_t i = 0; (shard = cache->clz->get_shard_at_cb(cache, i)) != NULL; i++) {
+            if(victim_shard == NULL || shard->size > victim_shard->size) victim_shard = shard;
+        }
+        if(victim_shard == NULL || victim_shard->size == 0) return false;
+        return lv_cache_evict_one(victim_shard, user_data);
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -245,8 +294,16 @@ void lv_cache_drop_all(lv_cache_t * cache, void * user_data)
 
 void lv_cache_set_max_size(lv_cache_t * cache, size_t max_size, void * user_data)
 {
-    LV_UNUSED(user_data);
     cache->max_size = max_size;
+
+    if(cache->clz->get_shard_at_cb) {
+        /*Split the maximum size evenly, the first sub-caches get the remainder*/
+        uint32_t shard_cnt = cache_get_shard_cnt(cache);
+        for(uint32_t i = 0; i < shard_cnt; i++) {
+            size_t shard_max_size = max_size / shard_cnt + (i < max_size % shard_cnt ? 1 : 0);
+            lv_cache_set_max_size(cache->clz->get_shard_at_cb(cache, i), shard_max_size, user_data);
+        }
+    }
 }
 size_t lv_cache_get_max_size(lv_cache_t * cache, void * user_data)
 {
@@ -255,13 +312,20 @@ size_t lv_cache_get_max_size(lv_cache_t * cache, void * user_data)
 }
 size_t lv_cache_get_size(lv_cache_t * cache, void * user_data)
 {
-    LV_UNUSED(user_data);
+    if(cache->clz->get_shard_at_cb) {
+        size_t size = 0;
+        lv_cache_t * shard;
+        for(uint32_t i = 0; (shard = cache->clz->get_shard_at_cb(cache, i)) != NULL; i++) {
+            size += lv_cache_get_size(shard, user_data);
+        }
+        return size;
+    }
+
     return cache->size;
 }
 size_t lv_cache_get_free_size(lv_cache_t * cache, void * user_data)
 {
-    LV_UNUSED(user_data);
-    return cache->max_size - cache->size;
+    return cache->max_size - lv_cache_get_size(cache, user_data);
 }
 bool lv_cache_is_enabled(lv_cache_t * cache)
 {
@@ -269,18 +333,36 @@ bool lv_cache_is_enabled(lv_cache_t * cache)
 }
 void lv_cache_set_compare_cb(lv_cache_t * cache, lv_cache_compare_cb_t compare_cb, void * user_data)
 {
-    LV_UNUSED(user_data);
     cache->ops.compare_cb = compare_cb;
+
+    if(cache->clz->get_shard_at_cb) {
+        lv_cache_t * shard;
+        for(uint32_t i = 0; (shard = cache->clz->get_shard_at_cb(cache, i)) != NULL; i++) {
+            lv_cache_set_compare_cb(shard, compare_cb, user_data);
+        }
+    }
 }
 void lv_cache_set_create_cb(lv_cache_t * cache, lv_cache_create_cb_t alloc_cb, void * user_data)
 {
-    LV_UNUSED(user_data);
     cache->ops.create_cb = alloc_cb;
+
+    if(cache->clz->get_shard_at_cb) {
+        lv_cache_t * shard;
+        for(uint32_t i = 0; (shard = cache->clz->get_shard_at_cb(cache, i)) != NULL; i++) {
+            lv_cache_set_create_cb(shard, alloc_cb, user_data);
+        }
+    }
 }
 void lv_cache_set_free_cb(lv_cache_t * cache, lv_cache_free_cb_t free_cb, void * user_data)
 {
-    LV_UNUSED(user_data);
     cache->ops.free_cb = free_cb;
+
+    if(cache->clz->get_shard_at_cb) {
+        lv_cache_t * shard;
+        for(uint32_t i = 0; (shard = cache->clz->get_shard_at_cb(cache, i)) != NULL; i++) {
+            lv_cache_set_free_cb(shard, free_cb, user_data);
+        }
+    }
 }
 void lv_cache_set_name(lv_cache_t * cache, const char * name)
 {
@@ -299,10 +381,38 @@ lv_iter_t * lv_cache_iter_create(lv_cache_t * cache)
     return cache->clz->iter_create_cb(cache);
 }
 
+uint32_t lv_cache_hash_data(const void * data, size_t len, uint32_t seed)
+{
+    const uint8_t * bytes = data;
+    uint32_t hash = seed;
+    for(size_t i = 0; i < len; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+uint32_t lv_cache_hash_str(const char * str, uint32_t seed)
+{
+    uint32_t hash = seed;
+    for(; *str != '\0'; str++) {
+        hash ^= (uint8_t) * str;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+static uint32_t cache_get_shard_cnt(lv_cache_t * cache)
+{
+    uint32_t cnt = 0;
+    while(cache->clz->get_shard_at_cb(cache, cnt) != NULL) cnt++;
+    return cnt;
+}
+
 static void cache_drop_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data)
 {
     lv_cache_entry_t * entry = cache->clz->get_cb(cache, key, user_data);
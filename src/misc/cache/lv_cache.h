@@ -22,6 +22,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Initial value for lv_cache_hash_data() and lv_cache_hash_str() (FNV-1a offset basis) */
+#define LV_CACHE_HASH_SEED 2166136261u
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -47,6 +50,7 @@ typedef int32_t lv_cache_compare_res_t;
 typedef bool (*lv_cache_create_cb_t)(void * node, void * user_data);
 typedef void (*lv_cache_free_cb_t)(void * node, void * user_data);
 typedef lv_cache_compare_res_t (*lv_cache_compare_cb_t)(const void * a, const void * b);
+typedef uint32_t (*lv_cache_hash_cb_t)(const void * key);
 
 /**
  * The cache instance allocation function, used by the cache class to allocate memory for cache instances.
@@ -112,6 +116,19 @@ typedef lv_cache_reserve_cond_res_t (*lv_cache_reserve_cond_cb)(lv_cache_t * cac
  */
 typedef lv_iter_t * (*lv_cache_iter_create_cb)(lv_cache_t * cache);
 
+/**
+ * The cache shard get function, used by partitioned cache classes to select the sub-cache owning a key.
+ * Every keyed operation (acquire, add, drop) is forwarded to the returned sub-cache, which is locked on its own.
+ * @return the sub-cache owning `key`
+ */
+typedef lv_cache_t * (*lv_cache_get_shard_cb)(lv_cache_t * cache, const void * key);
+
+/**
+ * The cache shard iteration function, used by partitioned cache classes to enumerate their sub-caches.
+ * @return the sub-cache at `index`, or `NULL` if `index` is out of range
+ */
+typedef lv_cache_t * (*lv_cache_get_shard_at_cb)(lv_cache_t * cache, uint32_t index);
+
 /**
  * The cache operations struct
  */
@@ -119,6 +136,8 @@ struct _lv_cache_ops_t {
     lv_cache_compare_cb_t compare_cb;    /**< Compare function for keys */
     lv_cache_create_cb_t create_cb;      /**< Create function for nodes */
     lv_cache_free_cb_t free_cb;          /**< Free function for nodes */
+    lv_cache_hash_cb_t hash_cb;          /**< Optional hash function for keys. Required by the hash based cache classes
+                                          *   and equal keys (`compare_cb` returns 0) must have equal hashes */
 };
 
 /**
@@ -162,6 +181,9 @@ struct _lv_cache_class_t {
     lv_cache_reserve_cond_cb reserve_cond_cb;     /**< The reserve condition function for cache entries */
 
     lv_cache_iter_create_cb iter_create_cb;       /**< The iterator creation function for cache entries */
+
+    lv_cache_get_shard_cb get_shard_cb;           /**< Optional. Set by partitioned classes whose sub-caches are locked separately */
+    lv_cache_get_shard_at_cb get_shard_at_cb;     /**< Optional. Must be set together with `get_shard_cb` */
 };
 
 /*-----------------
@@ -382,6 +404,24 @@ lv_iter_t * lv_cache_iter_create(lv_cache_t * cache);
  */
 const lv_cache_t * lv_cache_entry_get_cache(const lv_cache_entry_t * entry);
 
+/**
+ * Hash a block of memory. Can be used to implement `lv_cache_ops_t::hash_cb`.
+ * @param data         pointer to the data to hash
+ * @param len          length of the data in bytes
+ * @param seed         initial hash value, e.g. the result of a previous call to combine several fields,
+ *                     or `LV_CACHE_HASH_SEED` to start a new hash
+ * @return             the 32 bit FNV-1a hash of the data
+ */
+uint32_t lv_cache_hash_data(const void * data, size_t len, uint32_t seed);
+
+/**
+ * Hash a `\0` terminated string. Can be used to implement `lv_cache_ops_t::hash_cb`.
+ * @param str          the string to hash
+ * @param seed         initial hash value, see lv_cache_hash_data()
+ * @return             the 32 bit FNV-1a hash of the string
+ */
+uint32_t lv_cache_hash_str(const char * str, uint32_t seed);
+
 /**
  * Allocate a cache entry.
  * @param node_size    The size of the node in the cache.
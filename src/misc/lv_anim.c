@@ -35,6 +35,7 @@
  **********************/
 static void anim_timer(lv_timer_t * param);
 static void anim_vsync_event(lv_event_t * e);
+static bool anim_skip_frame(void);
 static void anim_mark_list_change(void);
 static void anim_completed_handler(lv_anim_t * a);
 static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1,
@@ -99,6 +100,12 @@ void lv_anim_enable_vsync_mode(bool enable)
     anim_mark_list_change();
 }
 
+void lv_anim_core_skip_frames(bool skip)
+{
+    state.skip_frames = skip;
+    if(!skip) state.frame_skipped = false;
+}
+
 void lv_anim_init(lv_anim_t * a)
 {
     LV_CHECK_ARG(a != NULL, return);
@@ -610,7 +617,8 @@ void lv_anim_set_external_data(lv_anim_t * anim, void * data, void (* free_cb)(v
  */
 static void anim_timer(lv_timer_t * param)
 {
-    LV_UNUSED(param);
+    /*Called by the animation timer, not by lv_anim_refr_now()*/
+    if(param && anim_skip_frame()) return;
 
     /*Flip the run round*/
     state.anim_run_round = state.anim_run_round ? false : true;
@@ -764,9 +772,18 @@ static void anim_completed_handler(lv_anim_t * a)
 static void anim_vsync_event(lv_event_t * e)
 {
     LV_UNUSED(e);
+    if(anim_skip_frame()) return;
     anim_timer(NULL);
 }
 
+static bool anim_skip_frame(void)
+{
+    if(!state.skip_frames) return false;
+
+    state.frame_skipped = !state.frame_skipped;
+    return state.frame_skipped;
+}
+
 static void anim_mark_list_change(void)
 {
     state.anim_list_changed = true;
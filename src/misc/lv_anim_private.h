@@ -28,6 +28,8 @@ typedef struct {
     bool anim_list_changed;
     bool anim_run_round;
     bool anim_vsync_registered;
+    bool skip_frames;
+    bool frame_skipped;
     lv_timer_t * timer;
     lv_ll_t anim_ll;
 } lv_anim_state_t;
@@ -52,6 +54,13 @@ void lv_anim_core_deinit(void);
  */
 void lv_anim_enable_vsync_mode(bool enable);
 
+/**
+ * Skip every second animation frame, used while a frame is over budget.
+ * The animations still progress with the elapsed time, they just get fewer steps.
+ * @param skip true: skip frames, false: run every frame
+ */
+void lv_anim_core_skip_frames(bool skip);
+
 /**********************
  *      MACROS
  **********************/
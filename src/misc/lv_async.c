@@ -9,11 +9,32 @@
 
 #include "../lvgl_public.h"
 #include "lv_timer_private.h"
+#include "lv_async_private.h"
+#include "../core/lv_global.h"
 
 /*********************
  *      DEFINES
  *********************/
 
+#if LV_ASYNC_QUEUE_SIZE > 0
+
+#if (LV_ASYNC_QUEUE_SIZE & (LV_ASYNC_QUEUE_SIZE - 1)) != 0
+    #error "LV_ASYNC_QUEUE_SIZE must be a power of 2"
+#endif
+
+#if !defined(__GNUC__) && !defined(__clang__) && !defined(_MSC_VER)
+    #error "LV_ASYNC_QUEUE_SIZE > 0 needs atomic operations, which are not implemented for this compiler"
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+#define state LV_GLOBAL_DEFAULT()->async_state
+#define QUEUE_MASK (LV_ASYNC_QUEUE_SIZE - 1)
+
+#endif /*LV_ASYNC_QUEUE_SIZE > 0*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -28,6 +49,16 @@ typedef struct _lv_async_info_t {
  **********************/
 
 static void lv_async_timer_cb(lv_timer_t * timer);
+#if LV_ASYNC_QUEUE_SIZE > 0
+    static lv_result_t queue_cancel(lv_async_cb_t async_xcb, void * user_data);
+    static inline uint32_t load_acquire(volatile uint32_t * p);
+    static inline void store_release(volatile uint32_t * p, uint32_t v);
+    static inline bool compare_exchange(volatile uint32_t * p, uint32_t expected, uint32_t desired);
+    static inline uint32_t exchange(volatile uint32_t * p, uint32_t v);
+    #if LV_USE_OBSERVER
+        static void subject_set_int_cb(void * subject);
+    #endif
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -88,9 +119,85 @@ lv_result_t lv_async_call_cancel(lv_async_cb_t async_xcb, void * user_data)
         timer = timer_next;
     }
 
+#if LV_ASYNC_QUEUE_SIZE > 0
+    if(queue_cancel(async_xcb, user_data) == LV_RESULT_OK) res = LV_RESULT_OK;
+#endif
+
     return res;
 }
 
+#if LV_ASYNC_QUEUE_SIZE > 0
+
+lv_result_t lv_async_post(lv_async_cb_t async_xcb, void * user_data)
+{
+    /*Reserve a slot. Fail instead of waiting if the queue is full,
+     *as the caller might be an interrupt*/
+    uint32_t tail;
+    do {
+        tail = load_acquire(&state.tail);
+        if(tail - load_acquire(&state.head) >= LV_ASYNC_QUEUE_SIZE) return LV_RESULT_INVALID;
+    } while(!compare_exchange(&state.tail, tail, tail + 1));
+
+    /*The slot is owned by this call until it's marked as ready*/
+    lv_async_queue_slot_t * slot = &state.slots[tail & QUEUE_MASK];
+    slot->cb = async_xcb;
+    slot->user_data = user_data;
+    store_release(&slot->ready, 1);
+
+    return LV_RESULT_OK;
+}
+
+#if LV_USE_OBSERVER
+lv_result_t lv_async_subject_set_int(lv_subject_t * subject, int32_t value)
+{
+    LV_CHECK_ARG(subject != NULL, return LV_RESULT_INVALID);
+
+    store_release((volatile uint32_t *)&subject->async_value, (uint32_t)value);
+
+    /*An update is already queued, it will set the latest value*/
+    if(exchange(&subject->async_pending, 1)) return LV_RESULT_OK;
+
+    if(lv_async_post(subject_set_int_cb, subject) != LV_RESULT_OK) {
+        store_release(&subject->async_pending, 0);
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+}
+#endif /*LV_USE_OBSERVER*/
+
+void lv_async_core_process_queue(void)
+{
+    /*Stop at the current end to not get stuck if the callbacks post again*/
+    uint32_t tail = load_acquire(&state.tail);
+    uint32_t head = state.head;
+
+    while(head != tail) {
+        lv_async_queue_slot_t * slot = &state.slots[head & QUEUE_MASK];
+        /*Reserved but not written yet. Keep the order and continue with it next time*/
+        if(!load_acquire(&slot->ready)) break;
+
+        lv_async_cb_t cb = slot->cb;
+        void * user_data = slot->user_data;
+        slot->ready = 0;
+        head++;
+        /*Release the slot before the call as the callback might post again*/
+        store_release(&state.head, head);
+
+        if(cb) cb(user_data);
+    }
+}
+
+#if LV_USE_OBSERVER
+void lv_async_core_cancel_subject(lv_subject_t * subject)
+{
+    queue_cancel(subject_set_int_cb, subject);
+    subject->async_pending = 0;
+}
+#endif /*LV_USE_OBSERVER*/
+
+#endif /*LV_ASYNC_QUEUE_SIZE > 0*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -105,3 +212,86 @@ static void lv_async_timer_cb(lv_timer_t * timer)
 
     info_save.cb(info_save.user_data);
 }
+
+#if LV_ASYNC_QUEUE_SIZE > 0
+
+/**
+ * Cancel the posted calls which are waiting in the queue.
+ * Slots which are still being written by a producer are not checked.
+ */
+static lv_result_t queue_cancel(lv_async_cb_t async_xcb, void * user_data)
+{
+    lv_result_t res = LV_RESULT_INVALID;
+    uint32_t tail = load_acquire(&state.tail);
+    uint32_t i;
+    for(i = state.head; i != tail; i++) {
+        lv_async_queue_slot_t * slot = &state.slots[i & QUEUE_MASK];
+        if(!load_acquire(&slot->ready)) continue;
+
+        if(slot->cb == async_xcb && slot->user_data == user_data) {
+            slot->cb = NULL;
+            res = LV_RESULT_OK;
+        }
+    }
+
+    return res;
+}
+
+#if LV_USE_OBSERVER
+static void subject_set_int_cb(void * s)
+{
+    lv_subject_t * subject = s;
+    /*Clear it first so that a new value set during the notification is queued again*/
+    exchange(&subject->async_pending, 0);
+    lv_subject_set_int(subject, (int32_t)load_acquire((volatile uint32_t *)&subject->async_value));
+}
+#endif /*LV_USE_OBSERVER*/
+
+#if defined(__GNUC__) || defined(__clang__)
+
+static inline uint32_t load_acquire(volatile uint32_t * p)
+{
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+static inline void store_release(volatile uint32_t * p, uint32_t v)
+{
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+
+static inline bool compare_exchange(volatile uint32_t * p, uint32_t expected, uint32_t desired)
+{
+    return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+static inline uint32_t exchange(volatile uint32_t * p, uint32_t v)
+{
+    return __atomic_exchange_n(p, v, __ATOMIC_ACQ_REL);
+}
+
+#else /*MSVC*/
+
+/*The Interlocked functions are full barriers. Volatile accesses have acquire/release semantics on MSVC*/
+static inline uint32_t load_acquire(volatile uint32_t * p)
+{
+    return *p;
+}
+
+static inline void store_release(volatile uint32_t * p, uint32_t v)
+{
+    _InterlockedExchange((volatile long *)p, (long)v);
+}
+
+static inline bool compare_exchange(volatile uint32_t * p, uint32_t expected, uint32_t desired)
+{
+    return (uint32_t)_InterlockedCompareExchange((volatile long *)p, (long)desired, (long)expected) == expected;
+}
+
+static inline uint32_t exchange(volatile uint32_t * p, uint32_t v)
+{
+    return (uint32_t)_InterlockedExchange((volatile long *)p, (long)v);
+}
+
+#endif
+
+#endif /*LV_ASYNC_QUEUE_SIZE > 0*/
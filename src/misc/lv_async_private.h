@@ -0,0 +1,74 @@
+/**
+ * @file lv_async_private.h
+ *
+ */
+
+#ifndef LV_ASYNC_PRIVATE_H
+#define LV_ASYNC_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lvgl_public.h"
+
+#if LV_ASYNC_QUEUE_SIZE > 0
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * A slot of the async queue
+ */
+typedef struct {
+    lv_async_cb_t cb;           /**< Function to call, NULL if the call was canceled */
+    void * user_data;           /**< Parameter of `cb` */
+    volatile uint32_t ready;    /**< 1: `cb` and `user_data` are written by the producer */
+} lv_async_queue_slot_t;
+
+typedef struct {
+    lv_async_queue_slot_t slots[LV_ASYNC_QUEUE_SIZE];
+    volatile uint32_t head;     /**< Index of the next call. Written only by lv_timer_handler() */
+    volatile uint32_t tail;     /**< Index of the next free slot. Reserved by the producers */
+} lv_async_state_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Call the functions posted with lv_async_post() until this function was called.
+ * Functions posted by these calls will run on the next call.
+ * Called by lv_timer_handler().
+ */
+void lv_async_core_process_queue(void);
+
+#if LV_USE_OBSERVER
+/**
+ * Drop the queued lv_async_subject_set_int() updates of a Subject.
+ * Called when the Subject is deinitialized.
+ * @param subject   pointer to a Subject
+ */
+void lv_async_core_cancel_subject(lv_subject_t * subject);
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_ASYNC_QUEUE_SIZE > 0*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_ASYNC_PRIVATE_H*/
@@ -85,6 +85,10 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
+#if LV_ASYNC_QUEUE_SIZE > 0
+    lv_async_core_process_queue();
+#endif
+
     /*Run all timer from the list*/
     lv_timer_t * next;
     lv_timer_t * timer_active;
@@ -172,6 +176,7 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
+    new_timer->low_priority = false;
 #if LV_USE_EXT_DATA
     new_timer->ext_data.free_cb = NULL;
     new_timer->ext_data.data = NULL;
@@ -245,6 +250,12 @@ void lv_timer_set_auto_delete(lv_timer_t * timer, bool auto_delete)
     timer->auto_delete = auto_delete;
 }
 
+void lv_timer_set_low_priority(lv_timer_t * timer, bool low_priority)
+{
+    LV_CHECK_ARG(timer != NULL, return);
+    timer->low_priority = low_priority;
+}
+
 void lv_timer_set_user_data(lv_timer_t * timer, void * user_data)
 {
     LV_CHECK_ARG(timer != NULL, return);
@@ -271,6 +282,11 @@ void lv_timer_core_deinit(void)
     lv_ll_clear(timer_ll_p);
 }
 
+void lv_timer_core_defer_low_priority(bool defer)
+{
+    state.low_priority_deferred = defer;
+}
+
 uint32_t lv_timer_get_idle(void)
 {
     return state.idle_last;
@@ -382,11 +398,14 @@ static bool lv_timer_exec(lv_timer_t * timer)
  */
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
 {
+    uint32_t period = timer->period;
+    if(timer->low_priority && state.low_priority_deferred && period <= UINT32_MAX / 2) period *= 2;
+
     /*Check if at least 'period' time elapsed*/
     uint32_t elp = lv_tick_elaps(timer->last_run);
-    if(elp >= timer->period)
+    if(elp >= period)
         return 0;
-    return timer->period - elp;
+    return period - elp;
 }
 
 /**
@@ -38,6 +38,7 @@ struct _lv_timer_t {
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
     volatile int paused;
     uint32_t auto_delete : 1;
+    uint32_t low_priority : 1;
 };
 
 typedef struct {
@@ -54,6 +55,7 @@ typedef struct {
     uint32_t busy_time;
     uint32_t idle_period_start;
     uint32_t run_cnt;
+    bool low_priority_deferred;
 
     lv_timer_handler_resume_cb_t resume_cb;
     void * resume_data;
@@ -73,6 +75,12 @@ void lv_timer_core_init(void);
  */
 void lv_timer_core_deinit(void);
 
+/**
+ * Postpone the low priority timers, used while a frame is over budget
+ * @param defer true: run low priority timers only every second period
+ */
+void lv_timer_core_defer_low_priority(bool defer);
+
 /**********************
  *      MACROS
  **********************/
@@ -17,6 +17,7 @@
 #include "../../core/lv_obj_private.h"
 #include "../../core/lv_obj_class_private.h"
 #include "../../core/lv_obj_draw_private.h"
+#include "../../core/lv_refr_private.h"
 
 #include "../../lvgl_public.h"
 /*********************
@@ -29,6 +30,9 @@
 #define LV_CHART_POINT_CNT_DEF 10
 #define LV_CHART_LABEL_MAX_TEXT_LENGTH 16
 
+/*Number of points whose min/max is stored in an envelope entry*/
+#define LV_CHART_ENVELOPE_BLOCK_SIZE 32
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -42,6 +46,13 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e);
 
 static void draw_div_lines(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer);
+static uint32_t crowded_points_from_envelope(lv_obj_t * obj, lv_chart_series_t * ser, lv_layer_t * layer,
+                                             int32_t x_ofs, int32_t y_ofs, int32_t extra_space_x,
+                                             lv_point_precise_t * points);
+static bool draw_series_line_blit(lv_obj_t * obj, lv_layer_t * layer, const lv_area_t * ext_coords);
+static void blit_render(lv_obj_t * obj, const lv_area_t * ext_coords, const lv_area_t * clip_areas,
+                        uint32_t clip_cnt);
+static void blit_free(lv_obj_t * obj);
 static void draw_series_curve(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_bar(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_stacked(lv_obj_t * obj, lv_layer_t * layer);
@@ -49,6 +60,11 @@ static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_cursors(lv_obj_t * obj, lv_layer_t * layer);
 static uint32_t get_index_from_x(lv_obj_t * obj, int32_t x);
 static void invalidate_point(lv_obj_t * obj, uint32_t i);
+static void set_point_value(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id, int32_t value);
+static void envelope_build(lv_obj_t * obj, lv_chart_series_t * ser);
+static void envelope_update_block(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t block);
+static void envelope_get_min_max(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t from, uint32_t to,
+                                 int32_t * min, int32_t * max);
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, int32_t ** a);
 static int32_t value_to_y(lv_obj_t * obj, lv_chart_series_t * ser, int32_t v, int32_t h);
 
@@ -244,6 +260,20 @@ void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode
     if(chart->update_mode == update_mode) return;
 
     chart->update_mode = update_mode;
+    chart->blit_valid = 0;
+    lv_obj_invalidate(obj);
+}
+
+void lv_chart_set_shift_blit(lv_obj_t * obj, bool en)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(chart->shift_blit == en) return;
+
+    chart->shift_blit = en;
+    if(!en) blit_free(obj);
+    chart->blit_valid = 0;
     lv_obj_invalidate(obj);
 }
 
@@ -304,6 +334,14 @@ lv_chart_update_mode_t lv_chart_get_update_mode(const lv_obj_t * obj)
     return chart->update_mode;
 }
 
+bool lv_chart_get_shift_blit(const lv_obj_t * obj)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return false);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    return chart->shift_blit;
+}
+
 uint32_t lv_chart_get_hor_div_line_count(const lv_obj_t * obj)
 {
     LV_CHECK_OBJ(obj, MY_CLASS, return 0);
@@ -455,6 +493,14 @@ void lv_chart_refresh(lv_obj_t * obj)
 {
     LV_CHECK_OBJ(obj, MY_CLASS, return);
 
+    /*The values might have been changed directly in the arrays so update everything*/
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    lv_chart_series_t * ser;
+    LV_LL_READ_BACK(&chart->series_ll, ser) {
+        ser->envelope_valid = 0;
+    }
+    chart->blit_valid = 0;
+
     lv_obj_invalidate(obj);
 }
 
@@ -521,6 +567,8 @@ lv_chart_series_t * lv_chart_add_series(lv_obj_t * obj, lv_color_t color, lv_cha
         p_tmp++;
     }
 
+    chart->blit_valid = 0;
+
     return ser;
 }
 
@@ -532,6 +580,8 @@ void lv_chart_remove_series(lv_obj_t * obj, lv_chart_series_t * series)
     lv_chart_t * chart    = (lv_chart_t *)obj;
     if(!series->y_ext_buf_assigned && series->y_points) lv_free(series->y_points);
     if(!series->x_ext_buf_assigned && series->x_points) lv_free(series->x_points);
+    lv_free(series->envelope);
+    chart->blit_valid = 0;
 
     lv_ll_remove(&chart->series_ll, series);
     lv_free(series);
@@ -576,6 +626,7 @@ void lv_chart_set_x_start_point(lv_obj_t * obj, lv_chart_series_t * ser, uint32_
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(id >= chart->point_cnt) return;
     ser->start_point = id;
+    chart->blit_valid = 0;
 }
 
 lv_chart_series_t * lv_chart_get_series_next(const lv_obj_t * obj, const lv_chart_series_t * ser)
@@ -695,8 +746,16 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, int32_t va
 
     lv_chart_t * chart  = (lv_chart_t *)obj;
 
-    ser->y_points[ser->start_point] = value;
-    invalidate_point(obj, ser->start_point);
+    set_point_value(obj, ser, ser->start_point, value);
+
+    /*In shift mode all the points move. In shift blit mode the rendered points are just shifted.*/
+    if(chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT) {
+        ser->shift_cnt++;
+        lv_obj_invalidate(obj);
+    }
+    else {
+        invalidate_point(obj, ser->start_point);
+    }
     ser->start_point = (ser->start_point + 1) % chart->point_cnt;
 }
 
@@ -743,7 +802,7 @@ void lv_chart_set_series_value_by_id(lv_obj_t * obj, lv_chart_series_t * ser, ui
     lv_chart_t * chart  = (lv_chart_t *)obj;
 
     if(id >= chart->point_cnt) return;
-    ser->y_points[id] = value;
+    set_point_value(obj, ser, id, value);
     invalidate_point(obj, id);
 }
 
@@ -773,6 +832,10 @@ void lv_chart_set_series_ext_y_array(lv_obj_t * obj, lv_chart_series_t * ser, in
     if(!ser->y_ext_buf_assigned && ser->y_points) lv_free(ser->y_points);
     ser->y_ext_buf_assigned = true;
     ser->y_points = array;
+    ser->envelope_valid = 0;
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    chart->blit_valid = 0;
     lv_obj_invalidate(obj);
 }
 
@@ -792,6 +855,9 @@ int32_t * lv_chart_get_series_y_array(const lv_obj_t * obj, lv_chart_series_t *
     LV_UNUSED(obj);
     LV_CHECK_OBJ(obj, MY_CLASS, return NULL);
     LV_ASSERT_NULL(ser);
+
+    /*The values might be changed directly in the array*/
+    ser->envelope_valid = 0;
     return ser->y_points;
 }
 
@@ -873,6 +939,7 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
         if(!ser->y_ext_buf_assigned) lv_free(ser->y_points);
         if(!ser->x_ext_buf_assigned) lv_free(ser->x_points);
+        lv_free(ser->envelope);
 
         lv_ll_remove(&chart->series_ll, ser);
         lv_free(ser);
@@ -887,6 +954,8 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     }
     lv_ll_clear(&chart->cursor_ll);
 
+    blit_free(obj);
+
     LV_TRACE_OBJ_CREATE("finished");
 }
 
@@ -922,6 +991,9 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e)
         invalidate_point(obj, chart->pressed_point_id);
         chart->pressed_point_id = LV_CHART_POINT_NONE;
     }
+    else if(code == LV_EVENT_STYLE_CHANGED || code == LV_EVENT_SIZE_CHANGED) {
+        chart->blit_valid = 0;
+    }
     else if(code == LV_EVENT_DRAW_MAIN) {
         lv_layer_t * layer = lv_event_get_layer(e);
 
@@ -938,7 +1010,9 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e)
             draw_div_lines(obj, layer);
 
             if(lv_ll_is_empty(&chart->series_ll) == false) {
-                if(chart->type == LV_CHART_TYPE_LINE) draw_series_line(obj, layer);
+                if(chart->type == LV_CHART_TYPE_LINE) {
+                    if(!draw_series_line_blit(obj, layer, &ext_coords)) draw_series_line(obj, layer);
+                }
                 else if(chart->type == LV_CHART_TYPE_CURVE) draw_series_curve(obj, layer);
                 else if(chart->type == LV_CHART_TYPE_BAR) draw_series_bar(obj, layer);
                 else if(chart->type == LV_CHART_TYPE_STACKED) draw_series_stacked(obj, layer);
@@ -1085,6 +1159,18 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
         line_dsc.color = ser->color;
         line_dsc.base.drop_shadow_color = ser->color;
 
+        /*Without gaps the min/max of the columns can be calculated from the envelope
+         *instead of mapping every point to the screen.*/
+        if(crowded_mode && chart->point_cnt >= 4 * LV_CHART_ENVELOPE_BLOCK_SIZE) {
+            if(!ser->envelope_valid) envelope_build(obj, ser);
+            if(ser->envelope_valid && ser->none_cnt == 0) {
+                line_dsc.point_cnt = crowded_points_from_envelope(obj, ser, layer, x_ofs, y_ofs, extra_space_x, points);
+                lv_draw_line(layer, &line_dsc);
+                line_dsc.base.id1--;
+                continue;
+            }
+        }
+
         int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
         int32_t p_act = start_point;
         int32_t p_prev = start_point;
@@ -1181,6 +1267,257 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
     if(points) lv_free(points);
 }
 
+/**
+ * Collect the vertical lines of a crowded line series the same way as `draw_series_line` does,
+ * but get the min/max values of the columns from the envelope of the series.
+ * The series can't have `LV_CHART_POINT_NONE` points.
+ * @param obj           pointer to a chart
+ * @param ser           pointer to a series with a valid envelope
+ * @param layer         the layer to draw to
+ * @param x_ofs         X coordinate of the first point
+ * @param y_ofs         Y coordinate of the top of the content area
+ * @param extra_space_x extra area to draw on the left and right of the clip area
+ * @param points        store the points here
+ * @return              number of points stored in `points`
+ */
+static uint32_t crowded_points_from_envelope(lv_obj_t * obj, lv_chart_series_t * ser, lv_layer_t * layer,
+                                             int32_t x_ofs, int32_t y_ofs, int32_t extra_space_x,
+                                             lv_point_precise_t * points)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    int32_t w = lv_obj_get_content_width(obj);
+    int32_t h = lv_obj_get_content_height(obj);
+    uint32_t point_cnt = chart->point_cnt;
+    int64_t n = point_cnt - 1;
+    uint32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+    int32_t min_v = chart->ymin[ser->y_axis_sec];
+    int32_t max_v = chart->ymax[ser->y_axis_sec];
+    if(w <= 0) return 0;
+
+    /*The first point which is not skipped on the left and the last X position*/
+    int32_t x_start = layer->_clip_area.x1 - extra_space_x - 1 - x_ofs;
+    int32_t x_end = layer->_clip_area.x2 + extra_space_x + 1 - x_ofs;
+    uint32_t i_prev = x_start <= 0 ? 0 : (uint32_t)(((int64_t)x_start * n + w - 1) / w);
+    uint32_t i = i_prev;
+
+    lv_value_precise_t y_min = obj->coords.y2;
+    lv_value_precise_t y_max = obj->coords.y1;
+    uint32_t cnt = 0;
+    while(i < point_cnt) {
+        int32_t x = (int32_t)((w * i) / (point_cnt - 1));
+        if(x > x_end) break;
+
+        /*The line of an X position covers the points since the first point of the previous X position*/
+        uint32_t from = (start_point + i_prev) % point_cnt;
+        uint32_t to = (start_point + i) % point_cnt;
+        int32_t v_min;
+        int32_t v_max;
+        envelope_get_min_max(obj, ser, from, from <= to ? to : point_cnt - 1, &v_min, &v_max);
+        if(from > to) {
+            int32_t v_min2;
+            int32_t v_max2;
+            envelope_get_min_max(obj, ser, 0, to, &v_min2, &v_max2);
+            v_min = LV_MIN(v_min, v_min2);
+            v_max = LV_MAX(v_max, v_max2);
+        }
+
+        int32_t y1 = lv_map(v_min, min_v, max_v, y_ofs + h, y_ofs);
+        int32_t y2 = lv_map(v_max, min_v, max_v, y_ofs + h, y_ofs);
+        y_min = LV_MIN(y_min, LV_MIN(y1, y2));
+        y_max = LV_MAX(y_max, LV_MAX(y1, y2));
+
+        points[cnt].x = x + x_ofs;
+        points[cnt].y = y_min;
+        points[cnt + 1].x = x + x_ofs;
+        points[cnt + 1].y = y_max;
+        points[cnt + 2].x = x + x_ofs;
+        points[cnt + 2].y = LV_DRAW_LINE_POINT_NONE;
+
+        /*If they are the same no line would be drawn*/
+        if(points[cnt].y == points[cnt + 1].y) points[cnt + 1].y++;
+        cnt += 3;
+
+        /*Start the line of the next X from the current last Y*/
+        y_min = lv_map(ser->y_points[to], min_v, max_v, y_ofs + h, y_ofs);
+        y_max = y_min;
+
+        /*Jump to the first point of the next X position*/
+        i_prev = i;
+        i = (uint32_t)(((int64_t)(x + 1) * n + w - 1) / w);
+    }
+
+    return cnt;
+}
+
+/**
+ * Draw the line series from a bitmap which is shifted when new values are added in
+ * `LV_CHART_UPDATE_MODE_SHIFT` mode. Only the areas of the new and removed points are rendered again.
+ * @param obj           pointer to a chart
+ * @param layer         the layer to draw to
+ * @param ext_coords    the coordinates of the chart with the extra draw size
+ * @return              false if the series should be drawn normally
+ */
+static bool draw_series_line_blit(lv_obj_t * obj, lv_layer_t * layer, const lv_area_t * ext_coords)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(!chart->shift_blit || chart->update_mode != LV_CHART_UPDATE_MODE_SHIFT) return false;
+    if(chart->point_cnt < 2) return false;
+    if(lv_refr_get_disp_refreshing() == NULL) return false;
+
+    int32_t buf_w = lv_area_get_width(ext_coords);
+    int32_t buf_h = lv_area_get_height(ext_coords);
+    if(chart->blit_buf && (chart->blit_buf->header.w != buf_w || chart->blit_buf->header.h != buf_h)) {
+        blit_free(obj);
+    }
+
+    if(chart->blit_buf == NULL) {
+        chart->blit_buf = lv_draw_buf_create(buf_w, buf_h, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+        if(chart->blit_buf == NULL) {
+            LV_LOG_WARN("Couldn't allocate the bitmap of the series");
+            return false;
+        }
+        chart->blit_valid = 0;
+    }
+
+    /*All the visible series need to be shifted by the same number of points*/
+    lv_chart_series_t * ser;
+    bool shift_cnt_set = false;
+    uint32_t shift_cnt = 0;
+    LV_LL_READ_BACK(&chart->series_ll, ser) {
+        if(ser->hidden) continue;
+        if(!shift_cnt_set) {
+            shift_cnt = ser->shift_cnt;
+            shift_cnt_set = true;
+        }
+        else if(ser->shift_cnt != shift_cnt) chart->blit_valid = 0;
+    }
+
+    if(chart->blit_scroll.x != lv_obj_get_scroll_x(obj) || chart->blit_scroll.y != lv_obj_get_scroll_y(obj)) {
+        chart->blit_valid = 0;
+    }
+
+    int32_t border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    int32_t pad_left = lv_obj_get_style_pad_left(obj, LV_PART_MAIN) + border_width;
+    int32_t w = lv_obj_get_content_width(obj);
+    int32_t x_ofs = obj->coords.x1 + pad_left - lv_obj_get_scroll_left(obj);
+    int32_t n = chart->point_cnt - 1;
+
+    /*The points are moved by whole pixels only if the shifted X positions are integers*/
+    int64_t shift_w = (int64_t)w * shift_cnt;
+    if(shift_w % n != 0) chart->blit_valid = 0;
+    int32_t dx = (int32_t)(shift_w / n);
+
+    /*The areas of the removed and added points with the space of the lines and bullets*/
+    int32_t bullet_w = lv_obj_get_style_width(obj, LV_PART_INDICATOR) / 2;
+    int32_t line_width = lv_obj_get_style_line_width(obj, LV_PART_ITEMS);
+    int32_t extra_space_x = w / n + bullet_w + line_width;
+
+    lv_area_t areas[2];
+    areas[0] = *ext_coords;
+    areas[0].x2 = x_ofs + extra_space_x;
+    areas[1] = *ext_coords;
+    areas[1].x1 = x_ofs + w - dx - extra_space_x - 1;
+    if(areas[0].x2 >= areas[1].x1) chart->blit_valid = 0;
+
+    if(!chart->blit_valid) {
+        lv_draw_buf_clear(chart->blit_buf, NULL);
+        blit_render(obj, ext_coords, ext_coords, 1);
+    }
+    else if(dx > 0) {
+        /*Move the rendered points to the left and render only the changed areas*/
+        lv_draw_buf_t * buf = chart->blit_buf;
+        uint32_t px_size = lv_color_format_get_size(LV_COLOR_FORMAT_ARGB8888);
+        int32_t y;
+        for(y = 0; y < buf_h; y++) {
+            uint8_t * row = lv_draw_buf_goto_xy(buf, 0, y);
+            if(dx < buf_w) lv_memmove(row, row + dx * px_size, (buf_w - dx) * px_size);
+        }
+
+        uint32_t i;
+        for(i = 0; i < 2; i++) {
+            lv_area_intersect(&areas[i], &areas[i], ext_coords);
+            lv_area_t buf_area = areas[i];
+            lv_area_move(&buf_area, -ext_coords->x1, -ext_coords->y1);
+            lv_draw_buf_clear(buf, &buf_area);
+        }
+        blit_render(obj, ext_coords, areas, 2);
+    }
+
+    LV_LL_READ_BACK(&chart->series_ll, ser) {
+        ser->shift_cnt = 0;
+    }
+    chart->blit_valid = 1;
+    chart->blit_scroll.x = lv_obj_get_scroll_x(obj);
+    chart->blit_scroll.y = lv_obj_get_scroll_y(obj);
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = chart->blit_buf;
+    img_dsc.base.layer = layer;
+    lv_draw_image(layer, &img_dsc, ext_coords);
+
+    return true;
+}
+
+/**
+ * Render the line series into the bitmap of the chart
+ * @param obj           pointer to a chart
+ * @param ext_coords    the coordinates of the bitmap
+ * @param clip_areas    render only these areas
+ * @param clip_cnt      number of areas in `clip_areas`
+ */
+static void blit_render(lv_obj_t * obj, const lv_area_t * ext_coords, const lv_area_t * clip_areas,
+                        uint32_t clip_cnt)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    lv_layer_t layer;
+    lv_layer_init(&layer);
+    layer.draw_buf = chart->blit_buf;
+    layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+    layer.buf_area = *ext_coords;
+    layer.phy_clip_area = *ext_coords;
+
+    lv_draw_unit_send_event(NULL, LV_EVENT_CHILD_CREATED, &layer);
+
+    uint32_t i;
+    for(i = 0; i < clip_cnt; i++) {
+        layer._clip_area = clip_areas[i];
+        draw_series_line(obj, &layer);
+    }
+
+    /*Render it now as the display's layer is still being created*/
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+    layer.all_tasks_added = true;
+    lv_draw_dispatch_request();
+    while(layer.draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        if(!lv_draw_dispatch_layer(disp, &layer)) {
+            lv_draw_wait_for_finish();
+            lv_draw_dispatch_request();
+        }
+    }
+
+    lv_draw_unit_send_event(NULL, LV_EVENT_SCREEN_LOAD_START, &layer);
+    lv_draw_unit_send_event(NULL, LV_EVENT_CHILD_DELETED, &layer);
+
+    /*The content of the bitmap has changed*/
+    lv_image_cache_drop(chart->blit_buf);
+    LV_PROFILER_DRAW_END;
+}
+
+static void blit_free(lv_obj_t * obj)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(chart->blit_buf == NULL) return;
+
+    lv_image_cache_drop(chart->blit_buf);
+    lv_draw_buf_destroy(chart->blit_buf);
+    chart->blit_buf = NULL;
+    chart->blit_valid = 0;
+}
+
 static void draw_series_curve(lv_obj_t * obj, lv_layer_t * layer)
 {
 #if LV_USE_VECTOR_GRAPHIC
@@ -1381,6 +1718,14 @@ static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer)
     if(LV_MIN(point_w, point_h) > line_dsc.width / 2) line_dsc.raw_end = 1;
     if(line_dsc.width == 1) line_dsc.raw_end = 1;
 
+    lv_point_precise_t * points = lv_malloc(chart->point_cnt * sizeof(lv_point_precise_t));
+    if(points == NULL) {
+        LV_LOG_WARN("Couldn't allocate the points array");
+        return;
+    }
+    line_dsc.points = points;
+    line_dsc.point_cnt = chart->point_cnt;
+
     /*Go through all data lines*/
     LV_LL_READ_BACK(&chart->series_ll, ser) {
         if(ser->hidden) continue;
@@ -1389,79 +1734,47 @@ static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer)
 
         int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
 
-        line_dsc.p1.x = x_ofs;
-        line_dsc.p2.x = x_ofs;
-
-        int32_t p_act = start_point;
-        int32_t p_prev = start_point;
-        if(ser->y_points[p_act] != LV_CHART_POINT_CNT_DEF) {
-            line_dsc.p2.x = lv_map(ser->x_points[p_act], chart->xmin[ser->x_axis_sec], chart->xmax[ser->x_axis_sec], 0, w);
-            line_dsc.p2.x += x_ofs;
-
-            line_dsc.p2.y = lv_map(ser->y_points[p_act], chart->ymin[ser->y_axis_sec], chart->ymax[ser->y_axis_sec], 0, h);
-            line_dsc.p2.y = h - line_dsc.p2.y;
-            line_dsc.p2.y += y_ofs;
-        }
-        else {
-            line_dsc.p2.x = (lv_value_precise_t)LV_COORD_MIN;
-            line_dsc.p2.y = (lv_value_precise_t)LV_COORD_MIN;
-        }
-
+        /*Collect the points to draw all the lines of the series as one polyline.
+         *The invalid points break the polyline.*/
         for(i = 0; i < chart->point_cnt; i++) {
-            line_dsc.p1.x = line_dsc.p2.x;
-            line_dsc.p1.y = line_dsc.p2.y;
-
-            p_act = (start_point + i) % chart->point_cnt;
+            int32_t p_act = (start_point + i) % chart->point_cnt;
             if(ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                line_dsc.p2.y =  lv_map(ser->y_points[p_act], chart->ymin[ser->y_axis_sec], chart->ymax[ser->y_axis_sec], 0, h);
-                line_dsc.p2.y = h - line_dsc.p2.y;
-                line_dsc.p2.y += y_ofs;
+                points[i].y = lv_map(ser->y_points[p_act], chart->ymin[ser->y_axis_sec], chart->ymax[ser->y_axis_sec], 0, h);
+                points[i].y = h - points[i].y;
+                points[i].y += y_ofs;
 
-                line_dsc.p2.x = lv_map(ser->x_points[p_act], chart->xmin[ser->x_axis_sec], chart->xmax[ser->x_axis_sec], 0, w);
-                line_dsc.p2.x += x_ofs;
+                points[i].x = lv_map(ser->x_points[p_act], chart->xmin[ser->x_axis_sec], chart->xmax[ser->x_axis_sec], 0, w);
+                points[i].x += x_ofs;
             }
             else {
-                p_prev = p_act;
-                continue;
-            }
-
-            if(i != 0) { /*Don't draw line *to* the first point.*/
-                lv_area_t point_area;
-                point_area.x1 = (int32_t)line_dsc.p1.x - point_w;
-                point_area.x2 = (int32_t)line_dsc.p1.x + point_w;
-                point_area.y1 = (int32_t)line_dsc.p1.y - point_h;
-                point_area.y2 = (int32_t)line_dsc.p1.y + point_h;
-
-                if(ser->y_points[p_prev] != LV_CHART_POINT_NONE && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                    line_dsc.base.id2 = i - 1;
-                    lv_draw_line(layer, &line_dsc);
-                    if(point_w && point_h) {
-                        point_dsc_default.base.id2 = i - 1;
-                        lv_draw_rect(layer, &point_dsc_default, &point_area);
-                    }
-                }
-
-                p_prev = p_act;
+                points[i].x = LV_DRAW_LINE_POINT_NONE;
+                points[i].y = LV_DRAW_LINE_POINT_NONE;
             }
+        }
 
-            /*Draw the last point*/
-            if(i == chart->point_cnt - 1) {
-
-                if(ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                    lv_area_t point_area;
-                    point_area.x1 = (int32_t)line_dsc.p2.x - point_w;
-                    point_area.x2 = (int32_t)line_dsc.p2.x + point_w;
-                    point_area.y1 = (int32_t)line_dsc.p2.y - point_h;
-                    point_area.y2 = (int32_t)line_dsc.p2.y + point_h;
+        line_dsc.base.id2 = 0;
+        lv_draw_line(layer, &line_dsc);
 
-                    point_dsc_default.base.id2 = i;
-                    lv_draw_rect(layer, &point_dsc_default, &point_area);
-                }
-            }
+        /*Draw the points which have a line to the next point and the last point*/
+        for(i = 0; i < chart->point_cnt; i++) {
+            if(points[i].y == LV_DRAW_LINE_POINT_NONE) continue;
+            bool last = i == chart->point_cnt - 1;
+            if(!last && (point_w == 0 || point_h == 0 || points[i + 1].y == LV_DRAW_LINE_POINT_NONE)) continue;
+
+            lv_area_t point_area;
+            point_area.x1 = (int32_t)points[i].x - point_w;
+            point_area.x2 = (int32_t)points[i].x + point_w;
+            point_area.y1 = (int32_t)points[i].y - point_h;
+            point_area.y2 = (int32_t)points[i].y + point_h;
+
+            point_dsc_default.base.id2 = i;
+            lv_draw_rect(layer, &point_dsc_default, &point_area);
         }
         line_dsc.base.id1++;
         point_dsc_default.base.id1++;
     }
+
+    lv_free(points);
 }
 
 static void draw_series_bar(lv_obj_t * obj, lv_layer_t * layer)
@@ -1791,6 +2104,7 @@ static void invalidate_point(lv_obj_t * obj, uint32_t i)
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(i >= chart->point_cnt) return;
 
+    chart->blit_valid = 0;
 
     /*In shift mode the whole chart changes so the whole object*/
     if(chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT) {
@@ -1851,6 +2165,117 @@ static void invalidate_point(lv_obj_t * obj, uint32_t i)
     }
 }
 
+/**
+ * Write a value of a series and update its envelope
+ * @param obj       pointer to a chart
+ * @param ser       pointer to a series
+ * @param id        index of the value in `y_points`
+ * @param value     the new value
+ */
+static void set_point_value(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id, int32_t value)
+{
+    int32_t old_value = ser->y_points[id];
+    ser->y_points[id] = value;
+    if(!ser->envelope_valid) return;
+
+    if(old_value == LV_CHART_POINT_NONE) ser->none_cnt--;
+    if(value == LV_CHART_POINT_NONE) ser->none_cnt++;
+
+    uint32_t block = id / LV_CHART_ENVELOPE_BLOCK_SIZE;
+    lv_chart_envelope_t * env = &ser->envelope[block];
+    /*If the min or max is overwritten the whole block needs to be checked again*/
+    if(old_value != LV_CHART_POINT_NONE && (old_value == env->min || old_value == env->max)) {
+        envelope_update_block(obj, ser, block);
+    }
+    else if(value != LV_CHART_POINT_NONE) {
+        env->min = LV_MIN(env->min, value);
+        env->max = LV_MAX(env->max, value);
+    }
+}
+
+/**
+ * Calculate the min/max values of every block of points of a series
+ * @param obj       pointer to a chart
+ * @param ser       pointer to a series
+ */
+static void envelope_build(lv_obj_t * obj, lv_chart_series_t * ser)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    uint32_t block_cnt = (chart->point_cnt + LV_CHART_ENVELOPE_BLOCK_SIZE - 1) / LV_CHART_ENVELOPE_BLOCK_SIZE;
+    lv_chart_envelope_t * envelope = lv_realloc(ser->envelope, block_cnt * sizeof(lv_chart_envelope_t));
+    if(envelope == NULL) {
+        LV_LOG_WARN("Couldn't allocate the envelope of the series");
+        return;
+    }
+    ser->envelope = envelope;
+
+    uint32_t i;
+    for(i = 0; i < block_cnt; i++) {
+        envelope_update_block(obj, ser, i);
+    }
+
+    ser->none_cnt = 0;
+    for(i = 0; i < chart->point_cnt; i++) {
+        if(ser->y_points[i] == LV_CHART_POINT_NONE) ser->none_cnt++;
+    }
+
+    ser->envelope_valid = 1;
+}
+
+static void envelope_update_block(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t block)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    uint32_t start = block * LV_CHART_ENVELOPE_BLOCK_SIZE;
+    uint32_t end = LV_MIN(start + LV_CHART_ENVELOPE_BLOCK_SIZE, chart->point_cnt);
+    lv_chart_envelope_t * env = &ser->envelope[block];
+    env->min = INT32_MAX;
+    env->max = INT32_MIN;
+
+    uint32_t i;
+    for(i = start; i < end; i++) {
+        int32_t v = ser->y_points[i];
+        if(v == LV_CHART_POINT_NONE) continue;
+        env->min = LV_MIN(env->min, v);
+        env->max = LV_MAX(env->max, v);
+    }
+}
+
+/**
+ * Get the min/max values of a range of points
+ * @param obj       pointer to a chart
+ * @param ser       pointer to a series with a valid envelope
+ * @param from      index of the first point in `y_points`
+ * @param to        index of the last point in `y_points` (inclusive)
+ * @param min       store the min value here
+ * @param max       store the max value here
+ */
+static void envelope_get_min_max(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t from, uint32_t to,
+                                 int32_t * min, int32_t * max)
+{
+    LV_UNUSED(obj);
+    int32_t v_min = INT32_MAX;
+    int32_t v_max = INT32_MIN;
+
+    uint32_t i = from;
+    while(i <= to) {
+        /*Use the envelope for the whole blocks*/
+        if(i % LV_CHART_ENVELOPE_BLOCK_SIZE == 0 && i + LV_CHART_ENVELOPE_BLOCK_SIZE - 1 <= to) {
+            const lv_chart_envelope_t * env = &ser->envelope[i / LV_CHART_ENVELOPE_BLOCK_SIZE];
+            v_min = LV_MIN(v_min, env->min);
+            v_max = LV_MAX(v_max, env->max);
+            i += LV_CHART_ENVELOPE_BLOCK_SIZE;
+        }
+        else {
+            v_min = LV_MIN(v_min, ser->y_points[i]);
+            v_max = LV_MAX(v_max, ser->y_points[i]);
+            i++;
+        }
+    }
+
+    *min = v_min;
+    *max = v_max;
+}
+
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, int32_t ** a)
 {
     if((*a) == NULL) return;
@@ -27,14 +27,26 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/**
+ * Minimum and maximum of a block of points in a series
+ */
+typedef struct {
+    int32_t min;
+    int32_t max;
+} lv_chart_envelope_t;
+
 /**
  * Descriptor a chart series
  */
 struct _lv_chart_series_t {
     int32_t * x_points;
     int32_t * y_points;
+    lv_chart_envelope_t * envelope; /**< Min/max of the blocks of `y_points` to draw crowded lines faster*/
+    uint32_t none_cnt;              /**< Number of `LV_CHART_POINT_NONE` values if `envelope` is valid*/
+    uint32_t shift_cnt;             /**< Number of values added since the shift blit bitmap was rendered*/
     lv_color_t color;
     uint32_t start_point;
+    uint32_t envelope_valid : 1;
     uint32_t hidden : 1;
     uint32_t x_ext_buf_assigned : 1;
     uint32_t y_ext_buf_assigned : 1;
@@ -63,8 +75,12 @@ struct _lv_chart_t {
     uint32_t hdiv_cnt;          /**< Number of horizontal division lines */
     uint32_t vdiv_cnt;          /**< Number of vertical division lines */
     uint32_t point_cnt;         /**< Number of points in all series */
+    lv_draw_buf_t * blit_buf;   /**< The rendered line series in shift blit mode */
+    lv_point_t blit_scroll;     /**< The scroll position when `blit_buf` was rendered */
     lv_chart_type_t type  : 4;  /**< Chart type */
     lv_chart_update_mode_t update_mode : 2;
+    uint32_t shift_blit : 1;    /**< 1: keep the line series in `blit_buf` and shift it */
+    uint32_t blit_valid : 1;    /**< 1: `blit_buf` can be shifted */
 };
 
 
@@ -16,6 +16,9 @@
  *********************/
 #define MY_CLASS (&lv_line_class)
 
+/*Number of points which are resolved on the stack when drawing*/
+#define LV_LINE_POINT_BUF_CNT 16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -246,30 +249,30 @@ static void lv_line_event(const lv_obj_class_t * class_p, lv_event_t * e)
         line_dsc.base.layer = layer;
         lv_obj_init_draw_line_dsc(obj, LV_PART_MAIN, &line_dsc);
 
-        /*Read all points and draw the lines*/
-        uint32_t i;
-        for(i = 0; i < line->point_num - 1; i++) {
-            int32_t w = lv_obj_get_width(obj);
-            int32_t h = lv_obj_get_height(obj);
-
-            line_dsc.p1.x = resolve_point_coord(line->point_array.constant[i].x, w) + x_ofs;
-            line_dsc.p1.y = resolve_point_coord(line->point_array.constant[i].y, h);
+        /*Draw all the points as one polyline so that the joins are rendered properly*/
+        lv_point_precise_t points_buf[LV_LINE_POINT_BUF_CNT];
+        lv_point_precise_t * points = points_buf;
+        if(line->point_num > LV_LINE_POINT_BUF_CNT) {
+            points = lv_malloc(line->point_num * sizeof(lv_point_precise_t));
+            LV_ASSERT_MALLOC(points);
+            if(points == NULL) return;
+        }
 
-            line_dsc.p2.x = resolve_point_coord(line->point_array.constant[i + 1].x, w) + x_ofs;
-            line_dsc.p2.y = resolve_point_coord(line->point_array.constant[i + 1].y, h);
+        int32_t w = lv_obj_get_width(obj);
+        int32_t h = lv_obj_get_height(obj);
+        uint32_t i;
+        for(i = 0; i < line->point_num; i++) {
+            points[i].x = resolve_point_coord(line->point_array.constant[i].x, w) + x_ofs;
+            points[i].y = resolve_point_coord(line->point_array.constant[i].y, h);
+            if(line->y_inv == 0) points[i].y = points[i].y + y_ofs;
+            else points[i].y = h - points[i].y + y_ofs;
+        }
 
-            if(line->y_inv == 0) {
-                line_dsc.p1.y = line_dsc.p1.y + y_ofs;
-                line_dsc.p2.y = line_dsc.p2.y + y_ofs;
-            }
-            else {
-                line_dsc.p1.y = h - line_dsc.p1.y + y_ofs;
-                line_dsc.p2.y = h - line_dsc.p2.y + y_ofs;
-            }
+        line_dsc.points = points;
+        line_dsc.point_cnt = line->point_num;
+        lv_draw_line(layer, &line_dsc);
 
-            lv_draw_line(layer, &line_dsc);
-            line_dsc.round_start = 0;   /*Draw the rounding only on the end points after the first line*/
-        }
+        if(points != points_buf) lv_free(points);
     }
 }
 #endif
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+
+lvgl_test_dir = os.path.dirname(os.path.realpath(__file__))
+lvgl_root_dir = os.path.dirname(lvgl_test_dir)
+build_dir = os.path.join(lvgl_test_dir, "build_benchmark_headless")
+defaults_path = os.path.join(
+    lvgl_root_dir, "configs", "ci", "perf", "lv_conf_headless.defaults"
+)
+
+
+def main() -> int:
+    epilog = """This program runs the LVGL demo benchmark on a headless display.
+    The scenes are rendered as fast as possible without a screen, so it runs on any
+    Linux host or CI runner. The results are written as JSON and contain the frames per
+    second, the render time percentiles and the draw task count of each scene.
+    Unlike `benchmark_emu.py` the timings depend on the host computer, so compare
+    only the results of the same machine.
+    """
+    parser = argparse.ArgumentParser(
+        description="Run the LVGL benchmark on a headless display.", epilog=epilog
+    )
+    parser.add_argument("--width", type=int, default=800, help="Horizontal resolution")
+    parser.add_argument("--height", type=int, default=480, help="Vertical resolution")
+    parser.add_argument(
+        "--mode",
+        choices=["partial", "direct", "full"],
+        default="partial",
+        help="Render mode of the display",
+    )
+    parser.add_argument(
+        "--latency-us",
+        type=int,
+        default=0,
+        help="Simulated fixed transfer time of each flushed area",
+    )
+    parser.add_argument(
+        "--kbps",
+        type=int,
+        default=0,
+        help="Simulated bus bandwidth in kilobytes per second, 0 for unlimited",
+    )
+    parser.add_argument(
+        "--sink",
+        action="store_true",
+        default=False,
+        help="Copy the flushed areas into a frame buffer",
+    )
+    parser.add_argument(
+        "--force-invalidate",
+        action="store_true",
+        default=False,
+        help="Redraw the whole screen in every frame",
+    )
+    parser.add_argument(
+        "--output",
+        default=os.path.join(build_dir, "results.json"),
+        help="Path of the JSON results",
+    )
+    parser.add_argument(
+        "--clean",
+        action="store_true",
+        default=False,
+        help="Clean existing build artifacts before operation",
+    )
+
+    args = parser.parse_args()
+
+    if args.clean and os.path.exists(build_dir):
+        shutil.rmtree(build_dir)
+
+    runner = build()
+
+    cmd = [
+        runner,
+        "--width", str(args.width),
+        "--height", str(args.height),
+        "--mode", args.mode,
+        "--latency-us", str(args.latency_us),
+        "--kbps", str(args.kbps),
+        "--output", args.output,
+    ]
+    if args.sink:
+        cmd.append("--sink")
+    if args.force_invalidate:
+        cmd.append("--force-invalidate")
+
+    subprocess.check_call(cmd)
+    print(f"Results written to {args.output}")
+
+    return 0
+
+
+def generate_config() -> str:
+    """Generate lv_conf.h from the headless defaults"""
+    os.makedirs(build_dir, exist_ok=True)
+    output_path = os.path.join(build_dir, "lv_conf.h")
+
+    cmd = [
+        sys.executable,
+        os.path.join(lvgl_root_dir, "scripts", "generate_lv_conf.py"),
+        "--template",
+        os.path.join(lvgl_root_dir, "lv_conf_template.h"),
+        "--config",
+        output_path,
+        "--defaults",
+        defaults_path,
+        build_dir,
+    ]
+
+    subprocess.check_call(cmd)
+    return output_path
+
+
+def build() -> str:
+    """Build LVGL, the demos and the runner. Return the path of the runner"""
+    conf_path = generate_config()
+    cmake_dir = os.path.join(build_dir, "cmake")
+
+    subprocess.check_call(
+        [
+            "cmake",
+            "-S", lvgl_root_dir,
+            "-B", cmake_dir,
+            "-DCMAKE_BUILD_TYPE=Release",
+            f"-DLV_BUILD_CONF_PATH={conf_path}",
+            "-DCONFIG_LV_BUILD_EXAMPLES=OFF",
+        ]
+    )
+    subprocess.check_call(
+        ["cmake", "--build", cmake_dir, "--parallel", str(os.cpu_count() or 1)]
+    )
+
+    runner = os.path.join(build_dir, "benchmark_headless")
+    subprocess.check_call(
+        [
+            os.environ.get("CC", "cc"),
+            "-O2",
+            "-DLV_CONF_INCLUDE_SIMPLE",
+            f"-I{build_dir}",
+            f"-I{lvgl_root_dir}",
+            os.path.join(lvgl_test_dir, "benchmark_headless", "main.c"),
+            "-o", runner,
+            f"-L{cmake_dir}",
+            f"-L{cmake_dir}/lib",
+            "-llvgl_demos",
+            "-llvgl",
+            "-lm",
+            "-lpthread",
+        ]
+    )
+
+    return runner
+
+
+if __name__ == "__main__":
+    sys.exit(main())
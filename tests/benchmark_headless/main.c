@@ -0,0 +1,278 @@
+/**
+ * @file main.c
+ *
+ * Run lv_demo_benchmark on a headless display as fast as possible
+ * and print the measurements of each scene as JSON.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lvgl.h"
+#include "demos/lv_demos.h"
+
+#if !LV_USE_HEADLESS_DISPLAY || !LV_USE_DEMO_BENCHMARK
+#error "LV_USE_HEADLESS_DISPLAY and LV_USE_DEMO_BENCHMARK are required"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MAX_SCENE_CNT   32
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const char * name;
+    uint64_t start_us;
+    uint64_t elaps_us;
+    uint32_t * render_times;    /*Render time of each frame in microseconds*/
+    uint32_t frame_cnt;
+    uint32_t frame_cap;
+    uint64_t flush_time_sum;
+    uint64_t draw_task_sum;
+    uint64_t flushed_px_sum;
+} scene_result_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void usage(const char * name);
+static uint32_t tick_get_cb(void);
+static void frame_cb(lv_display_t * disp, const lv_headless_display_frame_info_t * info, void * user_data);
+static void scene_cb(const lv_demo_benchmark_scene_dsc_t * scene);
+static void end_cb(const lv_demo_benchmark_summary_t * summary);
+static void scene_close(void);
+static int compare_u32(const void * a, const void * b);
+static uint32_t percentile(const uint32_t * sorted, uint32_t cnt, uint32_t p);
+static void print_json(FILE * f);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static scene_result_t results[MAX_SCENE_CNT];
+static int32_t scene_cnt;
+static bool finished;
+
+static int32_t hor_res = 800;
+static int32_t ver_res = 480;
+static const char * mode_name = "partial";
+static uint32_t latency_us;
+static uint32_t kbyte_per_sec;
+static bool sink;
+static bool force_invalidate;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    const char * out_path = NULL;
+
+    for(int i = 1; i < argc; i++) {
+        const char * arg = argv[i];
+        const char * val = i + 1 < argc ? argv[i + 1] : NULL;
+        if(strcmp(arg, "--sink") == 0) sink = true;
+        else if(strcmp(arg, "--force-invalidate") == 0) force_invalidate = true;
+        else if(val == NULL) {
+            usage(argv[0]);
+            return 1;
+        }
+        else if(strcmp(arg, "--width") == 0) hor_res = atoi(argv[++i]);
+        else if(strcmp(arg, "--height") == 0) ver_res = atoi(argv[++i]);
+        else if(strcmp(arg, "--mode") == 0) mode_name = argv[++i];
+        else if(strcmp(arg, "--latency-us") == 0) latency_us = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else if(strcmp(arg, "--kbps") == 0) kbyte_per_sec = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else if(strcmp(arg, "--output") == 0) out_path = argv[++i];
+        else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    lv_display_render_mode_t render_mode;
+    if(strcmp(mode_name, "partial") == 0) render_mode = LV_DISPLAY_RENDER_MODE_PARTIAL;
+    else if(strcmp(mode_name, "direct") == 0) render_mode = LV_DISPLAY_RENDER_MODE_DIRECT;
+    else if(strcmp(mode_name, "full") == 0) render_mode = LV_DISPLAY_RENDER_MODE_FULL;
+    else {
+        usage(argv[0]);
+        return 1;
+    }
+
+    lv_init();
+    lv_tick_set_cb(tick_get_cb);
+
+    lv_display_t * disp = lv_headless_display_create(hor_res, ver_res, render_mode);
+    if(disp == NULL) return 1;
+
+    lv_headless_display_set_transfer_time(disp, latency_us, kbyte_per_sec);
+    if(sink && lv_headless_display_set_memory_sink(disp, true) != LV_RESULT_OK) return 1;
+    lv_headless_display_set_frame_cb(disp, frame_cb, NULL);
+
+    /*Render a new frame as soon as the previous one is ready
+     *and update the animations as often as the tick allows*/
+    lv_timer_set_period(lv_display_get_refr_timer(disp), 0);
+    lv_timer_set_period(lv_anim_get_timer(), 0);
+
+    lv_demo_benchmark_set_scene_cb(scene_cb);
+    lv_demo_benchmark_set_end_cb(end_cb);
+    lv_demo_benchmark();
+
+    while(!finished) {
+        if(force_invalidate) lv_obj_invalidate(lv_screen_active());
+        lv_timer_handler();
+    }
+
+    FILE * f = stdout;
+    if(out_path) {
+        f = fopen(out_path, "w");
+        if(f == NULL) {
+            perror(out_path);
+            return 1;
+        }
+    }
+
+    print_json(f);
+    if(f != stdout) fclose(f);
+
+    for(int32_t i = 0; i < scene_cnt; i++) free(results[i].render_times);
+    lv_display_delete(disp);
+    lv_deinit();
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void usage(const char * name)
+{
+    fprintf(stderr,
+            "Usage: %s [--width N] [--height N] [--mode partial|direct|full]\n"
+            "          [--latency-us N] [--kbps N] [--sink] [--force-invalidate] [--output FILE]\n",
+            name);
+}
+
+static uint32_t tick_get_cb(void)
+{
+    return (uint32_t)(lv_headless_display_get_time_us() / 1000);
+}
+
+static void frame_cb(lv_display_t * disp, const lv_headless_display_frame_info_t * info, void * user_data)
+{
+    LV_UNUSED(disp);
+    LV_UNUSED(user_data);
+
+    /*A frame before the first scene is loaded*/
+    if(scene_cnt == 0) return;
+
+    scene_result_t * res = &results[scene_cnt - 1];
+    if(res->frame_cnt == res->frame_cap) {
+        uint32_t cap = res->frame_cap ? res->frame_cap * 2 : 256;
+        uint32_t * new_buf = realloc(res->render_times, cap * sizeof(uint32_t));
+        if(new_buf == NULL) return;
+        res->render_times = new_buf;
+        res->frame_cap = cap;
+    }
+
+    res->render_times[res->frame_cnt] = info->render_time_us;
+    res->frame_cnt++;
+    res->flush_time_sum += info->flush_time_us;
+    res->draw_task_sum += info->draw_task_cnt;
+    res->flushed_px_sum += info->flushed_px_cnt;
+}
+
+static void scene_cb(const lv_demo_benchmark_scene_dsc_t * scene)
+{
+    scene_close();
+    if(scene_cnt == MAX_SCENE_CNT) return;
+
+    scene_result_t * res = &results[scene_cnt];
+    res->name = scene->name;
+    res->start_us = lv_headless_display_get_time_us();
+    scene_cnt++;
+}
+
+static void end_cb(const lv_demo_benchmark_summary_t * summary)
+{
+    LV_UNUSED(summary);
+    scene_close();
+    finished = true;
+}
+
+static void scene_close(void)
+{
+    if(scene_cnt == 0) return;
+
+    scene_result_t * res = &results[scene_cnt - 1];
+    if(res->elaps_us == 0) res->elaps_us = lv_headless_display_get_time_us() - res->start_us;
+}
+
+static int compare_u32(const void * a, const void * b)
+{
+    uint32_t va = *(const uint32_t *)a;
+    uint32_t vb = *(const uint32_t *)b;
+    return va < vb ? -1 : (va > vb ? 1 : 0);
+}
+
+static uint32_t percentile(const uint32_t * sorted, uint32_t cnt, uint32_t p)
+{
+    if(cnt == 0) return 0;
+    uint32_t idx = (uint32_t)(((uint64_t)cnt * p + 99) / 100);
+    if(idx > 0) idx--;
+    return sorted[idx];
+}
+
+static void print_json(FILE * f)
+{
+    uint64_t total_frames = 0;
+    uint64_t total_elaps = 0;
+    uint64_t total_render = 0;
+
+    fprintf(f, "{\n");
+    fprintf(f, "  \"display\": {\"hor_res\": %d, \"ver_res\": %d, \"render_mode\": \"%s\", "
+            "\"latency_us\": %u, \"kbyte_per_sec\": %u, \"sink\": %s, \"force_invalidate\": %s},\n",
+            (int)hor_res, (int)ver_res, mode_name, latency_us, kbyte_per_sec,
+            sink ? "true" : "false", force_invalidate ? "true" : "false");
+    fprintf(f, "  \"scenes\": [\n");
+
+    for(int32_t i = 0; i < scene_cnt; i++) {
+        scene_result_t * res = &results[i];
+        uint32_t cnt = res->frame_cnt;
+        uint64_t render_sum = 0;
+        if(cnt) qsort(res->render_times, cnt, sizeof(uint32_t), compare_u32);
+        for(uint32_t j = 0; j < cnt; j++) render_sum += res->render_times[j];
+
+        total_frames += cnt;
+        total_elaps += res->elaps_us;
+        total_render += render_sum;
+
+        fprintf(f, "    {\"scene_name\": \"%s\", \"frames\": %u, \"fps\": %.1f, "
+                "\"render_time_us\": {\"avg\": %u, \"p50\": %u, \"p90\": %u, \"p99\": %u, \"max\": %u}, "
+                "\"flush_time_us_avg\": %u, \"draw_tasks_avg\": %.1f, \"flushed_px_avg\": %u}%s\n",
+                res->name, cnt,
+                res->elaps_us ? cnt * 1000000.0 / res->elaps_us : 0.0,
+                cnt ? (uint32_t)(render_sum / cnt) : 0,
+                percentile(res->render_times, cnt, 50),
+                percentile(res->render_times, cnt, 90),
+                percentile(res->render_times, cnt, 99),
+                cnt ? res->render_times[cnt - 1] : 0,
+                cnt ? (uint32_t)(res->flush_time_sum / cnt) : 0,
+                cnt ? (double)res->draw_task_sum / cnt : 0.0,
+                cnt ? (uint32_t)(res->flushed_px_sum / cnt) : 0,
+                i + 1 < scene_cnt ? "," : "");
+    }
+
+    fprintf(f, "  ],\n");
+    fprintf(f, "  \"total\": {\"frames\": %u, \"fps\": %.1f, \"render_time_us_avg\": %u}\n",
+            (uint32_t)total_frames,
+            total_elaps ? total_frames * 1000000.0 / total_elaps : 0.0,
+            total_frames ? (uint32_t)(total_render / total_frames) : 0);
+    fprintf(f, "}\n");
+}
@@ -43,6 +43,12 @@ static lv_cache_compare_res_t compare_cb(const test_data_t * lhs,
     return 0;
 }
 
+static uint32_t hash_cb(const test_data_t * key)
+{
+    uint32_t hash = lv_cache_hash_data(&key->key1, sizeof(key->key1), LV_CACHE_HASH_SEED);
+    return lv_cache_hash_data(&key->key2, sizeof(key->key2), hash);
+}
+
 static void free_cb(test_data_t * node, void * user_data)
 {
     LV_UNUSED(user_data);
@@ -56,6 +62,7 @@ static lv_cache_t * create_cache(const lv_cache_class_t * cache_class,
         .compare_cb = (lv_cache_compare_cb_t)compare_cb,
         .create_cb = NULL,
         .free_cb = (lv_cache_free_cb_t)free_cb,
+        .hash_cb = (lv_cache_hash_cb_t)hash_cb,
     };
     return lv_cache_create(cache_class, sizeof(test_data_t), max_size, ops);
 }
@@ -304,6 +311,134 @@ void test_cache_sc_da_eviction_second_chance_spares_referenced_entries(void)
     lv_cache_destroy(cache, NULL);
 }
 
+void test_cache_lru_shard_count_add_acquire(void)
+{
+    /*The entries are not evenly spread among the shards, leave room for all of them in each*/
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_shard_count,
+                                      CACHE_EXPECTED_DATA_CNT * LV_CACHE_SHARD_CNT);
+    test_data_t expected_data[CACHE_EXPECTED_DATA_CNT];
+    cache_add_acquire_test(cache, expected_data, CACHE_EXPECTED_DATA_CNT);
+    TEST_ASSERT_EQUAL(CACHE_EXPECTED_DATA_CNT, lv_cache_get_size(cache, NULL));
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_lru_shard_size_accounting(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_shard_size, CACHE_SIZE_BYTES * LV_CACHE_SHARD_CNT);
+    TEST_ASSERT_NOT_NULL(cache);
+    TEST_ASSERT_EQUAL(CACHE_SIZE_BYTES * LV_CACHE_SHARD_CNT, lv_cache_get_free_size(cache, NULL));
+
+    for(int32_t i = 0; i < CACHE_EXPECTED_DATA_CNT; i++) {
+        test_data_t key = { .slot.size = 10, .key1 = i, .key2 = -i };
+        lv_cache_entry_t * entry = lv_cache_add(cache, &key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        lv_cache_release(cache, entry, NULL);
+    }
+    TEST_ASSERT_EQUAL(10 * CACHE_EXPECTED_DATA_CNT, lv_cache_get_size(cache, NULL));
+
+    test_data_t key3 = { .key1 = 3, .key2 = -3 };
+    lv_cache_drop(cache, &key3, NULL);
+    TEST_ASSERT_NULL(lv_cache_acquire(cache, &key3, NULL));
+    TEST_ASSERT_EQUAL(10 * (CACHE_EXPECTED_DATA_CNT - 1), lv_cache_get_size(cache, NULL));
+
+    TEST_ASSERT_TRUE(lv_cache_evict_one(cache, NULL));
+    TEST_ASSERT_EQUAL(10 * (CACHE_EXPECTED_DATA_CNT - 2), lv_cache_get_size(cache, NULL));
+
+    /*All the remaining entries are visited once*/
+    uint32_t iter_cnt = 0;
+    lv_iter_t * iter = lv_cache_iter_create(cache);
+    TEST_ASSERT_NOT_NULL(iter);
+    void * elem = lv_malloc(lv_cache_entry_get_size(sizeof(test_data_t)));
+    while(lv_iter_next(iter, elem) == LV_RESULT_OK) iter_cnt++;
+    lv_iter_destroy(iter);
+    lv_free(elem);
+    TEST_ASSERT_EQUAL(CACHE_EXPECTED_DATA_CNT - 2, iter_cnt);
+
+    lv_cache_drop_all(cache, NULL);
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(cache, NULL));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_lru_shard_set_max_size(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_shard_count, 0);
+    TEST_ASSERT_NOT_NULL(cache);
+    TEST_ASSERT_FALSE(lv_cache_is_enabled(cache));
+
+    test_data_t key = { .key1 = 1, .key2 = 2 };
+    TEST_ASSERT_NULL(lv_cache_add(cache, &key, NULL));
+
+    lv_cache_set_max_size(cache, LV_CACHE_SHARD_CNT, NULL);
+    TEST_ASSERT_TRUE(lv_cache_is_enabled(cache));
+    lv_cache_entry_t * entry = lv_cache_add(cache, &key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    lv_cache_release(cache, entry, NULL);
+    TEST_ASSERT_EQUAL(LV_CACHE_SHARD_CNT - 1, lv_cache_get_free_size(cache, NULL));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_lru_ht_count_add_acquire(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_ht_count, CACHE_EXPECTED_DATA_CNT);
+    test_data_t expected_data[CACHE_EXPECTED_DATA_CNT];
+    cache_add_acquire_test(cache, expected_data, CACHE_EXPECTED_DATA_CNT);
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_lru_ht_count_eviction(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_ht_count, CACHE_EXPECTED_DATA_CNT);
+    test_data_t expected_data[CACHE_EXPECTED_DATA_CNT];
+    cache_eviction_test(cache, expected_data, CACHE_EXPECTED_DATA_CNT);
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_lru_ht_grow_and_drop(void)
+{
+    /*Enough entries to grow the table several times and to have collisions*/
+    const int32_t cnt = 500;
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_ht_count, cnt);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    for(int32_t i = 0; i < cnt; i++) {
+        test_data_t key = { .key1 = i, .key2 = i % 7 };
+        lv_cache_entry_t * entry = lv_cache_add(cache, &key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        lv_cache_release(cache, entry, NULL);
+    }
+    TEST_ASSERT_EQUAL(cnt, lv_cache_get_size(cache, NULL));
+
+    /*Dropping every third entry shifts the probe sequences back*/
+    for(int32_t i = 0; i < cnt; i += 3) {
+        test_data_t key = { .key1 = i, .key2 = i % 7 };
+        lv_cache_drop(cache, &key, NULL);
+    }
+
+    for(int32_t i = 0; i < cnt; i++) {
+        test_data_t key = { .key1 = i, .key2 = i % 7 };
+        lv_cache_entry_t * entry = lv_cache_acquire(cache, &key, NULL);
+        if(i % 3 == 0) {
+            TEST_ASSERT_NULL(entry);
+        }
+        else {
+            TEST_ASSERT_NOT_NULL(entry);
+            test_data_t * data = lv_cache_entry_get_data(entry);
+            TEST_ASSERT_EQUAL(i, data->key1);
+            lv_cache_release(cache, entry, NULL);
+        }
+    }
+    TEST_ASSERT_EQUAL(cnt - (cnt + 2) / 3, lv_cache_get_size(cache, NULL));
+
+    /*The least recently used entry is evicted first*/
+    TEST_ASSERT_TRUE(lv_cache_evict_one(cache, NULL));
+    test_data_t lru_key = { .key1 = 1, .key2 = 1 };
+    TEST_ASSERT_NULL(lv_cache_acquire(cache, &lru_key, NULL));
+
+    lv_cache_destroy(cache, NULL);
+}
+
 void test_cache_entry_alloc(void)
 {
     lv_cache_t * cache = create_cache(&lv_cache_class_lru_rb_size, CACHE_SIZE_BYTES);
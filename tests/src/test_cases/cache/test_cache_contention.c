@@ -0,0 +1,156 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+
+#include <time.h>
+
+#define THREAD_CNT          4
+#define KEY_CNT             256
+#define LOOKUPS_PER_THREAD  100000
+
+typedef struct {
+    int32_t key;
+    int32_t value;
+} test_data_t;
+
+typedef struct {
+    lv_cache_t * cache;
+    uint32_t seed;
+    uint32_t miss_cnt;
+    uint32_t mismatch_cnt;
+} worker_ctx_t;
+
+static lv_cache_compare_res_t compare_cb(const test_data_t * lhs, const test_data_t * rhs)
+{
+    if(lhs->key != rhs->key) return lhs->key > rhs->key ? 1 : -1;
+    return 0;
+}
+
+static uint32_t hash_cb(const test_data_t * key)
+{
+    return lv_cache_hash_data(&key->key, sizeof(key->key), LV_CACHE_HASH_SEED);
+}
+
+static void free_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(node);
+    LV_UNUSED(user_data);
+}
+
+static void worker_cb(void * user_data)
+{
+    worker_ctx_t * ctx = user_data;
+
+    for(uint32_t i = 0; i < LOOKUPS_PER_THREAD; i++) {
+        /*Xorshift to avoid sharing the state of rand() among the threads*/
+        ctx->seed ^= ctx->seed << 13;
+        ctx->seed ^= ctx->seed >> 17;
+        ctx->seed ^= ctx->seed << 5;
+
+        test_data_t search_key = { .key = (int32_t)(ctx->seed % KEY_CNT) };
+        lv_cache_entry_t * entry = lv_cache_acquire(ctx->cache, &search_key, NULL);
+        if(entry == NULL) {
+            ctx->miss_cnt++;
+            continue;
+        }
+
+        test_data_t * data = lv_cache_entry_get_data(entry);
+        if(data->value != search_key.key * 2) ctx->mismatch_cnt++;
+        lv_cache_release(ctx->cache, entry, NULL);
+    }
+}
+
+static uint32_t run_contention(const lv_cache_class_t * cache_class)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t)free_cb,
+        .hash_cb = (lv_cache_hash_cb_t)hash_cb,
+    };
+
+    /*Large enough so that nothing is evicted even if a shard gets more than its share of keys*/
+    lv_cache_t * cache = lv_cache_create(cache_class, sizeof(test_data_t), KEY_CNT * LV_CACHE_SHARD_CNT, ops);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    for(int32_t i = 0; i < KEY_CNT; i++) {
+        test_data_t data = { .key = i, .value = i * 2 };
+        lv_cache_entry_t * entry = lv_cache_add(cache, &data, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        lv_cache_release(cache, entry, NULL);
+    }
+
+    lv_thread_t threads[THREAD_CNT];
+    worker_ctx_t ctx[THREAD_CNT];
+
+    struct timespec start;
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for(uint32_t i = 0; i < THREAD_CNT; i++) {
+        ctx[i] = (worker_ctx_t) {
+            .cache = cache, .seed = 0x9E3779B9u * (i + 1)
+        };
+        lv_thread_init(&threads[i], "cache_worker", LV_THREAD_PRIO_MID, worker_cb, 8 * 1024, &ctx[i]);
+    }
+
+    for(uint32_t i = 0; i < THREAD_CNT; i++) {
+        lv_thread_delete(&threads[i]);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    for(uint32_t i = 0; i < THREAD_CNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, ctx[i].miss_cnt);
+        TEST_ASSERT_EQUAL_UINT32(0, ctx[i].mismatch_cnt);
+    }
+
+    /*Every reference has to be released*/
+    lv_iter_t * iter = lv_cache_iter_create(cache);
+    TEST_ASSERT_NOT_NULL(iter);
+    uint8_t * elem = lv_malloc(lv_cache_entry_get_size(sizeof(test_data_t)));
+    uint32_t entry_cnt = 0;
+    while(lv_iter_next(iter, elem) == LV_RESULT_OK) {
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(elem, sizeof(test_data_t));
+        TEST_ASSERT_EQUAL_INT32(0, lv_cache_entry_get_ref(entry));
+        entry_cnt++;
+    }
+    lv_iter_destroy(iter);
+    lv_free(elem);
+    TEST_ASSERT_EQUAL_UINT32(KEY_CNT, entry_cnt);
+
+    lv_cache_destroy(cache, NULL);
+
+    /*Elapsed time in microseconds*/
+    return (uint32_t)((end.tv_sec - start.tv_sec) * 1000000 + (end.tv_nsec - start.tv_nsec) / 1000);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_cache_contention_lru_rb(void)
+{
+    uint32_t us = run_contention(&lv_cache_class_lru_rb_count);
+    TEST_PRINTF("lru_rb: %d threads x %d lookups: %d us", THREAD_CNT, LOOKUPS_PER_THREAD, us);
+}
+
+void test_cache_contention_lru_shard(void)
+{
+    uint32_t us = run_contention(&lv_cache_class_lru_shard_count);
+    TEST_PRINTF("lru_shard (%d shards): %d threads x %d lookups: %d us", LV_CACHE_SHARD_CNT, THREAD_CNT,
+                LOOKUPS_PER_THREAD, us);
+}
+
+#endif /*LV_USE_OS == LV_OS_PTHREAD*/
+
+#endif
@@ -18,9 +18,12 @@
     #define REF_IMG_EXT ".png"
 #endif
 
+static lv_blur_quality_t blur_quality;
+
 void setUp(void)
 {
     /* Function run before every test */
+    blur_quality = LV_BLUR_QUALITY_AUTO;
     lv_obj_set_flex_flow(lv_screen_active(), LV_FLEX_FLOW_ROW_WRAP);
     lv_obj_set_flex_align(lv_screen_active(), LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_SPACE_EVENLY);
 }
@@ -62,6 +65,7 @@ static void small_canvas_render(const char * name_sub, lv_color_format_t cf, voi
     lv_draw_blur_dsc_init(&blur_dsc);
     blur_dsc.corner_radius = corner_radius;
     blur_dsc.blur_radius = blur_radius;
+    blur_dsc.quality = blur_quality;
 
     lv_area_t fill_coords = {25, 20, CANVAS_WIDTH - 25, CANVAS_HEIGHT - 20};
     lv_draw_blur(&layer, &blur_dsc, &fill_coords);
@@ -132,4 +136,34 @@ void test_blur(void)
     }
 }
 
+void test_blur_pyramid(void)
+{
+    static LV_ATTRIBUTE_MEM_ALIGN uint8_t canvas_buf[15][LV_TEST_WIDTH_TO_STRIDE(CANVAS_WIDTH,
+                                                                                 4) * CANVAS_HEIGHT + LV_DRAW_BUF_ALIGN];
+    uint32_t corner_radius_options[2] = {0, 16};
+    int32_t blur_radius_options[3] = {12, 24, 60};
+    uint32_t r;
+    uint32_t b;
+
+    blur_quality = LV_BLUR_QUALITY_PYRAMID;
+
+    for(r = 0; r < 2; r++) {
+        lv_obj_clean(lv_screen_active());
+
+        uint32_t radius_current = corner_radius_options[r];
+        for(b = 0; b < 3; b++) {
+            int32_t blur_current = blur_radius_options[b];
+            small_canvas_render("l8", LV_COLOR_FORMAT_L8, canvas_buf[b * 5 + 0], blur_current, radius_current);
+            small_canvas_render("rgb565", LV_COLOR_FORMAT_RGB565, canvas_buf[b * 5 + 1], blur_current, radius_current);
+            small_canvas_render("rgb888", LV_COLOR_FORMAT_RGB888, canvas_buf[b * 5 + 2], blur_current, radius_current);
+            small_canvas_render("xrgb8888", LV_COLOR_FORMAT_XRGB8888, canvas_buf[b * 5 + 3], blur_current, radius_current);
+            small_canvas_render("argb8888", LV_COLOR_FORMAT_ARGB8888, canvas_buf[b * 5 + 4], blur_current, radius_current);
+        }
+
+        char buf[128];
+        lv_snprintf(buf, sizeof(buf), "draw/draw_blur_pyramid_corner_%u" REF_IMG_EXT, radius_current);
+        TEST_ASSERT_EQUAL_SCREENSHOT(buf);
+    }
+}
+
 #endif
@@ -0,0 +1,144 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static uint32_t draw_main_cnt;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    draw_main_cnt = 0;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+    TEST_ASSERT_EQUAL_UINT32(0, LV_GLOBAL_DEFAULT()->retained_layer_memory);
+}
+
+static void draw_main_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    draw_main_cnt++;
+}
+
+static lv_obj_t * panel_create(int32_t w, int32_t h, lv_obj_t ** label_out)
+{
+    lv_obj_t * panel = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(panel, w, h);
+    lv_obj_center(panel);
+    lv_obj_set_style_bg_color(panel, lv_palette_lighten(LV_PALETTE_BLUE, 4), 0);
+    /*Keep the panel opaque so that the bitmap blends exactly like the normal rendering*/
+    lv_obj_set_style_radius(panel, 0, 0);
+
+    lv_obj_t * button = lv_button_create(panel);
+    lv_obj_set_size(button, lv_pct(80), 50);
+    lv_obj_align(button, LV_ALIGN_TOP_MID, 0, 0);
+    lv_obj_add_event_cb(button, draw_main_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    lv_obj_t * label = lv_label_create(panel);
+    lv_label_set_text(label, "Retained layer");
+    lv_obj_align(label, LV_ALIGN_BOTTOM_MID, 0, 0);
+
+    if(label_out) *label_out = label;
+    return panel;
+}
+
+void test_draw_retained_layer_same_as_normal(void)
+{
+    lv_obj_t * label;
+    lv_obj_t * panel = panel_create(240, 160, &label);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/retained_layer_1.png");
+
+    lv_obj_set_retained_layer(panel, true);
+    TEST_ASSERT_TRUE(lv_obj_is_retained_layer(panel));
+    TEST_ASSERT_EQUAL(LV_LAYER_TYPE_RETAINED, lv_obj_get_layer_type(panel));
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/retained_layer_1.png");
+    TEST_ASSERT_NOT_NULL(panel->spec_attr->layer_cache);
+    TEST_ASSERT_NOT_EQUAL(0, LV_GLOBAL_DEFAULT()->retained_layer_memory);
+
+    /*Redrawing the area around the panel doesn't render its children again*/
+    draw_main_cnt = 0;
+    lv_obj_invalidate(lv_screen_active());
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/retained_layer_1.png");
+    TEST_ASSERT_EQUAL_UINT32(0, draw_main_cnt);
+
+    lv_obj_set_retained_layer(panel, false);
+    TEST_ASSERT_NULL(panel->spec_attr->layer_cache);
+    TEST_ASSERT_EQUAL(LV_LAYER_TYPE_NONE, lv_obj_get_layer_type(panel));
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/retained_layer_1.png");
+}
+
+void test_draw_retained_layer_invalidated_by_child(void)
+{
+    lv_obj_t * label;
+    lv_obj_t * panel = panel_create(240, 160, &label);
+    lv_obj_set_retained_layer(panel, true);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(panel->spec_attr->layer_cache);
+
+    lv_label_set_text(label, "Changed text");
+    TEST_ASSERT_NULL(panel->spec_attr->layer_cache);
+
+    draw_main_cnt = 0;
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(panel->spec_attr->layer_cache);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_main_cnt);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/retained_layer_2.png");
+
+    lv_obj_set_retained_layer(panel, false);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/retained_layer_2.png");
+}
+
+void test_draw_retained_layer_scroll_parent(void)
+{
+    lv_obj_t * panel = panel_create(240, 160, NULL);
+    lv_obj_set_retained_layer(panel, true);
+    lv_obj_align(panel, LV_ALIGN_TOP_MID, 0, 400);
+    lv_refr_now(NULL);
+
+    /*Scrolling moves the bitmap without rendering it again*/
+    lv_draw_buf_t * draw_buf = panel->spec_attr->layer_cache;
+    TEST_ASSERT_NOT_NULL(draw_buf);
+    draw_main_cnt = 0;
+    lv_obj_scroll_by(lv_screen_active(), 0, -100, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_PTR(draw_buf, panel->spec_attr->layer_cache);
+    TEST_ASSERT_EQUAL_UINT32(0, draw_main_cnt);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/retained_layer_3.png");
+
+    lv_obj_set_retained_layer(panel, false);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/retained_layer_3.png");
+}
+
+void test_draw_retained_layer_over_budget(void)
+{
+    /*Larger than LV_DRAW_LAYER_RETAINED_MAX_MEMORY so it's rendered normally*/
+    lv_obj_t * panel = panel_create(400, 400, NULL);
+    lv_obj_set_style_opa_layered(panel, LV_OPA_50, 0);
+    lv_obj_set_retained_layer(panel, true);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/retained_layer_4.png");
+    TEST_ASSERT_NULL(panel->spec_attr->layer_cache);
+    TEST_ASSERT_EQUAL_UINT32(0, LV_GLOBAL_DEFAULT()->retained_layer_memory);
+
+    lv_obj_set_retained_layer(panel, false);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/retained_layer_4.png");
+}
+
+void test_draw_retained_layer_delete(void)
+{
+    lv_obj_t * panel = panel_create(240, 160, NULL);
+    lv_obj_set_retained_layer(panel, true);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_EQUAL(0, LV_GLOBAL_DEFAULT()->retained_layer_memory);
+
+    lv_obj_delete(panel);
+    TEST_ASSERT_EQUAL_UINT32(0, LV_GLOBAL_DEFAULT()->retained_layer_memory);
+}
+
+#endif
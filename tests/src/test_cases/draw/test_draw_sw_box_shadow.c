@@ -0,0 +1,62 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+#if LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_SIZE
+    lv_cache_drop_all(LV_GLOBAL_DEFAULT()->sw_shadow_cache, NULL);
+#endif
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static lv_obj_t * card_create(int32_t w, int32_t h, int32_t shadow_width, int32_t spread, int32_t radius)
+{
+    lv_obj_t * card = lv_obj_create(lv_screen_active());
+    lv_obj_set_scrollable(card, false);
+    lv_obj_set_size(card, w, h);
+    lv_obj_set_style_radius(card, radius, 0);
+    lv_obj_set_style_shadow_width(card, shadow_width, 0);
+    lv_obj_set_style_shadow_spread(card, spread, 0);
+    lv_obj_set_style_shadow_offset_y(card, 4, 0);
+    lv_obj_set_style_shadow_color(card, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_obj_set_style_shadow_opa(card, LV_OPA_70, 0);
+    return card;
+}
+
+void test_draw_sw_box_shadow_cache(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_style_pad_all(scr, 40, 0);
+    lv_obj_set_style_pad_gap(scr, 50, 0);
+
+    /*2 distinct shadow corners. The spread only makes the core area larger
+     *so the cards with spread can use the same corner too.*/
+    uint32_t i;
+    for(i = 0; i < 4; i++) card_create(120, 80, 30, 0, 12);
+    for(i = 0; i < 3; i++) card_create(120, 80, 30, 6, 12);
+    for(i = 0; i < 2; i++) card_create(60, 40, 16, 0, LV_RADIUS_CIRCLE);
+
+    /*The first rendering fills the cache, the second is drawn from it*/
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_box_shadow_cache.png");
+#if LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_SIZE
+    TEST_ASSERT_EQUAL(2, lv_cache_get_size(LV_GLOBAL_DEFAULT()->sw_shadow_cache, NULL));
+#endif
+
+    lv_obj_invalidate(scr);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_box_shadow_cache.png");
+#if LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_SIZE
+    TEST_ASSERT_EQUAL(2, lv_cache_get_size(LV_GLOBAL_DEFAULT()->sw_shadow_cache, NULL));
+#endif
+}
+
+#endif
@@ -0,0 +1,87 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+#if LV_USE_DRAW_SW && LV_DRAW_SW_GRAD_CACHE_CNT
+    lv_cache_drop_all(LV_GLOBAL_DEFAULT()->sw_grad_cache, NULL);
+#endif
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static lv_obj_t * card_create(const lv_grad_dsc_t * grad)
+{
+    lv_obj_t * card = lv_obj_create(lv_screen_active());
+    lv_obj_set_scrollable(card, false);
+    lv_obj_set_size(card, 120, 80);
+    lv_obj_set_style_radius(card, 12, 0);
+    lv_obj_set_style_bg_grad(card, grad, 0);
+    return card;
+}
+
+void test_draw_sw_grad_cache(void)
+{
+    static const lv_color_t colors[2] = {
+        LV_COLOR_MAKE(0xff, 0x00, 0x00),
+        LV_COLOR_MAKE(0x00, 0x00, 0xff),
+    };
+    static const lv_opa_t opas[2] = {LV_OPA_COVER, LV_OPA_50};
+
+    static lv_grad_dsc_t hor_grad;
+    lv_grad_init_stops(&hor_grad, colors, opas, NULL, 2);
+    lv_grad_horizontal_init(&hor_grad);
+
+    static lv_grad_dsc_t ver_grad;
+    lv_grad_init_stops(&ver_grad, colors, opas, NULL, 2);
+    lv_grad_vertical_init(&ver_grad);
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_style_pad_all(scr, 30, 0);
+    lv_obj_set_style_pad_gap(scr, 30, 0);
+
+    /*The color maps depend only on the stops and the length, so all the
+     *horizontal and all the vertical gradients share a color map.*/
+    uint32_t i;
+    for(i = 0; i < 6; i++) card_create(&hor_grad);
+    for(i = 0; i < 3; i++) card_create(&ver_grad);
+    uint32_t expected_cnt = 2;
+
+#if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
+    /*The complex gradients share a 256 long color map regardless of their parameters*/
+    static lv_grad_dsc_t linear_grad;
+    lv_grad_init_stops(&linear_grad, colors, opas, NULL, 2);
+    lv_grad_linear_init(&linear_grad, 0, 0, lv_pct(100), lv_pct(100), LV_GRAD_EXTEND_PAD);
+
+    static lv_grad_dsc_t radial_grad;
+    lv_grad_init_stops(&radial_grad, colors, opas, NULL, 2);
+    lv_grad_radial_init(&radial_grad, lv_pct(50), lv_pct(50), lv_pct(100), lv_pct(50), LV_GRAD_EXTEND_REFLECT);
+
+    for(i = 0; i < 3; i++) card_create(&linear_grad);
+    for(i = 0; i < 3; i++) card_create(&radial_grad);
+    expected_cnt++;
+#endif
+
+    /*The first rendering fills the cache, the second is drawn from it*/
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_grad_cache.png");
+#if LV_USE_DRAW_SW && LV_DRAW_SW_GRAD_CACHE_CNT
+    TEST_ASSERT_EQUAL(expected_cnt, lv_cache_get_size(LV_GLOBAL_DEFAULT()->sw_grad_cache, NULL));
+#endif
+
+    lv_obj_invalidate(scr);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_grad_cache.png");
+#if LV_USE_DRAW_SW && LV_DRAW_SW_GRAD_CACHE_CNT
+    TEST_ASSERT_EQUAL(expected_cnt, lv_cache_get_size(LV_GLOBAL_DEFAULT()->sw_grad_cache, NULL));
+#endif
+}
+
+#endif
@@ -121,6 +121,32 @@ void test_bin_decoder_bin_file(void)
 {
     bin_decoder("A:src/test_files/binimages/cogwheel.ARGB8888.bin", "libs/cogwheel.ARGB8888.png");
 }
+void test_bin_decoder_mapped_file(void)
+{
+    /*Save an image with the stride the draw units expect*/
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(100, 60, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    TEST_ASSERT_NOT_NULL(draw_buf);
+    for(uint32_t i = 0; i < draw_buf->data_size; i++) draw_buf->data[i] = (uint8_t)(i * 7);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_draw_buf_save_to_file(draw_buf, "A:src/test_files/bin_decoder_mapped.bin"));
+
+    /*'B' can map the files so the pixels are used from the mapping directly*/
+    const char * src = "B:src/test_files/bin_decoder_mapped.bin";
+    size_t mem_before = lv_test_get_free_mem();
+    lv_image_decoder_dsc_t decoder_dsc;
+    lv_image_decoder_args_t args = { .stride_align = true };
+    lv_result_t res = lv_image_decoder_open(&decoder_dsc, src, &args);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, res);
+    TEST_ASSERT_NOT_NULL(decoder_dsc.decoded);
+    TEST_ASSERT_NULL(decoder_dsc.cache_entry);
+    TEST_ASSERT_FALSE(lv_draw_buf_has_flag((lv_draw_buf_t *)decoder_dsc.decoded, LV_IMAGE_FLAGS_MODIFIABLE));
+    TEST_ASSERT_EQUAL_UINT32(draw_buf->header.stride, decoder_dsc.decoded->header.stride);
+    TEST_ASSERT_EQUAL_MEMORY(draw_buf->data, decoder_dsc.decoded->data, draw_buf->header.stride * 60);
+    lv_image_decoder_close(&decoder_dsc);
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
+
+    lv_draw_buf_destroy(draw_buf);
+}
+
 void test_bin_decoder_image_dsc_error_handling(void)
 {
     lv_image_dsc_t * image_dsc = get_image_dsc();
@@ -327,6 +327,97 @@ void test_freetype_no_kerning_info(void)
     lv_freetype_font_delete(font);
 }
 
+void test_freetype_atlas(void)
+{
+    const char * atlas_path = "A:src/test_files/freetype_atlas.bin";
+    const char * font_path = "./src/test_files/fonts/Montserrat-Bold.ttf";
+
+    lv_font_t * font = lv_freetype_font_create(font_path, LV_FREETYPE_FONT_RENDER_MODE_BITMAP, 24,
+                                               LV_FREETYPE_FONT_STYLE_NORMAL);
+    TEST_ASSERT_NOT_NULL(font);
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_width(label, lv_obj_get_width(lv_screen_active()) - 20);
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, UNIVERSAL_DECLARATION_OF_HUMAN_RIGHTS_EN);
+
+    /*Render the text to fill the caches and save them*/
+    lv_refr_now(NULL);
+    const lv_freetype_font_dsc_t * dsc = font->dsc;
+    size_t glyph_cnt = lv_cache_get_size(dsc->cache_node->glyph_cache, NULL);
+    size_t image_cnt = lv_cache_get_size(dsc->cache_node->draw_data_cache, NULL);
+    TEST_ASSERT_GREATER_THAN(0, image_cnt);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_freetype_font_save_atlas(font, atlas_path));
+
+    /*Deleting the last font of the face drops its caches*/
+    lv_obj_delete(label);
+    lv_freetype_font_delete(font);
+
+    font = lv_freetype_font_create(font_path, LV_FREETYPE_FONT_RENDER_MODE_BITMAP, 24, LV_FREETYPE_FONT_STYLE_NORMAL);
+    dsc = font->dsc;
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(dsc->cache_node->draw_data_cache, NULL));
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_freetype_font_load_atlas(font, atlas_path));
+    TEST_ASSERT_EQUAL(glyph_cnt, lv_cache_get_size(dsc->cache_node->glyph_cache, NULL));
+    TEST_ASSERT_EQUAL(image_cnt, lv_cache_get_size(dsc->cache_node->draw_data_cache, NULL));
+
+    /*Rendering the same text shouldn't rasterize new glyphs*/
+    label = lv_label_create(lv_screen_active());
+    lv_obj_set_width(label, lv_obj_get_width(lv_screen_active()) - 20);
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, UNIVERSAL_DECLARATION_OF_HUMAN_RIGHTS_EN);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(image_cnt, lv_cache_get_size(dsc->cache_node->draw_data_cache, NULL));
+
+    /*The atlas can't be used with other sizes or styles*/
+    lv_font_t * font_small = lv_freetype_font_create(font_path, LV_FREETYPE_FONT_RENDER_MODE_BITMAP, 12,
+                                                     LV_FREETYPE_FONT_STYLE_NORMAL);
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_freetype_font_load_atlas(font_small, atlas_path));
+    lv_font_t * font_bold = lv_freetype_font_create(font_path, LV_FREETYPE_FONT_RENDER_MODE_BITMAP, 24,
+                                                    LV_FREETYPE_FONT_STYLE_BOLD);
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_freetype_font_load_atlas(font_bold, atlas_path));
+
+    lv_obj_delete(label);
+    lv_freetype_font_delete(font_small);
+    lv_freetype_font_delete(font_bold);
+    lv_freetype_font_delete(font);
+}
+
+void test_freetype_outline_prefetch(void)
+{
+    lv_font_t * font = lv_freetype_font_create("./src/test_files/fonts/Montserrat-Bold.ttf",
+                                               LV_FREETYPE_FONT_RENDER_MODE_OUTLINE, 32,
+                                               LV_FREETYPE_FONT_STYLE_NORMAL);
+    TEST_ASSERT_NOT_NULL(font);
+    const lv_freetype_font_dsc_t * dsc = font->dsc;
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, "Hello LVGL");
+
+    /*Each distinct glyph of the label is rasterized once: H, e, l, o, L, V, G*/
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(7, lv_cache_get_size(dsc->cache_node->draw_data_cache, NULL));
+
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, 'V', 0));
+    TEST_ASSERT_TRUE(lv_freetype_outline_is_cached(font, g.gid.index));
+
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, 'Z', 0));
+    TEST_ASSERT_FALSE(lv_freetype_outline_is_cached(font, g.gid.index));
+    TEST_ASSERT_TRUE(lv_freetype_outline_prefetch(font, g.gid.index));
+    TEST_ASSERT_TRUE(lv_freetype_outline_is_cached(font, g.gid.index));
+    TEST_ASSERT_EQUAL(8, lv_cache_get_size(dsc->cache_node->draw_data_cache, NULL));
+
+    /*The cached outlines are reused*/
+    lv_label_set_text(label, "Hello LVGL Z");
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(8, lv_cache_get_size(dsc->cache_node->draw_data_cache, NULL));
+
+    lv_obj_delete(label);
+    lv_freetype_font_delete(font);
+}
+
 #else
 
 void setUp(void)
@@ -357,6 +448,14 @@ void test_freetype_no_kerning_info(void)
 {
 }
 
+void test_freetype_atlas(void)
+{
+}
+
+void test_freetype_outline_prefetch(void)
+{
+}
+
 #endif /*LV_USE_FREETYPE*/
 
 #endif
@@ -49,12 +49,12 @@ void test_svg_decoder(void)
     TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
 }
 
-static void svg_decoder_file(void)
+static void svg_decoder_file(const char * src)
 {
     lv_obj_t * img = lv_image_create(lv_screen_active());
     lv_obj_set_size(img, lv_pct(100), lv_pct(100));
     lv_obj_set_style_outline_width(img, 4, 0);
-    lv_image_set_src(img, "A:src/test_assets/test_img_svg_tiger.svg");
+    lv_image_set_src(img, src);
     lv_image_set_scale(img, 96);
     lv_obj_align(img, LV_ALIGN_CENTER, 0, 0);
     assert_screenshot("svg_decoder_2");
@@ -65,9 +65,18 @@ static void svg_decoder_file(void)
 
 void test_svg_decoder_file(void)
 {
-    svg_decoder_file();
+    svg_decoder_file("A:src/test_assets/test_img_svg_tiger.svg");
     size_t mem_before = lv_test_get_free_mem();
-    svg_decoder_file();
+    svg_decoder_file("A:src/test_assets/test_img_svg_tiger.svg");
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
+}
+
+void test_svg_decoder_mapped_file(void)
+{
+    /*'B' can map the file so it's parsed without reading it to a buffer*/
+    svg_decoder_file("B:src/test_assets/test_img_svg_tiger.svg");
+    size_t mem_before = lv_test_get_free_mem();
+    svg_decoder_file("B:src/test_assets/test_img_svg_tiger.svg");
     TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
 }
 
@@ -100,4 +109,43 @@ void test_svg_snapshot(void)
     TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
 }
 
+#if LV_SVG_RASTER_CACHE_CNT
+static void svg_raster_cache(void)
+{
+    LV_IMAGE_DECLARE(test_image_svg);
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, &test_image_svg);
+    lv_image_set_rotation(img, 300);
+    lv_obj_center(img);
+
+    /*The first snapshot renders the bitmap, the second one is drawn from the cache*/
+    lv_draw_buf_t * first = lv_snapshot_take(img, LV_COLOR_FORMAT_ARGB8888);
+    lv_draw_buf_t * second = lv_snapshot_take(img, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(first);
+    TEST_ASSERT_NOT_NULL(second);
+    TEST_ASSERT_EQUAL_MEMORY(first->data, second->data, first->data_size);
+    lv_draw_buf_destroy(first);
+    lv_draw_buf_destroy(second);
+
+    /*Release the bitmaps kept for the draw tasks*/
+    lv_refr_now(NULL);
+
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(NULL);
+}
+
+#endif
+
+void test_svg_raster_cache(void)
+{
+#if LV_SVG_RASTER_CACHE_CNT
+    svg_raster_cache();
+    size_t mem_before = lv_test_get_free_mem();
+    svg_raster_cache();
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
+#else
+    TEST_IGNORE_MESSAGE("Ignoring test_svg_raster_cache as it requires LV_SVG_RASTER_CACHE_CNT > 0");
+#endif
+}
+
 #endif
@@ -62,6 +62,63 @@ void test_tiny_ttf_rendering_test(void)
 #endif
 }
 
+void test_tiny_ttf_atlas(void)
+{
+#if LV_USE_TINY_TTF
+    extern const uint8_t test_ubuntu_font[];
+    extern size_t test_ubuntu_font_size;
+    const char * atlas_path = "A:src/test_files/tiny_ttf_atlas.bin";
+
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_text_align(&style, LV_TEXT_ALIGN_CENTER);
+    lv_style_set_bg_opa(&style, LV_OPA_COVER);
+    lv_style_set_bg_color(&style, lv_color_hex(0xffaaaa));
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_add_style(label, &style, 0);
+    lv_label_set_text(label, "Hello world\n"
+                      "I'm a font created with Tiny TTF\n"
+                      "Accents: ÁÉÍÓÖŐÜŰ áéíóöőüű");
+    lv_obj_center(label);
+
+    /*Render the text to fill the caches and save them*/
+    lv_font_t * font = lv_tiny_ttf_create_data(test_ubuntu_font, test_ubuntu_font_size, 30);
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_tiny_ttf_save_atlas(font, atlas_path));
+    lv_obj_set_style_text_font(label, LV_FONT_DEFAULT, 0);
+    lv_tiny_ttf_destroy(font);
+
+    /*A new font with the atlas should render the same*/
+    font = lv_tiny_ttf_create_data(test_ubuntu_font, test_ubuntu_font_size, 30);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_tiny_ttf_load_atlas(font, atlas_path));
+    lv_obj_set_style_text_font(label, font, 0);
+
+#ifndef NON_AMD64_BUILD
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/tiny_ttf_1.png");
+#endif
+
+    /*The atlas can't be used with other sizes or fonts*/
+    lv_font_t * font_small = lv_tiny_ttf_create_data(test_ubuntu_font, test_ubuntu_font_size, 20);
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_tiny_ttf_load_atlas(font_small, atlas_path));
+    lv_tiny_ttf_destroy(font_small);
+
+    extern const uint8_t test_kern_one_otf[];
+    extern size_t test_kern_one_otf_size;
+    lv_font_t * font_other = lv_tiny_ttf_create_data(test_kern_one_otf, test_kern_one_otf_size, 30);
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_tiny_ttf_load_atlas(font_other, atlas_path));
+    lv_tiny_ttf_destroy(font_other);
+
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_tiny_ttf_load_atlas(font, "A:src/test_files/not_exist.bin"));
+
+    lv_obj_delete(label);
+    lv_tiny_ttf_destroy(font);
+#else
+    TEST_PASS();
+#endif
+}
+
 void test_tiny_ttf_kerning(void)
 {
 #if LV_USE_TINY_TTF
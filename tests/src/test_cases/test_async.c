@@ -1,5 +1,6 @@
 #if LV_BUILD_TEST
 #include "../lvgl.h"
+#include "../../lvgl_private.h"
 #include "unity/unity.h"
 
 static void * test_cb_data = NULL;
@@ -36,4 +37,238 @@ void test_async_call_basic_functionality(void)
     TEST_ASSERT_EQUAL(test_user_data, test_cb_data);
 }
 
+#if LV_ASYNC_QUEUE_SIZE > 0
+
+#define PRODUCER_CNT        2
+#define POSTS_PER_PRODUCER  5000
+
+static uint32_t post_order[LV_ASYNC_QUEUE_SIZE + 1];
+static uint32_t post_cnt;
+static uint32_t notify_cnt;
+static uint32_t producer_last_seq[PRODUCER_CNT];
+static uint32_t producer_order_error_cnt;
+
+static void post_cb(void * user_data)
+{
+    post_order[post_cnt] = (uint32_t)(uintptr_t)user_data;
+    post_cnt++;
+}
+
+static void post_again_cb(void * user_data)
+{
+    post_cnt++;
+    lv_async_post(post_cb, user_data);
+}
+
+static void producer_post_cb(void * user_data)
+{
+    /*The producer ID is in the top bits, the sequence number in the others*/
+    uint32_t v = (uint32_t)(uintptr_t)user_data;
+    uint32_t id = v >> 16;
+    uint32_t seq = v & 0xffff;
+    if(seq != producer_last_seq[id] + 1) producer_order_error_cnt++;
+    producer_last_seq[id] = seq;
+    post_cnt++;
+}
+
+static void observer_cb(lv_observer_t * observer, lv_subject_t * subject)
+{
+    LV_UNUSED(observer);
+    LV_UNUSED(subject);
+    notify_cnt++;
+}
+
+static void reset_queue_test(void)
+{
+    lv_memzero(post_order, sizeof(post_order));
+    lv_memzero(producer_last_seq, sizeof(producer_last_seq));
+    post_cnt = 0;
+    notify_cnt = 0;
+    producer_order_error_cnt = 0;
+}
+
+void test_async_post_order(void)
+{
+    reset_queue_test();
+    TEST_ASSERT_EQUAL_INT32(LV_RESULT_OK, lv_async_post(post_cb, (void *)1));
+    TEST_ASSERT_EQUAL_INT32(LV_RESULT_OK, lv_async_post(post_cb, (void *)2));
+    TEST_ASSERT_EQUAL_INT32(LV_RESULT_OK, lv_async_post(post_cb, (void *)3));
+    TEST_ASSERT_EQUAL_UINT32(0, post_cnt);
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, post_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, post_order[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, post_order[1]);
+    TEST_ASSERT_EQUAL_UINT32(3, post_order[2]);
+}
+
+void test_async_post_back_pressure(void)
+{
+    reset_queue_test();
+    uint32_t i;
+    for(i = 0; i < LV_ASYNC_QUEUE_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT32(LV_RESULT_OK, lv_async_post(post_cb, (void *)(uintptr_t)i));
+    }
+    TEST_ASSERT_EQUAL_INT32(LV_RESULT_INVALID, lv_async_post(post_cb, (void *)(uintptr_t)i));
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(LV_ASYNC_QUEUE_SIZE, post_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_ASYNC_QUEUE_SIZE - 1, post_order[LV_ASYNC_QUEUE_SIZE - 1]);
+    TEST_ASSERT_EQUAL_INT32(LV_RESULT_OK, lv_async_post(post_cb, NULL));
+    lv_timer_handler();
+}
+
+void test_async_post_from_callback(void)
+{
+    reset_queue_test();
+    lv_async_post(post_again_cb, (void *)1);
+
+    /*Posted by the callback, so it's called only in the next round*/
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, post_cnt);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, post_cnt);
+}
+
+void test_async_post_cancel(void)
+{
+    reset_queue_test();
+    lv_async_post(post_cb, (void *)1);
+    lv_async_post(post_cb, (void *)2);
+    TEST_ASSERT_EQUAL_INT32(LV_RESULT_OK, lv_async_call_cancel(post_cb, (void *)1));
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, post_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, post_order[0]);
+}
+
+void test_async_subject_set_int_coalesce(void)
+{
+    reset_queue_test();
+    lv_subject_t subject;
+    lv_subject_init_int(&subject, 0);
+    lv_subject_add_observer(&subject, observer_cb, NULL);
+    notify_cnt = 0;
+
+    TEST_ASSERT_EQUAL_INT32(LV_RESULT_OK, lv_async_subject_set_int(&subject, 1));
+    TEST_ASSERT_EQUAL_INT32(LV_RESULT_OK, lv_async_subject_set_int(&subject, 2));
+    TEST_ASSERT_EQUAL_INT32(LV_RESULT_OK, lv_async_subject_set_int(&subject, 3));
+    TEST_ASSERT_EQUAL_INT32(0, lv_subject_get_int(&subject));
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_INT32(3, lv_subject_get_int(&subject));
+    TEST_ASSERT_EQUAL_UINT32(1, notify_cnt);
+
+    /*Dropped if the Subject is deinitialized meanwhile*/
+    lv_async_subject_set_int(&subject, 4);
+    lv_subject_deinit(&subject);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_INT32(3, lv_subject_get_int(&subject));
+}
+
+#if LV_USE_OS == LV_OS_PTHREAD
+
+static void producer_thread_cb(void * user_data)
+{
+    uint32_t id = (uint32_t)(uintptr_t)user_data;
+    uint32_t seq;
+    for(seq = 1; seq <= POSTS_PER_PRODUCER; seq++) {
+        void * data = (void *)(uintptr_t)((id << 16) | seq);
+        while(lv_async_post(producer_post_cb, data) != LV_RESULT_OK) {}
+    }
+}
+
+static void subject_thread_cb(void * user_data)
+{
+    lv_subject_t * subject = user_data;
+    int32_t v;
+    for(v = 1; v <= POSTS_PER_PRODUCER; v++) {
+        while(lv_async_subject_set_int(subject, v) != LV_RESULT_OK) {}
+    }
+}
+
+void test_async_post_from_threads(void)
+{
+    reset_queue_test();
+    lv_thread_t threads[PRODUCER_CNT];
+    uint32_t i;
+    for(i = 0; i < PRODUCER_CNT; i++) {
+        lv_thread_init(&threads[i], "producer", LV_THREAD_PRIO_MID, producer_thread_cb, 8 * 1024, (void *)(uintptr_t)i);
+    }
+
+    while(post_cnt < PRODUCER_CNT * POSTS_PER_PRODUCER) {
+        lv_timer_handler();
+    }
+
+    for(i = 0; i < PRODUCER_CNT; i++) {
+        lv_thread_delete(&threads[i]);
+        TEST_ASSERT_EQUAL_UINT32(POSTS_PER_PRODUCER, producer_last_seq[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, producer_order_error_cnt);
+}
+
+void test_async_subject_set_int_from_thread(void)
+{
+    reset_queue_test();
+    lv_subject_t subject;
+    lv_subject_init_int(&subject, 0);
+    lv_subject_add_observer(&subject, observer_cb, NULL);
+    notify_cnt = 0;
+
+    lv_thread_t thread;
+    lv_thread_init(&thread, "producer", LV_THREAD_PRIO_MID, subject_thread_cb, 8 * 1024, &subject);
+    while(lv_subject_get_int(&subject) != POSTS_PER_PRODUCER) {
+        lv_timer_handler();
+    }
+    lv_thread_delete(&thread);
+
+    /*Never more notifications than updates, usually a lot less*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(POSTS_PER_PRODUCER, notify_cnt);
+    lv_subject_deinit(&subject);
+}
+
+#else
+
+void test_async_post_from_threads(void)
+{
+}
+
+void test_async_subject_set_int_from_thread(void)
+{
+}
+
+#endif /*LV_USE_OS == LV_OS_PTHREAD*/
+
+#else
+
+void test_async_post_order(void)
+{
+}
+
+void test_async_post_back_pressure(void)
+{
+}
+
+void test_async_post_from_callback(void)
+{
+}
+
+void test_async_post_cancel(void)
+{
+}
+
+void test_async_subject_set_int_coalesce(void)
+{
+}
+
+void test_async_post_from_threads(void)
+{
+}
+
+void test_async_subject_set_int_from_thread(void)
+{
+}
+
+#endif /*LV_ASYNC_QUEUE_SIZE > 0*/
+
 #endif
@@ -11,6 +11,7 @@
 #include "../../lvgl.h"
 
 #include "unity/unity.h"
+#include <time.h>
 
 /*********************
  *      DEFINES
@@ -25,9 +26,14 @@
  **********************/
 
 static int compare_fonts(lv_font_t * f1, lv_font_t * f2);
+static uint32_t get_time_us(void);
 void test_font_loader_with_cache(void);
 void test_font_loader_no_cache(void);
 void test_font_loader_from_buffer(void);
+void test_font_loader_streaming_with_cache(void);
+void test_font_loader_streaming_mapped(void);
+void test_font_loader_streaming_from_buffer(void);
+void test_font_loader_streaming_memory(void);
 
 /**********************
  *  STATIC VARIABLES
@@ -145,6 +151,102 @@ void test_font_loader_from_buffer(void)
     common();
 }
 
+void test_font_loader_streaming_with_cache(void)
+{
+    /*'A' can't map the files so the bitmaps are read into the glyph cache*/
+
+    font_1_bin = lv_binfont_create_streaming("A:src/test_assets/test_font_1.fnt", 8);
+    TEST_ASSERT_NOT_NULL(font_1_bin);
+
+    font_2_bin = lv_binfont_create_streaming("A:src/test_assets/test_font_2.fnt", 8);
+    TEST_ASSERT_NOT_NULL(font_2_bin);
+
+    font_3_bin = lv_binfont_create_streaming("A:src/test_assets/test_font_3.fnt", 8);
+    TEST_ASSERT_NOT_NULL(font_3_bin);
+
+    common();
+}
+
+void test_font_loader_streaming_mapped(void)
+{
+    /*'B' can map the files so the bitmaps are used from the mapped memory*/
+
+    font_1_bin = lv_binfont_create_streaming("B:src/test_assets/test_font_1.fnt", 8);
+    TEST_ASSERT_NOT_NULL(font_1_bin);
+
+    font_2_bin = lv_binfont_create_streaming("B:src/test_assets/test_font_2.fnt", 8);
+    TEST_ASSERT_NOT_NULL(font_2_bin);
+
+    font_3_bin = lv_binfont_create_streaming("B:src/test_assets/test_font_3.fnt", 8);
+    TEST_ASSERT_NOT_NULL(font_3_bin);
+
+    common();
+}
+
+void test_font_loader_streaming_from_buffer(void)
+{
+    lv_fs_path_ex_t path_1;
+    lv_fs_path_ex_t path_2;
+    lv_fs_path_ex_t path_3;
+    lv_fs_make_path_from_buffer(&path_1, LV_FS_MEMFS_LETTER, test_font_1_buf, sizeof(test_font_1_buf), "fnt");
+    lv_fs_make_path_from_buffer(&path_2, LV_FS_MEMFS_LETTER, test_font_2_buf, sizeof(test_font_2_buf), "fnt");
+    lv_fs_make_path_from_buffer(&path_3, LV_FS_MEMFS_LETTER, test_font_3_buf, sizeof(test_font_3_buf), "fnt");
+
+    font_1_bin = lv_binfont_create_streaming((const char *)&path_1, 8);
+    TEST_ASSERT_NOT_NULL(font_1_bin);
+
+    font_2_bin = lv_binfont_create_streaming((const char *)&path_2, 8);
+    TEST_ASSERT_NOT_NULL(font_2_bin);
+
+    font_3_bin = lv_binfont_create_streaming((const char *)&path_3, 8);
+    TEST_ASSERT_NOT_NULL(font_3_bin);
+
+    common();
+}
+
+void test_font_loader_streaming_memory(void)
+{
+    static const char * paths[] = {
+        "A:src/test_assets/test_font_1.fnt",
+        "B:src/test_assets/test_font_1.fnt",
+    };
+
+    for(uint32_t i = 0; i < sizeof(paths) / sizeof(paths[0]); i++) {
+        size_t mem_start = lv_test_get_free_mem();
+        uint32_t t_start = get_time_us();
+        lv_font_t * font = lv_binfont_create(paths[i]);
+        uint32_t t_full = get_time_us() - t_start;
+        size_t mem_full = mem_start - lv_test_get_free_mem();
+        TEST_ASSERT_NOT_NULL(font);
+        lv_binfont_destroy(font);
+
+        t_start = get_time_us();
+        font = lv_binfont_create_streaming(paths[i], 8);
+        uint32_t t_stream = get_time_us() - t_start;
+        size_t mem_stream = mem_start - lv_test_get_free_mem();
+        TEST_ASSERT_NOT_NULL(font);
+
+        /*Rendering loads only the used glyphs and the cache keeps at most 8 of them*/
+        lv_obj_t * label = lv_label_create(lv_screen_active());
+        lv_obj_set_style_text_font(label, font, 0);
+        lv_label_set_text(label, "The quick brown fox jumped over the lazy dog");
+        lv_refr_now(NULL);
+        size_t mem_stream_used = mem_start - lv_test_get_free_mem();
+        lv_obj_delete(label);
+
+        TEST_PRINTF("%s: full load %"LV_PRIu32" us, %zu bytes; streaming %"LV_PRIu32" us, %zu bytes (%zu bytes after rendering)",
+                    paths[i], t_full, mem_full, t_stream, mem_stream, mem_stream_used);
+
+        lv_binfont_destroy(font);
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+        /*The memory usage can be measured only with the built-in allocator*/
+        TEST_ASSERT_LESS_THAN(mem_full, mem_stream);
+        TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_start, 0);
+#endif
+    }
+}
+
 void test_font_loader_reload(void)
 {
     /*Reload a font which is being used by a label*/
@@ -301,10 +403,27 @@ static int compare_fonts(lv_font_t * f1, lv_font_t * f2)
             int size1 = glyph_dsc1[i + 1].bitmap_index - glyph_dsc1[i].bitmap_index;
 
             if(size1 > 0) {
+                /*Streaming fonts have no bitmap array, get the raw bitmaps one by one*/
+                lv_font_glyph_dsc_t g;
+                lv_memzero(&g, sizeof(g));
+                const uint8_t * bitmap2;
+                if(dsc2->glyph_bitmap) {
+                    bitmap2 = dsc2->glyph_bitmap + glyph_dsc2[i].bitmap_index;
+                }
+                else {
+                    g.resolved_font = f2;
+                    g.gid.index = i;
+                    g.req_raw_bitmap = 1;
+                    bitmap2 = f2->get_glyph_bitmap(&g, NULL);
+                    TEST_ASSERT_NOT_NULL_MESSAGE(bitmap2, "glyph_bitmap");
+                }
+
                 TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(
                     dsc1->glyph_bitmap + glyph_dsc1[i].bitmap_index,
-                    dsc2->glyph_bitmap + glyph_dsc2[i].bitmap_index,
+                    bitmap2,
                     size1 - 1, "glyph_bitmap");
+
+                lv_font_glyph_release_draw_data(&g);
             }
         }
         TEST_ASSERT_EQUAL_INT_MESSAGE(glyph_dsc1[i].adv_w, glyph_dsc2[i].adv_w, "adv_w");
@@ -322,4 +441,11 @@ static int compare_fonts(lv_font_t * f1, lv_font_t * f2)
  *   STATIC FUNCTIONS
  **********************/
 
+static uint32_t get_time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
 #endif // LV_BUILD_TEST
@@ -0,0 +1,215 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static uint32_t render_cnt;
+static uint32_t timer_cnt;
+static uint32_t anim_cnt;
+static uint32_t render_time;
+static void * vsync_request_param;
+
+static void render_start_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    render_cnt++;
+}
+
+static void vsync_request_event_cb(lv_event_t * e)
+{
+    vsync_request_param = lv_event_get_param(e);
+}
+
+static void slow_draw_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    lv_tick_inc(render_time);
+}
+
+static void timer_cb(lv_timer_t * t)
+{
+    LV_UNUSED(t);
+    timer_cnt++;
+}
+
+static void anim_exec_cb(void * var, int32_t v)
+{
+    LV_UNUSED(var);
+    LV_UNUSED(v);
+    anim_cnt++;
+}
+
+static void run_timers(uint32_t ms)
+{
+    lv_tick_inc(ms);
+    lv_timer_handler();
+}
+
+/*Create an object which takes `render_time` ms to draw*/
+static lv_obj_t * create_slow_obj(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_event_cb(obj, slow_draw_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+    return obj;
+}
+
+void setUp(void)
+{
+    lv_display_add_event_cb(lv_display_get_default(), render_start_event_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(lv_display_get_default(), vsync_request_event_cb, LV_EVENT_VSYNC_REQUEST, NULL);
+    render_cnt = 0;
+    timer_cnt = 0;
+    anim_cnt = 0;
+    render_time = 0;
+}
+
+void tearDown(void)
+{
+    lv_display_set_vsync_pacing(NULL, false);
+    lv_display_set_frame_budget(NULL, 0);
+    lv_anim_delete_all();
+    lv_obj_clean(lv_screen_active());
+    lv_refr_now(NULL);
+
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), render_start_event_cb, NULL);
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), vsync_request_event_cb, NULL);
+}
+
+void test_frame_budget_vsync_pacing(void)
+{
+    lv_display_set_vsync_pacing(NULL, true);
+    TEST_ASSERT_TRUE(lv_display_get_vsync_pacing(NULL));
+    TEST_ASSERT_EQUAL_PTR(lv_display_get_default(), vsync_request_param);
+
+    /*Invalidated, but it waits for the vsync*/
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    run_timers(100);
+    TEST_ASSERT_EQUAL_UINT32(0, render_cnt);
+
+    lv_display_report_vsync(NULL, lv_tick_get());
+    run_timers(0);
+    TEST_ASSERT_EQUAL_UINT32(1, render_cnt);
+
+    /*Nothing to do on the next vsync*/
+    lv_display_report_vsync(NULL, lv_tick_get());
+    run_timers(0);
+    TEST_ASSERT_EQUAL_UINT32(1, render_cnt);
+
+    lv_obj_set_x(obj, 10);
+    lv_display_report_vsync(NULL, lv_tick_get());
+    run_timers(0);
+    TEST_ASSERT_EQUAL_UINT32(2, render_cnt);
+
+    /*Disabling it doesn't lose the pending refresh*/
+    lv_obj_set_x(obj, 20);
+    lv_display_set_vsync_pacing(NULL, false);
+    TEST_ASSERT_NULL(vsync_request_param);
+    run_timers(LV_DEF_REFR_PERIOD);
+    TEST_ASSERT_EQUAL_UINT32(3, render_cnt);
+}
+
+void test_frame_budget_from_vsync_period(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(0, lv_display_get_frame_budget(NULL));
+
+    lv_display_set_vsync_pacing(NULL, true);
+    uint32_t t = lv_tick_get();
+    lv_display_report_vsync(NULL, t);
+    lv_display_report_vsync(NULL, t + 16);
+    TEST_ASSERT_EQUAL_UINT32(16, lv_display_get_frame_budget(NULL));
+
+    /*An explicit budget overrides the vsync period*/
+    lv_display_set_frame_budget(NULL, 10);
+    TEST_ASSERT_EQUAL_UINT32(10, lv_display_get_frame_budget(NULL));
+}
+
+void test_frame_budget_miss(void)
+{
+    lv_display_set_frame_budget(NULL, 20);
+    create_slow_obj();
+
+    render_time = 5;
+    lv_refr_now(NULL);
+    TEST_ASSERT_FALSE(lv_display_is_over_budget(NULL));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_display_get_frame_budget_miss_count(NULL));
+
+    render_time = 30;
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(lv_display_is_over_budget(NULL));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_display_get_frame_budget_miss_count(NULL));
+
+    /*A fast frame ends the degraded state*/
+    render_time = 5;
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_FALSE(lv_display_is_over_budget(NULL));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_display_get_frame_budget_miss_count(NULL));
+}
+
+void test_frame_budget_postpones_low_priority_timers(void)
+{
+    lv_timer_t * low = lv_timer_create(timer_cb, 50, NULL);
+    lv_timer_set_low_priority(low, true);
+
+    /*On budget the timer runs on time*/
+    run_timers(50);
+    TEST_ASSERT_EQUAL_UINT32(1, timer_cnt);
+
+    lv_display_set_frame_budget(NULL, 20);
+    create_slow_obj();
+    render_time = 30;
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(lv_display_is_over_budget(NULL));
+
+    /*Waits for up to one more period*/
+    lv_timer_reset(low);
+    run_timers(50);
+    TEST_ASSERT_EQUAL_UINT32(1, timer_cnt);
+    run_timers(50);
+    TEST_ASSERT_EQUAL_UINT32(2, timer_cnt);
+
+    /*Normal timers are not postponed*/
+    lv_timer_set_low_priority(low, false);
+    run_timers(50);
+    TEST_ASSERT_EQUAL_UINT32(3, timer_cnt);
+
+    lv_timer_delete(low);
+}
+
+void test_frame_budget_skips_anim_frames(void)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_exec_cb(&a, anim_exec_cb);
+    lv_anim_set_values(&a, 0, 10000);
+    lv_anim_set_duration(&a, 10000);
+    lv_anim_start(&a);
+
+    anim_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < 10; i++) run_timers(LV_DEF_REFR_PERIOD);
+    TEST_ASSERT_EQUAL_UINT32(10, anim_cnt);
+
+    lv_display_set_frame_budget(NULL, 20);
+    create_slow_obj();
+    render_time = 30;
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(lv_display_is_over_budget(NULL));
+
+    /*Every second animation frame is skipped*/
+    anim_cnt = 0;
+    for(i = 0; i < 10; i++) run_timers(LV_DEF_REFR_PERIOD);
+    TEST_ASSERT_EQUAL_UINT32(5, anim_cnt);
+
+    /*lv_anim_refr_now() always steps the animations*/
+    anim_cnt = 0;
+    lv_tick_inc(LV_DEF_REFR_PERIOD);
+    lv_anim_refr_now();
+    lv_tick_inc(LV_DEF_REFR_PERIOD);
+    lv_anim_refr_now();
+    TEST_ASSERT_EQUAL_UINT32(2, anim_cnt);
+}
+
+#endif
@@ -450,6 +450,56 @@ void test_fs_load_to_buf(void)
     lv_test_fs_set_ready(true);
 }
 
+void test_fs_mmap(void)
+{
+    lv_fs_res_t res;
+    lv_fs_file_t f;
+    const void * mapped;
+
+    /* Test with drive 'B' (POSIX) at an offset which is not page aligned */
+    res = lv_fs_open(&f, "B:src/test_files/readtest.txt", LV_FS_MODE_RD);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+
+    res = lv_fs_mmap(&f, 13, 100, &mapped);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    TEST_ASSERT_EQUAL_MEMORY(read_exp + 13, mapped, 100);
+
+    /* The read position is not affected */
+    uint8_t buf[10];
+    uint32_t br;
+    res = lv_fs_read(&f, buf, sizeof(buf), &br);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    TEST_ASSERT_EQUAL_MEMORY(read_exp, buf, sizeof(buf));
+
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_munmap(&f, mapped, 100));
+
+    /* Mapping beyond the end of the file fails */
+    res = lv_fs_mmap(&f, 700, 100, &mapped);
+    TEST_ASSERT_NOT_EQUAL(LV_FS_RES_OK, res);
+    TEST_ASSERT_NULL(mapped);
+    lv_fs_close(&f);
+
+    /* Test with drive 'M' (memfs) which returns the buffer itself */
+    lv_fs_path_ex_t path;
+    lv_fs_make_path_from_buffer(&path, 'M', read_exp, lv_strlen(read_exp), "txt");
+    res = lv_fs_open(&f, (const char *)&path, LV_FS_MODE_RD);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+
+    res = lv_fs_mmap(&f, 20, 30, &mapped);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    TEST_ASSERT_EQUAL_PTR(read_exp + 20, mapped);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_munmap(&f, mapped, 30));
+    lv_fs_close(&f);
+
+    /* Test with drive 'A' (stdio) which can't map files */
+    res = lv_fs_open(&f, "A:src/test_files/readtest.txt", LV_FS_MODE_RD);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    res = lv_fs_mmap(&f, 0, 10, &mapped);
+    TEST_ASSERT_EQUAL(LV_FS_RES_NOT_IMP, res);
+    TEST_ASSERT_NULL(mapped);
+    lv_fs_close(&f);
+}
+
 void test_fs_dir_open(void)
 {
     lv_fs_res_t res;
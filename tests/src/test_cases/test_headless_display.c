@@ -0,0 +1,165 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_HEADLESS_DISPLAY
+
+#define TEST_HOR_RES    100
+#define TEST_VER_RES    80
+
+static lv_display_t * test_disp;
+static lv_headless_display_frame_info_t frame_sum;
+static uint32_t frame_cnt;
+
+static void frame_cb(lv_display_t * disp, const lv_headless_display_frame_info_t * info, void * user_data)
+{
+    TEST_ASSERT_EQUAL_PTR(test_disp, disp);
+    TEST_ASSERT_EQUAL_PTR(&frame_cnt, user_data);
+
+    frame_cnt++;
+    frame_sum.render_time_us += info->render_time_us;
+    frame_sum.flush_time_us += info->flush_time_us;
+    frame_sum.draw_task_cnt += info->draw_task_cnt;
+    frame_sum.flush_cnt += info->flush_cnt;
+    frame_sum.flushed_px_cnt += info->flushed_px_cnt;
+}
+
+static void create_display(lv_display_render_mode_t render_mode)
+{
+    test_disp = lv_headless_display_create(TEST_HOR_RES, TEST_VER_RES, render_mode);
+    TEST_ASSERT_NOT_NULL(test_disp);
+    lv_headless_display_set_frame_cb(test_disp, frame_cb, &frame_cnt);
+}
+
+static lv_obj_t * create_red_rect(void)
+{
+    lv_obj_t * scr = lv_display_get_screen_active(test_disp);
+    lv_obj_set_style_bg_color(scr, lv_color_white(), 0);
+
+    lv_obj_t * obj = lv_obj_create(scr);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0000), 0);
+    lv_obj_set_pos(obj, 10, 20);
+    lv_obj_set_size(obj, 30, 40);
+    return obj;
+}
+
+void setUp(void)
+{
+    lv_memzero(&frame_sum, sizeof(frame_sum));
+    frame_cnt = 0;
+}
+
+void tearDown(void)
+{
+    if(test_disp) lv_display_delete(test_disp);
+    test_disp = NULL;
+}
+
+void test_headless_display_measures_frames(void)
+{
+    lv_display_render_mode_t modes[] = {
+        LV_DISPLAY_RENDER_MODE_PARTIAL,
+        LV_DISPLAY_RENDER_MODE_DIRECT,
+        LV_DISPLAY_RENDER_MODE_FULL
+    };
+
+    for(uint32_t i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+        create_display(modes[i]);
+        setUp();
+
+        create_red_rect();
+        lv_refr_now(test_disp);
+
+        TEST_ASSERT_EQUAL_UINT32(1, frame_cnt);
+        TEST_ASSERT_EQUAL_UINT32(TEST_HOR_RES * TEST_VER_RES, frame_sum.flushed_px_cnt);
+        TEST_ASSERT_GREATER_THAN_UINT32(0, frame_sum.draw_task_cnt);
+        if(modes[i] == LV_DISPLAY_RENDER_MODE_PARTIAL) {
+            TEST_ASSERT_GREATER_THAN_UINT32(1, frame_sum.flush_cnt);
+        }
+        else {
+            TEST_ASSERT_EQUAL_UINT32(1, frame_sum.flush_cnt);
+        }
+
+        /*Nothing changed so no frame is reported*/
+        lv_refr_now(test_disp);
+        TEST_ASSERT_EQUAL_UINT32(1, frame_cnt);
+
+        lv_display_delete(test_disp);
+        test_disp = NULL;
+    }
+}
+
+void test_headless_display_memory_sink(void)
+{
+    create_display(LV_DISPLAY_RENDER_MODE_PARTIAL);
+
+    TEST_ASSERT_NULL(lv_headless_display_get_memory_sink(test_disp));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_headless_display_set_memory_sink(test_disp, true));
+
+    lv_draw_buf_t * sink = lv_headless_display_get_memory_sink(test_disp);
+    TEST_ASSERT_NOT_NULL(sink);
+    TEST_ASSERT_EQUAL_UINT32(TEST_HOR_RES, sink->header.w);
+    TEST_ASSERT_EQUAL_UINT32(TEST_VER_RES, sink->header.h);
+
+    create_red_rect();
+    lv_refr_now(test_disp);
+
+#if LV_COLOR_DEPTH == 32
+    lv_color32_t * inside = lv_draw_buf_goto_xy(sink, 25, 40);
+    TEST_ASSERT_EQUAL_UINT8(0xff, inside->red);
+    TEST_ASSERT_EQUAL_UINT8(0x00, inside->green);
+    TEST_ASSERT_EQUAL_UINT8(0x00, inside->blue);
+
+    /*Last row, rendered in the last area*/
+    lv_color32_t * outside = lv_draw_buf_goto_xy(sink, 25, TEST_VER_RES - 1);
+    TEST_ASSERT_EQUAL_UINT8(0xff, outside->red);
+    TEST_ASSERT_EQUAL_UINT8(0xff, outside->green);
+    TEST_ASSERT_EQUAL_UINT8(0xff, outside->blue);
+#endif
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_headless_display_set_memory_sink(test_disp, false));
+    TEST_ASSERT_NULL(lv_headless_display_get_memory_sink(test_disp));
+}
+
+void test_headless_display_transfer_time(void)
+{
+    create_display(LV_DISPLAY_RENDER_MODE_PARTIAL);
+
+    lv_headless_display_set_transfer_time(test_disp, 2000, 0);
+
+    create_red_rect();
+    lv_refr_now(test_disp);
+
+    /*Each area but the last waits for the transfer of the previous one*/
+    TEST_ASSERT_EQUAL_UINT32(1, frame_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32((frame_sum.flush_cnt - 1) * 2000, frame_sum.flush_time_us);
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_headless_display_measures_frames(void)
+{
+}
+
+void test_headless_display_memory_sink(void)
+{
+}
+
+void test_headless_display_transfer_time(void)
+{
+}
+
+#endif /*LV_USE_HEADLESS_DISPLAY*/
+
+#endif
@@ -295,4 +295,124 @@ void test_indev_scroll_between_two_buttons_with_and_without_press_lock(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("scroll_initial.png");
 }
 
+static void indev_sample_read_cb(lv_indev_t * indev, lv_indev_data_t * data)
+{
+    /*The samples are pushed by the test*/
+    LV_UNUSED(indev);
+    LV_UNUSED(data);
+}
+
+static lv_indev_t * indev_sample_create(void)
+{
+    lv_indev_t * indev = lv_indev_create();
+    lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(indev, indev_sample_read_cb);
+    lv_indev_set_mode(indev, LV_INDEV_MODE_EVENT);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_indev_set_sample_buffer_size(indev, 16));
+    return indev;
+}
+
+static void indev_sample_push(lv_indev_t * indev, int32_t x, int32_t y, lv_indev_state_t state, uint32_t timestamp)
+{
+    lv_indev_data_t data;
+    lv_memzero(&data, sizeof(data));
+    data.point.x = x;
+    data.point.y = y;
+    data.state = state;
+    data.timestamp = timestamp;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_indev_push_sample(indev, &data));
+}
+
+static void indev_sample_count_event_cb(lv_event_t * e)
+{
+    uint32_t * cnt = lv_event_get_user_data(e);
+    (*cnt)++;
+}
+
+void test_indev_sample_buffer_disabled(void)
+{
+    lv_indev_t * indev = lv_indev_create();
+    lv_indev_data_t data;
+    lv_memzero(&data, sizeof(data));
+
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_indev_push_sample(indev, &data));
+
+    lv_indev_delete(indev);
+}
+
+void test_indev_sample_buffer_coalesces_moves(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 300, 300);
+    lv_obj_t * child = lv_obj_create(cont);
+    lv_obj_set_size(child, 200, 1000);
+    lv_obj_update_layout(cont);
+
+    uint32_t pressing_cnt = 0;
+    uint32_t scroll_cnt = 0;
+    lv_obj_add_event_cb(cont, indev_sample_count_event_cb, LV_EVENT_PRESSING, &pressing_cnt);
+    lv_obj_add_event_cb(cont, indev_sample_count_event_cb, LV_EVENT_SCROLL, &scroll_cnt);
+
+    lv_indev_t * indev = indev_sample_create();
+    lv_test_wait(200);
+    uint32_t t = lv_tick_get() - 100;
+
+    /*A press and 8 moves reported in one read*/
+    indev_sample_push(indev, 20, 250, LV_INDEV_STATE_PRESSED, t);
+    for(int32_t i = 1; i <= 8; i++) {
+        indev_sample_push(indev, 20, 250 - i * 10, LV_INDEV_STATE_PRESSED, t + i * 8);
+    }
+    lv_indev_read(indev);
+
+    /*The press and the last position are processed only*/
+    TEST_ASSERT_EQUAL_UINT32(2, pressing_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, scroll_cnt);
+    TEST_ASSERT_EQUAL_PTR(cont, lv_indev_get_scroll_obj(indev));
+
+    lv_point_t vect;
+    lv_indev_get_vect(indev, &vect);
+    TEST_ASSERT_EQUAL_INT32(-80, vect.y);
+
+    /*The velocity is estimated from the timestamps: 10 px in 8 ms*/
+    lv_point_t velocity;
+    lv_indev_get_velocity(indev, &velocity);
+    TEST_ASSERT_EQUAL_INT32(0, velocity.x);
+    TEST_ASSERT_EQUAL_INT32(-1250, velocity.y);
+
+    indev_sample_push(indev, 20, 170, LV_INDEV_STATE_RELEASED, 0);
+    lv_indev_read(indev);
+    TEST_ASSERT_EQUAL(LV_INDEV_STATE_RELEASED, lv_indev_get_state(indev));
+    TEST_ASSERT_GREATER_THAN_INT32(0, lv_obj_get_scroll_y(cont));
+
+    lv_indev_delete(indev);
+}
+
+void test_indev_sample_buffer_keeps_state_changes(void)
+{
+    lv_obj_t * btn = lv_button_create(lv_screen_active());
+    lv_obj_set_size(btn, 100, 100);
+    lv_obj_update_layout(btn);
+
+    uint32_t pressed_cnt = 0;
+    uint32_t released_cnt = 0;
+    lv_obj_add_event_cb(btn, indev_sample_count_event_cb, LV_EVENT_PRESSED, &pressed_cnt);
+    lv_obj_add_event_cb(btn, indev_sample_count_event_cb, LV_EVENT_RELEASED, &released_cnt);
+
+    lv_indev_t * indev = indev_sample_create();
+
+    /*Two quick taps between two reads are not lost*/
+    indev_sample_push(indev, 50, 50, LV_INDEV_STATE_PRESSED, 0);
+    indev_sample_push(indev, 51, 50, LV_INDEV_STATE_PRESSED, 0);
+    indev_sample_push(indev, 51, 50, LV_INDEV_STATE_RELEASED, 0);
+    indev_sample_push(indev, 50, 50, LV_INDEV_STATE_PRESSED, 0);
+    indev_sample_push(indev, 50, 50, LV_INDEV_STATE_RELEASED, 0);
+    lv_indev_read(indev);
+
+    TEST_ASSERT_EQUAL_UINT32(2, pressed_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, released_cnt);
+    TEST_ASSERT_EQUAL(LV_INDEV_STATE_RELEASED, lv_indev_get_state(indev));
+
+    lv_indev_delete(indev);
+}
+
 #endif
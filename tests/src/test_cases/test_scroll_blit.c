@@ -0,0 +1,173 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static uint32_t inv_px_cnt;
+
+static void invalidate_area_event_cb(lv_event_t * e)
+{
+    lv_area_t * area = lv_event_get_param(e);
+    inv_px_cnt += lv_area_get_size(area);
+}
+
+void setUp(void)
+{
+    lv_display_set_scroll_blit(NULL, true);
+    lv_display_add_event_cb(lv_display_get_default(), invalidate_area_event_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    inv_px_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_display_set_scroll_blit(NULL, false);
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), invalidate_area_event_cb, NULL);
+    lv_obj_clean(lv_screen_active());
+    lv_obj_clean(lv_layer_top());
+}
+
+static lv_obj_t * create_list(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 300, 300);
+    lv_obj_center(cont);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < 30; i++) {
+        lv_obj_t * btn = lv_button_create(cont);
+        lv_obj_set_width(btn, 400);
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "Item %d", (int)i);
+    }
+
+    lv_refr_now(NULL);
+    return cont;
+}
+
+/*Redraw the whole screen and check that the blitted frame was the same*/
+static void assert_same_as_redrawn(void)
+{
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    uint32_t size = buf->header.stride * buf->header.h;
+    uint8_t * blitted = lv_malloc(size);
+    TEST_ASSERT_NOT_NULL(blitted);
+    lv_memcpy(blitted, buf->data, size);
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_MEMORY(buf->data, blitted, size);
+    lv_free(blitted);
+}
+
+void test_scroll_blit_redraws_exposed_strip(void)
+{
+    lv_obj_t * cont = create_list();
+    int32_t cont_size = lv_obj_get_width(cont) * lv_obj_get_height(cont);
+
+    /*Scroll like an input device does between the scroll begin and end events*/
+    inv_px_cnt = 0;
+    lv_obj_scroll_by_raw(cont, 0, -17);
+    lv_refr_now(NULL);
+    TEST_ASSERT_LESS_THAN_INT32(cont_size / 2, inv_px_cnt);
+    assert_same_as_redrawn();
+
+    /*Several scrolls in both directions between two refreshes*/
+    inv_px_cnt = 0;
+    lv_obj_scroll_by_raw(cont, -13, -25);
+    lv_obj_scroll_by_raw(cont, 0, 11);
+    lv_obj_scroll_by_raw(cont, 7, -31);
+    lv_refr_now(NULL);
+    TEST_ASSERT_LESS_THAN_INT32(cont_size, inv_px_cnt);
+    assert_same_as_redrawn();
+}
+
+void test_scroll_blit_with_changed_child(void)
+{
+    lv_obj_t * cont = create_list();
+
+    /*Invalidated before the scroll, so it's moved with the pixels*/
+    lv_obj_t * btn = lv_obj_get_child(cont, 2);
+    lv_obj_set_style_bg_color(btn, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_scroll_by_raw(cont, 0, -40);
+
+    /*Invalidated after the scroll*/
+    btn = lv_obj_get_child(cont, 5);
+    lv_obj_set_style_bg_color(btn, lv_palette_main(LV_PALETTE_GREEN), 0);
+    lv_refr_now(NULL);
+
+    assert_same_as_redrawn();
+}
+
+void test_scroll_blit_fallback_when_covered(void)
+{
+    lv_obj_t * cont = create_list();
+    int32_t cont_size = lv_obj_get_width(cont) * lv_obj_get_height(cont);
+
+    lv_obj_t * overlay = lv_obj_create(lv_layer_top());
+    lv_obj_set_size(overlay, 100, 100);
+    lv_obj_center(overlay);
+    lv_refr_now(NULL);
+
+    inv_px_cnt = 0;
+    lv_obj_scroll_by_raw(cont, 0, -20);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_OR_EQUAL_INT32(cont_size, inv_px_cnt);
+    assert_same_as_redrawn();
+}
+
+void test_scroll_blit_fallback_when_transparent(void)
+{
+    lv_obj_t * cont = create_list();
+    int32_t cont_size = lv_obj_get_width(cont) * lv_obj_get_height(cont);
+
+    lv_obj_set_style_bg_opa(cont, LV_OPA_50, 0);
+    lv_refr_now(NULL);
+
+    inv_px_cnt = 0;
+    lv_obj_scroll_by_raw(cont, 0, -20);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_OR_EQUAL_INT32(cont_size, inv_px_cnt);
+    assert_same_as_redrawn();
+}
+
+#if LV_USE_HEADLESS_DISPLAY
+void test_scroll_blit_double_buffered(void)
+{
+    lv_display_t * disp_ori = lv_display_get_default();
+    lv_display_t * disp = lv_headless_display_create(400, 400, LV_DISPLAY_RENDER_MODE_DIRECT);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_headless_display_set_memory_sink(disp, true));
+    lv_display_set_default(disp);
+    lv_display_set_scroll_blit(disp, true);
+
+    lv_obj_t * cont = create_list();
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_obj_scroll_by_raw(cont, 0, -15);
+        lv_refr_now(disp);
+    }
+
+    /*The sink has what the driver received, it needs to match a full redraw*/
+    lv_draw_buf_t * sink = lv_headless_display_get_memory_sink(disp);
+    uint32_t size = sink->header.stride * sink->header.h;
+    uint8_t * blitted = lv_malloc(size);
+    TEST_ASSERT_NOT_NULL(blitted);
+    lv_memcpy(blitted, sink->data, size);
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_MEMORY(sink->data, blitted, size);
+    lv_free(blitted);
+
+    lv_display_set_default(disp_ori);
+    lv_display_delete(disp);
+}
+#else
+void test_scroll_blit_double_buffered(void)
+{
+}
+#endif /*LV_USE_HEADLESS_DISPLAY*/
+
+#endif
@@ -312,4 +312,122 @@ void test_chart_properties(void)
 #endif
 }
 
+static int32_t crowded_value(uint32_t i)
+{
+    /*A deterministic signal with spikes*/
+    int32_t v = (int32_t)(((i * 37) % 101) / 2) + lv_trigo_sin((int32_t)(i % 360)) / 700;
+    if(i % 97 == 0) v += 40;
+    return v;
+}
+
+void test_chart_crowded_line(void)
+{
+    lv_obj_set_size(chart, 400, 300);
+    lv_obj_center(chart);
+    lv_chart_set_axis_range(chart, LV_CHART_AXIS_PRIMARY_Y, -100, 150);
+    lv_chart_set_point_count(chart, 5000);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+
+    uint32_t i;
+    for(i = 0; i < 5000; i++) {
+        lv_chart_set_next_value(chart, ser, crowded_value(i));
+    }
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_crowded_1.png");
+
+    /*Overwrite the extremes to update the envelope*/
+    for(i = 0; i < 5000; i += 97) {
+        lv_chart_set_series_value_by_id(chart, ser, i, -80);
+    }
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_crowded_2.png");
+
+    /*Zoomed and scrolled*/
+    lv_obj_set_style_pad_all(chart, 0, 0);
+    lv_obj_set_style_border_width(chart, 0, 0);
+    lv_obj_t * cont = lv_obj_create(active_screen);
+    lv_obj_set_size(cont, 400, 300);
+    lv_obj_center(cont);
+    lv_obj_set_parent(chart, cont);
+    lv_obj_set_size(chart, 1200, 260);
+    lv_obj_scroll_to_x(cont, 500, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_crowded_3.png");
+}
+
+static lv_chart_series_t * shift_blit_chart_create(uint32_t point_cnt, uint32_t ser_cnt)
+{
+    lv_obj_set_size(chart, 300, 200);
+    lv_obj_set_style_pad_all(chart, 0, 0);
+    lv_obj_set_style_border_width(chart, 0, 0);
+    lv_obj_center(chart);
+    lv_chart_set_axis_range(chart, LV_CHART_AXIS_PRIMARY_Y, -100, 150);
+    lv_chart_set_point_count(chart, point_cnt);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_chart_set_shift_blit(chart, true);
+    TEST_ASSERT_TRUE(lv_chart_get_shift_blit(chart));
+
+    lv_chart_series_t * ser = NULL;
+    uint32_t s;
+    for(s = 0; s < ser_cnt; s++) {
+        ser = lv_chart_add_series(chart, lv_palette_main((lv_palette_t)(LV_PALETTE_RED + s * 4)), LV_CHART_AXIS_PRIMARY_Y);
+        uint32_t i;
+        for(i = 0; i < point_cnt; i++) {
+            lv_chart_set_next_value(chart, ser, crowded_value(i + s * 50));
+        }
+    }
+
+    return ser;
+}
+
+static void shift_blit_add_values(uint32_t start, uint32_t cnt, uint32_t per_frame)
+{
+    uint32_t i;
+    for(i = start; i < start + cnt; i++) {
+        lv_chart_series_t * ser;
+        uint32_t s = 0;
+        LV_LL_READ(&((lv_chart_t *)chart)->series_ll, ser) {
+            lv_chart_set_next_value(chart, ser, crowded_value(i + s * 50));
+            s++;
+        }
+        if((i + 1) % per_frame == 0) lv_refr_now(NULL);
+    }
+}
+
+void test_chart_shift_blit(void)
+{
+    /*300 px wide content with 75 gaps between the points: every new value shifts by 4 px*/
+    shift_blit_chart_create(76, 2);
+    lv_obj_set_style_width(chart, 6, LV_PART_INDICATOR);
+    lv_obj_set_style_height(chart, 6, LV_PART_INDICATOR);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(((lv_chart_t *)chart)->blit_buf);
+
+    shift_blit_add_values(1000, 20, 1);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_shift_blit_1.png");
+
+    /*Rendering everything again gives the same result*/
+    lv_chart_refresh(chart);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_shift_blit_1.png");
+
+    lv_chart_set_shift_blit(chart, false);
+    TEST_ASSERT_NULL(((lv_chart_t *)chart)->blit_buf);
+}
+
+void test_chart_shift_blit_crowded(void)
+{
+    /*600 gaps on 300 px: two new values shift by 1 px*/
+    shift_blit_chart_create(601, 1);
+    lv_refr_now(NULL);
+
+    shift_blit_add_values(1000, 40, 2);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_shift_blit_2.png");
+
+    lv_chart_refresh(chart);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_shift_blit_2.png");
+
+    /*Odd number of new values can't be blitted so everything is rendered again*/
+    shift_blit_add_values(2000, 3, 3);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_shift_blit_3.png");
+    lv_chart_refresh(chart);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_shift_blit_3.png");
+}
+
 #endif
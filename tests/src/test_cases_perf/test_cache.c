@@ -0,0 +1,122 @@
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define LOOKUP_CNT  50000
+#define PATH_LEN    32
+
+typedef struct {
+    const char * path;
+} test_data_t;
+
+static char (*paths)[PATH_LEN];
+
+static lv_cache_compare_res_t compare_cb(const test_data_t * lhs, const test_data_t * rhs)
+{
+    int32_t cmp_res = lv_strcmp(lhs->path, rhs->path);
+    if(cmp_res != 0) return cmp_res > 0 ? 1 : -1;
+    return 0;
+}
+
+static uint32_t hash_cb(const test_data_t * key)
+{
+    return lv_cache_hash_str(key->path, LV_CACHE_HASH_SEED);
+}
+
+static void free_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(node);
+    LV_UNUSED(user_data);
+}
+
+static lv_cache_t * create_filled_cache(const lv_cache_class_t * cache_class, uint32_t entry_cnt)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t)hash_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t)free_cb,
+    };
+    lv_cache_t * cache = lv_cache_create(cache_class, sizeof(test_data_t), entry_cnt, ops);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    paths = lv_malloc(entry_cnt * PATH_LEN);
+    TEST_ASSERT_NOT_NULL(paths);
+
+    for(uint32_t i = 0; i < entry_cnt; i++) {
+        /*Similar paths like in the image cache, so that the string compares are not trivial*/
+        lv_snprintf(paths[i], PATH_LEN, "A:assets/images/img_%05" LV_PRIu32 ".png", i);
+        test_data_t key = { .path = paths[i] };
+        lv_cache_entry_t * entry = lv_cache_add(cache, &key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        lv_cache_release(cache, entry, NULL);
+    }
+
+    return cache;
+}
+
+static void lookup(lv_cache_t * cache, uint32_t entry_cnt)
+{
+    uint32_t index = 0;
+    for(uint32_t i = 0; i < LOOKUP_CNT; i++) {
+        /*Walk the entries with a stride to avoid sequential access*/
+        index = (index + 7919) % entry_cnt;
+        test_data_t key = { .path = paths[index] };
+        lv_cache_entry_t * entry = lv_cache_acquire(cache, &key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        lv_cache_release(cache, entry, NULL);
+    }
+}
+
+static void destroy_cache(lv_cache_t * cache)
+{
+    lv_cache_destroy(cache, NULL);
+    lv_free(paths);
+    paths = NULL;
+}
+
+void test_cache_lru_rb_lookup_100(void)
+{
+    lv_cache_t * cache = create_filled_cache(&lv_cache_class_lru_rb_count, 100);
+    TEST_ASSERT_MAX_TIME(lookup, 400, cache, 100);
+    destroy_cache(cache);
+}
+
+void test_cache_lru_ht_lookup_100(void)
+{
+    lv_cache_t * cache = create_filled_cache(&lv_cache_class_lru_ht_count, 100);
+    TEST_ASSERT_MAX_TIME(lookup, 400, cache, 100);
+    destroy_cache(cache);
+}
+
+void test_cache_lru_rb_lookup_1k(void)
+{
+    lv_cache_t * cache = create_filled_cache(&lv_cache_class_lru_rb_count, 1000);
+    TEST_ASSERT_MAX_TIME(lookup, 600, cache, 1000);
+    destroy_cache(cache);
+}
+
+void test_cache_lru_ht_lookup_1k(void)
+{
+    lv_cache_t * cache = create_filled_cache(&lv_cache_class_lru_ht_count, 1000);
+    TEST_ASSERT_MAX_TIME(lookup, 400, cache, 1000);
+    destroy_cache(cache);
+}
+
+void test_cache_lru_rb_lookup_10k(void)
+{
+    lv_cache_t * cache = create_filled_cache(&lv_cache_class_lru_rb_count, 10000);
+    TEST_ASSERT_MAX_TIME(lookup, 1000, cache, 10000);
+    destroy_cache(cache);
+}
+
+void test_cache_lru_ht_lookup_10k(void)
+{
+    lv_cache_t * cache = create_filled_cache(&lv_cache_class_lru_ht_count, 10000);
+    TEST_ASSERT_MAX_TIME(lookup, 400, cache, 10000);
+    destroy_cache(cache);
+}
+
+#endif
@@ -30,4 +30,31 @@ void test_chart(void)
                              new_point_count);
     }
 }
+
+static void stream_values(lv_chart_series_t * ser, uint32_t frame_cnt)
+{
+    uint32_t i;
+    for(i = 0; i < frame_cnt * 25; i++) {
+        lv_chart_set_next_value(chart, ser, lv_trigo_sin((int32_t)(i % 360)) / 330 + (int32_t)(i % 7));
+        if(i % 25 == 24) lv_refr_now(NULL);
+    }
+}
+
+void test_chart_stream_10k_points(void)
+{
+    /*25 new values per frame on a 10k point series shift the points by 1 px*/
+    lv_obj_set_size(chart, 400, 250);
+    lv_obj_set_style_pad_all(chart, 0, 0);
+    lv_obj_set_style_border_width(chart, 0, 0);
+    lv_chart_set_axis_range(chart, LV_CHART_AXIS_PRIMARY_Y, -110, 110);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_chart_set_point_count(chart, 10001);
+    lv_chart_set_shift_blit(chart, true);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+    stream_values(ser, 400);
+
+    TEST_ASSERT_MAX_TIME(stream_values, 300, ser, 20);
+
+    lv_obj_delete(chart);
+}
 #endif
@@ -0,0 +1,101 @@
+/* Performance test for rendering arcs, scales and triangles with the scanline rasterizer */
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define ARC_CNT         12
+#define SCALE_CNT       3
+#define TRIANGLE_CNT    50
+
+void setUp(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_style_pad_all(scr, 10, 0);
+    lv_obj_set_style_pad_gap(scr, 10, 0);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void render(uint32_t refr_cnt)
+{
+    uint32_t i;
+    for(i = 0; i < refr_cnt; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+}
+
+void test_arc_thick_and_thin(void)
+{
+    uint32_t i;
+    for(i = 0; i < ARC_CNT; i++) {
+        lv_obj_t * arc = lv_arc_create(lv_screen_active());
+        lv_obj_set_size(arc, 150, 150);
+        lv_arc_set_value(arc, (int32_t)(20 + i * 6));
+        if(i % 2) {
+            lv_obj_set_style_arc_width(arc, 3, LV_PART_MAIN);
+            lv_obj_set_style_arc_width(arc, 3, LV_PART_INDICATOR);
+        }
+    }
+
+    TEST_ASSERT_MAX_TIME(render, 400, 10);
+}
+
+void test_scale_round(void)
+{
+    uint32_t i;
+    for(i = 0; i < SCALE_CNT; i++) {
+        lv_obj_t * scale = lv_scale_create(lv_screen_active());
+        lv_obj_set_size(scale, 240, 240);
+        lv_scale_set_mode(scale, LV_SCALE_MODE_ROUND_INNER);
+        lv_scale_set_total_tick_count(scale, 61);
+        lv_scale_set_major_tick_every(scale, 5);
+        lv_obj_set_style_arc_width(scale, 2, LV_PART_MAIN);
+        lv_obj_set_style_line_width(scale, 2, LV_PART_ITEMS);
+        lv_obj_set_style_line_width(scale, 3, LV_PART_INDICATOR);
+        lv_obj_set_style_length(scale, 8, LV_PART_ITEMS);
+        lv_obj_set_style_length(scale, 14, LV_PART_INDICATOR);
+
+        lv_obj_t * needle = lv_line_create(scale);
+        lv_scale_set_line_needle_value(scale, needle, 100, (int32_t)(30 + i * 20));
+    }
+
+    TEST_ASSERT_MAX_TIME(render, 400, 10);
+}
+
+static void draw_triangles_event_cb(lv_event_t * e)
+{
+    lv_layer_t * layer = lv_event_get_layer(e);
+    lv_draw_triangle_dsc_t dsc;
+    lv_draw_triangle_dsc_init(&dsc);
+    dsc.color = lv_palette_main(LV_PALETTE_BLUE);
+    dsc.opa = LV_OPA_70;
+
+    uint32_t i;
+    for(i = 0; i < TRIANGLE_CNT; i++) {
+        int32_t x = (int32_t)(i % 10) * 75;
+        int32_t y = (int32_t)(i / 10) * 90;
+        dsc.p[0].x = x + 10;
+        dsc.p[0].y = y + 5;
+        dsc.p[1].x = x + 80;
+        dsc.p[1].y = y + 40;
+        dsc.p[2].x = x + 25;
+        dsc.p[2].y = y + 95;
+        lv_draw_triangle(layer, &dsc);
+    }
+}
+
+void test_triangles(void)
+{
+    lv_obj_add_event_cb(lv_screen_active(), draw_triangles_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    TEST_ASSERT_MAX_TIME(render, 400, 10);
+
+    lv_obj_remove_event_cb(lv_screen_active(), draw_triangles_event_cb);
+}
+#endif
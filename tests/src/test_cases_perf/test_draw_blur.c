@@ -0,0 +1,78 @@
+/* Performance test for the software blur with small and large radii */
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define CANVAS_WIDTH    800
+#define CANVAS_HEIGHT   480
+
+static lv_obj_t * canvas = NULL;
+
+void setUp(void)
+{
+    LV_DRAW_BUF_DEFINE_STATIC(canvas_buf, CANVAS_WIDTH, CANVAS_HEIGHT, LV_COLOR_FORMAT_XRGB8888);
+    LV_DRAW_BUF_INIT_STATIC(canvas_buf);
+
+    canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, &canvas_buf);
+
+    /*A flat area would be too easy for the blur*/
+    uint32_t i;
+    for(i = 0; i < CANVAS_WIDTH; i++) {
+        lv_canvas_set_px(canvas, i, i % CANVAS_HEIGHT, lv_color_white(), LV_OPA_COVER);
+    }
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void canvas_blur(int32_t blur_radius, lv_blur_quality_t quality)
+{
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_blur_dsc_t blur_dsc;
+    lv_draw_blur_dsc_init(&blur_dsc);
+    blur_dsc.blur_radius = blur_radius;
+    blur_dsc.quality = quality;
+
+    lv_area_t coords = {0, 0, CANVAS_WIDTH - 1, CANVAS_HEIGHT - 1};
+    lv_draw_blur(&layer, &blur_dsc, &coords);
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+void test_blur_precision_8(void)
+{
+    TEST_ASSERT_MAX_TIME(canvas_blur, 150, 8, LV_BLUR_QUALITY_PRECISION);
+}
+
+void test_blur_pyramid_8(void)
+{
+    TEST_ASSERT_MAX_TIME(canvas_blur, 150, 8, LV_BLUR_QUALITY_PYRAMID);
+}
+
+void test_blur_precision_32(void)
+{
+    TEST_ASSERT_MAX_TIME(canvas_blur, 150, 32, LV_BLUR_QUALITY_PRECISION);
+}
+
+void test_blur_pyramid_32(void)
+{
+    TEST_ASSERT_MAX_TIME(canvas_blur, 150, 32, LV_BLUR_QUALITY_PYRAMID);
+}
+
+void test_blur_precision_128(void)
+{
+    TEST_ASSERT_MAX_TIME(canvas_blur, 150, 128, LV_BLUR_QUALITY_PRECISION);
+}
+
+void test_blur_pyramid_128(void)
+{
+    TEST_ASSERT_MAX_TIME(canvas_blur, 150, 128, LV_BLUR_QUALITY_PYRAMID);
+}
+
+#endif
@@ -0,0 +1,72 @@
+/* Performance test for rendering many widgets with the same gradient */
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define BUTTON_CNT  40
+
+static lv_grad_dsc_t grad;
+
+static const lv_color_t grad_colors[2] = {
+    LV_COLOR_MAKE(0x21, 0x96, 0xf3),
+    LV_COLOR_MAKE(0xe9, 0x1e, 0x63),
+};
+
+void setUp(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_style_pad_all(scr, 10, 0);
+    lv_obj_set_style_pad_gap(scr, 10, 0);
+    lv_grad_init_stops(&grad, grad_colors, NULL, NULL, 2);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void create_buttons(void)
+{
+    uint32_t i;
+    for(i = 0; i < BUTTON_CNT; i++) {
+        lv_obj_t * btn = lv_button_create(lv_screen_active());
+        lv_obj_set_size(btn, 140, 60);
+        lv_obj_set_style_bg_grad(btn, &grad, 0);
+    }
+}
+
+static void render_buttons(uint32_t refr_cnt)
+{
+    uint32_t i;
+    for(i = 0; i < refr_cnt; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+}
+
+void test_grad_hor_buttons(void)
+{
+    lv_grad_horizontal_init(&grad);
+    create_buttons();
+    TEST_ASSERT_MAX_TIME(render_buttons, 600, 10);
+}
+
+#if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
+void test_grad_linear_buttons(void)
+{
+    lv_grad_linear_init(&grad, 0, 0, lv_pct(100), lv_pct(100), LV_GRAD_EXTEND_PAD);
+    create_buttons();
+    TEST_ASSERT_MAX_TIME(render_buttons, 800, 10);
+}
+
+void test_grad_radial_buttons(void)
+{
+    lv_grad_radial_init(&grad, lv_pct(50), lv_pct(50), lv_pct(100), lv_pct(50), LV_GRAD_EXTEND_REFLECT);
+    create_buttons();
+    TEST_ASSERT_MAX_TIME(render_buttons, 1000, 10);
+}
+#endif
+
+#endif
@@ -0,0 +1,37 @@
+/* Performance test for rendering the vector graphic demo with ThorVG.
+ * Run it with different LV_DRAW_SW_DRAW_UNIT_CNT values (e.g. 1, 2, 4) to compare the threads. */
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void render_screen(uint32_t refr_cnt)
+{
+    uint32_t i;
+    for(i = 0; i < refr_cnt; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+}
+
+void test_vector_graphic_demo(void)
+{
+#if LV_USE_DEMO_VECTOR_GRAPHIC && LV_USE_THORVG && LV_USE_DRAW_SW
+    lv_demo_vector_graphic_not_buffered();
+    TEST_ASSERT_MAX_TIME(render_screen, 2000, 10);
+#else
+    TEST_IGNORE_MESSAGE("The vector graphic demo is not enabled");
+#endif
+}
+
+#endif